@@ -0,0 +1,150 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "kabletop_channel.h"
+
+#define MAX_CHANNEL_CODES 16
+
+// usage: kabletop-channel <rounds.txt>
+//
+// replays a signed round sequence through the incremental validator, every line of the file
+// is a keyword followed by hex fields:
+//   args <hex>                   molecule Args or MerkleArgs of channel lock_script
+//   lock_hash <hex>              hash of channel lock_script
+//   channel_hash <hex>           output_type of the first round witness
+//   code <hex>                   lua code in the order of lua_code_hashes, may repeat
+//   round <hex> <signature hex>  molecule Round and its signature, after all lines above
+// "round <i>: <error code>" is printed for every round until the first failure, and
+// "winner: <n>" once all rounds are accepted
+
+int decode_hex(const char *hex, uint8_t **bytes, size_t *size)
+{
+    size_t len = hex ? strlen(hex) : 0;
+    if (len % 2 != 0)
+    {
+        return -1;
+    }
+    *bytes = malloc(len / 2 + 1);
+    if (*bytes == NULL)
+    {
+        return -1;
+    }
+    for (size_t i = 0; i < len / 2; ++i)
+    {
+        unsigned int byte;
+        if (sscanf(&hex[i * 2], "%2x", &byte) != 1)
+        {
+            free(*bytes);
+            *bytes = NULL;
+            return -1;
+        }
+        (*bytes)[i] = (uint8_t)byte;
+    }
+    *size = len / 2;
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: %s <rounds.txt>\n", argv[0]);
+        return 1;
+    }
+    FILE *file = fopen(argv[1], "r");
+    if (file == NULL)
+    {
+        fprintf(stderr, "cannot open %s\n", argv[1]);
+        return 1;
+    }
+
+    uint8_t *args = NULL, *lock_hash = NULL, *channel_hash = NULL;
+    size_t args_size = 0, lock_hash_size = 0, channel_hash_size = 0;
+    KabletopLuaCode codes[MAX_CHANNEL_CODES];
+    size_t code_count = 0;
+    KabletopChannel *channel = NULL;
+    uint16_t round_index = 0;
+    int ret = 0;
+    char *line = NULL;
+    size_t capacity = 0;
+    while (ret == 0 && getline(&line, &capacity, file) > 0)
+    {
+        char *keyword = strtok(line, " \t\r\n");
+        char *first = strtok(NULL, " \t\r\n");
+        char *second = strtok(NULL, " \t\r\n");
+        if (keyword == NULL)
+        {
+            continue;
+        }
+        if (strcmp(keyword, "args") == 0 && args == NULL)
+        {
+            ret = decode_hex(first, &args, &args_size);
+        }
+        else if (strcmp(keyword, "lock_hash") == 0 && lock_hash == NULL)
+        {
+            ret = decode_hex(first, &lock_hash, &lock_hash_size) || lock_hash_size != 32;
+        }
+        else if (strcmp(keyword, "channel_hash") == 0 && channel_hash == NULL)
+        {
+            ret = decode_hex(first, &channel_hash, &channel_hash_size) || channel_hash_size != 32;
+        }
+        else if (strcmp(keyword, "code") == 0 && channel == NULL && code_count < MAX_CHANNEL_CODES)
+        {
+            uint8_t *code = NULL;
+            ret = decode_hex(first, &code, &codes[code_count].size);
+            codes[code_count++].code = code;
+        }
+        else if (strcmp(keyword, "round") == 0 && args && lock_hash && channel_hash)
+        {
+            if (channel == NULL)
+            {
+                ret = kabletop_channel_open(&channel, args, args_size, lock_hash, channel_hash, codes, code_count);
+                if (ret != 0)
+                {
+                    printf("open: %d\n", ret);
+                    break;
+                }
+            }
+            uint8_t *round = NULL, *signature = NULL;
+            size_t round_size = 0, signature_size = 0;
+            if (decode_hex(first, &round, &round_size) || decode_hex(second, &signature, &signature_size)
+                || signature_size != 65)
+            {
+                fprintf(stderr, "invalid round %u\n", round_index);
+                ret = -1;
+            }
+            else
+            {
+                ret = kabletop_channel_push_round(channel, round, round_size, signature);
+                printf("round %u: %d\n", round_index++, ret);
+            }
+            free(round);
+            free(signature);
+            continue;
+        }
+        else
+        {
+            ret = -1;
+        }
+        if (ret != 0)
+        {
+            fprintf(stderr, "invalid line \"%s\"\n", keyword);
+        }
+    }
+    if (ret == 0 && channel)
+    {
+        printf("winner: %d\n", kabletop_channel_winner(channel));
+    }
+
+    kabletop_channel_close(channel);
+    for (size_t i = 0; i < code_count; ++i)
+    {
+        free((uint8_t *)codes[i].code);
+    }
+    free(args);
+    free(lock_hash);
+    free(channel_hash);
+    free(line);
+    fclose(file);
+    return ret == 0 ? 0 : 1;
+}
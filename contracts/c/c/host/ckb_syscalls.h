@@ -0,0 +1,42 @@
+#ifndef CKB_HOST_SYSCALLS
+#define CKB_HOST_SYSCALLS
+
+// host replacement of ckb-c-stdlib's "ckb_syscalls.h", syscalls are resolved from
+// the ckb-x64-simulator static library instead of RISC-V ecall instructions
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+#include "ckb_consts.h"
+
+int ckb_exit(int8_t code);
+int ckb_load_tx_hash(void* addr, uint64_t* len, size_t offset);
+int ckb_load_transaction(void* addr, uint64_t* len, size_t offset);
+int ckb_load_script_hash(void* addr, uint64_t* len, size_t offset);
+int ckb_load_script(void* addr, uint64_t* len, size_t offset);
+int ckb_debug(const char* s);
+int ckb_load_cell(void* addr, uint64_t* len, size_t offset, size_t index, size_t source);
+int ckb_load_input(void* addr, uint64_t* len, size_t offset, size_t index, size_t source);
+int ckb_load_header(void* addr, uint64_t* len, size_t offset, size_t index, size_t source);
+int ckb_load_witness(void* addr, uint64_t* len, size_t offset, size_t index, size_t source);
+int ckb_load_cell_by_field(void* addr, uint64_t* len, size_t offset, size_t index, size_t source, size_t field);
+int ckb_load_header_by_field(void* addr, uint64_t* len, size_t offset, size_t index, size_t source, size_t field);
+int ckb_load_input_by_field(void* addr, uint64_t* len, size_t offset, size_t index, size_t source, size_t field);
+int ckb_load_cell_data(void* addr, uint64_t* len, size_t offset, size_t index, size_t source);
+
+static inline int ckb_calculate_inputs_len()
+{
+    // since is loaded into a scratch word, as the simulator writes up to len bytes on every call
+    uint64_t since = 0;
+    uint64_t len = sizeof(since);
+    int count = 0;
+    while (ckb_load_input_by_field(&since, &len, 0, count, CKB_SOURCE_INPUT, CKB_INPUT_FIELD_SINCE) == CKB_SUCCESS)
+    {
+        len = sizeof(since);
+        count += 1;
+    }
+    return count;
+}
+
+#endif
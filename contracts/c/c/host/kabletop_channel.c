@@ -0,0 +1,241 @@
+#include <stdlib.h>
+#include "plugin/kabletop/plugin.c"
+#include "kabletop_channel.h"
+
+#define KABLETOP_CHANNEL_ERROR -100
+
+struct KabletopChannel
+{
+    lua_State *L;
+    int herr;
+    Kabletop kabletop;
+    secp256k1_context *secp;
+    uint8_t *args;
+    uint8_t *round;
+    uint8_t *dictionary;
+    uint8_t message[BLAKE2B_BLOCK_SIZE];
+    uint8_t signature[SIGNATURE_SIZE];
+    Seed seed;
+    uint16_t round_count;
+    // operations of a failed round may have changed lua state halfway
+    int broken;
+};
+
+int channel_error_handler(lua_State *L)
+{
+    const char *error = lua_tostring(L, -1);
+    ckb_debug(error);
+    return 0;
+}
+
+int inject_channel_lua_codes(KabletopChannel *c, const KabletopLuaCode *codes, size_t code_count)
+{
+    // same as inject_celldep_functions, but lua codes are handed over by caller
+    if (code_count != _lua_code_hashes_count(&c->kabletop))
+    {
+        return KABLETOP_WRONG_LUA_CELLDEP_CODE;
+    }
+    uint8_t data_hash[BLAKE2B_BLOCK_SIZE];
+    for (uint8_t h = 0; h < code_count; ++h)
+    {
+        blake2b_state blake2b_ctx;
+        blake2b_init(&blake2b_ctx, BLAKE2B_BLOCK_SIZE);
+        blake2b_update(&blake2b_ctx, codes[h].code, codes[h].size);
+        blake2b_final(&blake2b_ctx, data_hash, BLAKE2B_BLOCK_SIZE);
+        if (memcmp(_lua_code_hash(&c->kabletop, h), data_hash, BLAKE2B_BLOCK_SIZE) != 0)
+        {
+            return KABLETOP_WRONG_LUA_CELLDEP_CODE;
+        }
+        if (luaL_loadbufferx(c->L, (const char *)codes[h].code, codes[h].size, "celldep", KABLETOP_CHUNK_MODE)
+            || lua_pcall(c->L, 0, 0, c->herr))
+        {
+            ckb_debug("Invalid lua script: please check celldep code.");
+            return KABLETOP_WRONG_LUA_CELLDEP_CODE;
+        }
+    }
+    // caller may release codes after open, so keep a copy of the dictionary
+    if (code_count > 0)
+    {
+        c->dictionary = malloc(codes[0].size);
+        if (c->dictionary == NULL)
+        {
+            return KABLETOP_CHANNEL_ERROR;
+        }
+        memcpy(c->dictionary, codes[0].code, codes[0].size);
+        c->kabletop.dictionary = c->dictionary;
+        c->kabletop.dictionary_size = codes[0].size;
+    }
+    return CKB_SUCCESS;
+}
+
+int kabletop_channel_open(KabletopChannel **channel, const uint8_t *args, size_t args_size,
+    const uint8_t lock_hash[32], const uint8_t channel_hash[32], const KabletopLuaCode *codes, size_t code_count)
+{
+    KabletopChannel *c = calloc(1, sizeof(KabletopChannel));
+    if (c == NULL)
+    {
+        return KABLETOP_CHANNEL_ERROR;
+    }
+    *channel = c;
+    c->args = malloc(args_size);
+    c->round = malloc(MAX_ROUND_SIZE);
+    c->secp = secp256k1_context_create(SECP256K1_CONTEXT_VERIFY);
+    if (c->args == NULL || c->round == NULL || c->secp == NULL)
+    {
+        return KABLETOP_CHANNEL_ERROR;
+    }
+    memcpy(c->args, args, args_size);
+    c->kabletop.args.ptr = c->args;
+    c->kabletop.args.size = args_size;
+    if (decode_lock_args(&c->kabletop) != MOL_OK)
+    {
+        return KABLETOP_ARGS_FORMAT_ERROR;
+    }
+
+    // signature chain always starts from lock_hash, and seed of first round from channel hash
+    memcpy(c->message, lock_hash, BLAKE2B_BLOCK_SIZE);
+    memcpy(c->seed.randomseed, channel_hash, sizeof(Seed));
+
+    // prepare lua state the same way as entry.c and plugin_verify do
+    int ret = CKB_SUCCESS;
+    c->L = luaL_newstate(0, 0);
+    if (c->L == NULL)
+    {
+        return KABLETOP_CHANNEL_ERROR;
+    }
+    lua_pushcfunction(c->L, channel_error_handler);
+    c->herr = lua_gettop(c->L);
+    CHECK_RET(plugin_init(c->L, c->herr));
+    if (c->kabletop.decoded_args.user1_nft_root)
+    {
+        import_unrevealed_deck(c->L, "_user1_nfts");
+        import_unrevealed_deck(c->L, "_user2_nfts");
+    }
+    else
+    {
+        import_user_nft(&c->kabletop, c->L, _user1_nft, "_user1_nfts");
+        import_user_nft(&c->kabletop, c->L, _user2_nft, "_user2_nfts");
+    }
+    CHECK_RET(inject_channel_lua_codes(c, codes, code_count));
+    return CKB_SUCCESS;
+}
+
+int kabletop_channel_push_round(KabletopChannel *c, const uint8_t *round, size_t round_size,
+    const uint8_t signature[65])
+{
+    if (c->broken)
+    {
+        return KABLETOP_WRONG_LUA_OPERATION_CODE;
+    }
+    if (c->round_count == MAX_ROUND_COUNT)
+    {
+        return KABLETOP_EXCESSIVE_ROUNDS;
+    }
+    if (round_size > MAX_ROUND_SIZE)
+    {
+        return KABLETOP_EXCESSIVE_WITNESS_BYTES;
+    }
+
+    // expose the new round to kabletop accessors as a single round page
+    Kabletop *k = &c->kabletop;
+    memcpy(c->round, round, round_size);
+    uint16_t i = c->round_count;
+    k->rounds[0].ptr = c->round;
+    k->rounds[0].size = round_size;
+    k->signatures[0].ptr = (uint8_t *)signature;
+    k->signatures[0].size = SIGNATURE_SIZE;
+    k->round_count = i + 1;
+    k->page_begin = i;
+    k->page_size = 1;
+    if (MolReader_Round_verify(&k->rounds[0], false) != MOL_OK
+        || decode_round(&k->rounds[0], &k->decoded_rounds[0]) != MOL_OK)
+    {
+        k->round_count = i;
+        return KABLETOP_ROUND_FORMAT_ERROR;
+    }
+
+    // message of round i is hashed from message and signature of round i-1 and round i itself,
+    // the first round starts from lock_hash only
+    uint8_t message[BLAKE2B_BLOCK_SIZE];
+    blake2b_state blake2b_ctx;
+    blake2b_init(&blake2b_ctx, BLAKE2B_BLOCK_SIZE);
+    blake2b_update(&blake2b_ctx, c->message, BLAKE2B_BLOCK_SIZE);
+    if (i > 0)
+    {
+        blake2b_update(&blake2b_ctx, c->signature, SIGNATURE_SIZE);
+    }
+    blake2b_update(&blake2b_ctx, round, round_size);
+    blake2b_final(&blake2b_ctx, message, BLAKE2B_BLOCK_SIZE);
+
+    // every round is signed by the opposite user, which is affordable off-chain
+    uint8_t pubkey_hash[BLAKE2B_BLOCK_SIZE];
+    uint8_t signature_bytes[SIGNATURE_SIZE];
+    memcpy(signature_bytes, signature, SIGNATURE_SIZE);
+    int ret = get_secp256k1_pubkey_blake160_with_context(c->secp, pubkey_hash, signature_bytes, message);
+    if (ret == CKB_SUCCESS
+        && ((_user_type(k, i) == USER_1 && memcmp(pubkey_hash, _user2_pkhash(k), BLAKE160_SIZE) != 0)
+            || (_user_type(k, i) == USER_2 && memcmp(pubkey_hash, _user1_pkhash(k), BLAKE160_SIZE) != 0)))
+    {
+        ret = KABLETOP_WRONG_USER_ROUND;
+    }
+    if (ret != CKB_SUCCESS)
+    {
+        k->round_count = i;
+        return ret;
+    }
+
+    ret = run_kabletop_round(k, c->L, c->herr, i, &c->seed);
+    if (ret != CKB_SUCCESS)
+    {
+        c->broken = 1;
+        return ret;
+    }
+    memcpy(c->message, message, BLAKE2B_BLOCK_SIZE);
+    memcpy(c->signature, signature, SIGNATURE_SIZE);
+    memcpy(c->seed.randomseed, signature, sizeof(Seed));
+    c->round_count = i + 1;
+    return CKB_SUCCESS;
+}
+
+int kabletop_channel_reveal_nft(KabletopChannel *c, uint8_t user_type, uint8_t index, const uint8_t nft[20],
+    const uint8_t *proof, size_t proof_count)
+{
+    if (c->kabletop.decoded_args.user1_nft_root == NULL)
+    {
+        return KABLETOP_WRONG_NFT_REVEAL;
+    }
+    return reveal_user_nft(&c->kabletop, c->L, user_type, index, nft, proof, proof_count);
+}
+
+uint16_t kabletop_channel_round_count(KabletopChannel *c)
+{
+    return c->round_count;
+}
+
+int kabletop_channel_winner(KabletopChannel *c)
+{
+    lua_getglobal(c->L, "_winner");
+    int winner = lua_tointeger(c->L, -1);
+    lua_pop(c->L, 1);
+    return winner;
+}
+
+void kabletop_channel_close(KabletopChannel *c)
+{
+    if (c == NULL)
+    {
+        return;
+    }
+    if (c->L)
+    {
+        lua_close(c->L);
+    }
+    if (c->secp)
+    {
+        secp256k1_context_destroy(c->secp);
+    }
+    free(c->args);
+    free(c->round);
+    free(c->dictionary);
+    free(c);
+}
@@ -0,0 +1,41 @@
+#ifndef CKB_KABLETOP_CHANNEL
+#define CKB_KABLETOP_CHANNEL
+
+#include <stddef.h>
+#include <stdint.h>
+
+// incremental off-chain validator which keeps one live lua state per kabletop channel,
+// rounds are accepted one at a time so that validating a new round costs nothing more
+// as the game grows, all functions return the same error codes as the on-chain script
+
+typedef struct KabletopChannel KabletopChannel;
+
+typedef struct
+{
+    const uint8_t *code;
+    size_t size;
+} KabletopLuaCode;
+
+// "args" is the molecule Args or MerkleArgs of channel lock_script, "lock_hash" is the hash of that lock_script
+// and "channel_hash" is the output_type of the first round witness, "codes" must be given in the
+// same order as lua_code_hashes in args
+int kabletop_channel_open(KabletopChannel **channel, const uint8_t *args, size_t args_size,
+    const uint8_t lock_hash[32], const uint8_t channel_hash[32], const KabletopLuaCode *codes, size_t code_count);
+
+// check the chained signature of a molecule Round and run its operations
+int kabletop_channel_push_round(KabletopChannel *channel, const uint8_t *round, size_t round_size,
+    const uint8_t signature[65]);
+
+// reveal card "index" of the deck of USER_1 or USER_2 committed in MerkleArgs, "proof" holds
+// "proof_count" sibling hashes from leaf to root, a card must be revealed before rounds use it
+int kabletop_channel_reveal_nft(KabletopChannel *channel, uint8_t user_type, uint8_t index, const uint8_t nft[20],
+    const uint8_t *proof, size_t proof_count);
+
+uint16_t kabletop_channel_round_count(KabletopChannel *channel);
+
+// value of lua global "_winner" after the last pushed round
+int kabletop_channel_winner(KabletopChannel *channel);
+
+void kabletop_channel_close(KabletopChannel *channel);
+
+#endif
@@ -0,0 +1,75 @@
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "kabletop_host.h"
+
+#define KABLETOP_HOST_ERROR -100
+
+// "main" of entry.c which is renamed while compiling for host
+int kabletop_main();
+
+int write_tx_file(char *path, const char *tx_json)
+{
+    int fd = mkstemp(path);
+    if (fd < 0)
+    {
+        return KABLETOP_HOST_ERROR;
+    }
+    size_t size = strlen(tx_json);
+    size_t written = 0;
+    while (written < size)
+    {
+        ssize_t n = write(fd, tx_json + written, size - written);
+        if (n <= 0)
+        {
+            close(fd);
+            unlink(path);
+            return KABLETOP_HOST_ERROR;
+        }
+        written += n;
+    }
+    close(fd);
+    return 0;
+}
+
+int kabletop_verify(const char *tx_json, size_t script_index)
+{
+    char tx_path[] = "/tmp/kabletop-tx-XXXXXX";
+    if (write_tx_file(tx_path, tx_json) != 0)
+    {
+        return KABLETOP_HOST_ERROR;
+    }
+
+    // the simulator reads its transaction once per process and ckb_exit terminates the
+    // process, so every verification runs in a forked child just like a fresh CKB-VM
+    pid_t pid = fork();
+    if (pid < 0)
+    {
+        unlink(tx_path);
+        return KABLETOP_HOST_ERROR;
+    }
+    if (pid == 0)
+    {
+        char setup[256];
+        snprintf(setup, sizeof(setup),
+            "{\"is_lock_script\": true, \"is_output\": false, \"script_index\": %zu, \"native_binaries\": {}}",
+            script_index);
+        setenv("CKB_TX_FILE", tx_path, 1);
+        setenv("CKB_RUNNING_SETUP", setup, 1);
+        fflush(stdout);
+        _exit((uint8_t)kabletop_main());
+    }
+
+    int status = 0;
+    pid_t waited = waitpid(pid, &status, 0);
+    unlink(tx_path);
+    if (waited != pid || !WIFEXITED(status))
+    {
+        return KABLETOP_HOST_ERROR;
+    }
+    // exit code of script is a signed byte
+    return (int8_t)WEXITSTATUS(status);
+}
@@ -0,0 +1,11 @@
+#ifndef CKB_KABLETOP_HOST
+#define CKB_KABLETOP_HOST
+
+#include <stddef.h>
+
+// verify the kabletop lock group which the input at "script_index" belongs to, "tx_json" is
+// a mock transaction in the format of ckb-standalone-debugger, returns the same error codes
+// as the on-chain script does
+int kabletop_verify(const char *tx_json, size_t script_index);
+
+#endif
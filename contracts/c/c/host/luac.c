@@ -0,0 +1,69 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "lua.h"
+#include "lauxlib.h"
+
+// usage: kabletop-luac <source.lua> <chunk.luac>
+//
+// compiles lua source into a stripped precompiled chunk for build/kabletop-bytecode, host and
+// contract lua are built from the same sources with the same integer, number and instruction
+// sizes, so chunks dumped here are undumped by the contract as they are
+
+int write_chunk(lua_State *L, const void *p, size_t size, void *file)
+{
+    return size > 0 && fwrite(p, size, 1, (FILE *)file) != 1;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        fprintf(stderr, "usage: %s <source.lua> <chunk.luac>\n", argv[0]);
+        return 1;
+    }
+    FILE *file = fopen(argv[1], "rb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "cannot open %s\n", argv[1]);
+        return 1;
+    }
+    char *source = NULL;
+    size_t size = 0, capacity = 0, n = 0;
+    do
+    {
+        if (size == capacity)
+        {
+            capacity = capacity ? capacity * 2 : 4096;
+            source = realloc(source, capacity);
+            if (source == NULL)
+            {
+                fclose(file);
+                return 1;
+            }
+        }
+        n = fread(&source[size], 1, capacity - size, file);
+        size += n;
+    } while (n > 0);
+    fclose(file);
+
+    lua_State *L = luaL_newstate(0, 0);
+    int ret = luaL_loadbufferx(L, source, size, argv[1], "t");
+    free(source);
+    if (ret != LUA_OK)
+    {
+        fprintf(stderr, "%s\n", lua_tostring(L, -1));
+        lua_close(L);
+        return 1;
+    }
+    file = fopen(argv[2], "wb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "cannot open %s\n", argv[2]);
+        lua_close(L);
+        return 1;
+    }
+    ret = lua_dump(L, write_chunk, file, 1);
+    ret = fclose(file) || ret;
+    lua_close(L);
+    return ret == 0 ? 0 : 1;
+}
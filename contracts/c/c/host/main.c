@@ -0,0 +1,37 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "kabletop_host.h"
+
+// usage: kabletop-host <mock_tx.json> [script_index]
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: %s <mock_tx.json> [script_index]\n", argv[0]);
+        return 1;
+    }
+    FILE *file = fopen(argv[1], "rb");
+    if (file == NULL)
+    {
+        fprintf(stderr, "cannot open %s\n", argv[1]);
+        return 1;
+    }
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    char *tx_json = malloc(size + 1);
+    if (tx_json == NULL || fread(tx_json, 1, size, file) != (size_t)size)
+    {
+        fprintf(stderr, "cannot read %s\n", argv[1]);
+        fclose(file);
+        return 1;
+    }
+    tx_json[size] = '\0';
+    fclose(file);
+
+    size_t script_index = argc > 2 ? strtoul(argv[2], NULL, 10) : 0;
+    int ret = kabletop_verify(tx_json, script_index);
+    printf("%s: %d\n", argv[1], ret);
+    free(tx_json);
+    return ret == 0 ? 0 : 1;
+}
@@ -0,0 +1,33 @@
+/*
+** Replaces lexer, parser, code generator and dumper of liblua.a for bytecode-only
+** deployments, link it before liblua.a so that those objects are never pulled in.
+** Loading a source chunk raises an error, precompiled chunks go through the undumper.
+*/
+#define LUA_CORE
+
+#include "lprefix.h"
+#include "lua.h"
+#include "ldo.h"
+#include "llex.h"
+#include "lparser.h"
+#include "lundump.h"
+#include "lzio.h"
+
+void luaX_init (lua_State *L) {
+  UNUSED(L);
+}
+
+LClosure *luaY_parser (lua_State *L, ZIO *z, Mbuffer *buff, Dyndata *dyd,
+                       const char *name, int firstchar) {
+  UNUSED(z); UNUSED(buff); UNUSED(dyd); UNUSED(name); UNUSED(firstchar);
+  lua_pushliteral(L, "parser not loaded");
+  lua_error(L);
+  return NULL;
+}
+
+int luaU_dump (lua_State *L, const Proto *f, lua_Writer w, void *data, int strip) {
+  UNUSED(f); UNUSED(w); UNUSED(data); UNUSED(strip);
+  lua_pushliteral(L, "dumper not loaded");
+  lua_error(L);
+  return 0;
+}
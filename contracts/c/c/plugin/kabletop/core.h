@@ -1,4 +1,3 @@
-
 #ifndef CKB_LUA_KABLETOP_CORE
 #define CKB_LUA_KABLETOP_CORE
 
@@ -11,10 +10,47 @@
 #define MAX_LUACODE_SIZE 32768
 #define MAX_ROUND_SIZE 2048
 #define MAX_CHALLENGE_DATA_SIZE 2048
-#define MAX_OPERATIONS_PER_ROUND 64
+#define MAX_OPERATION_SIZE 4096
 #define MAX_NFT_DATA_SIZE (BLAKE160_SIZE * 256)
+// Bytes of a RoundLayout in input_type of a group witness
+#define MAX_ROUND_LAYOUT_SIZE 64
+// nft reveals share the group witness with its signature, which sighash allows to grow up to MAX_WITNESS_SIZE,
+// they are read into the round page buffer before rounds are, see plugin_verify
+#define MAX_REVEALS_SIZE MAX_WITNESS_SIZE
+// domain separation of merkle tree over a committed deck
+#define NFT_MERKLE_LEAF 0x00
+#define NFT_MERKLE_NODE 0x01
 #define TO_CAPACITY(x) (x * 100000000lu)
 
+// lock script prefix: table header | code_hash | hash_type | args length | first 20 args bytes
+#define LOCK_CODE_HASH_OFFSET (MOL_NUM_T_SIZE * 4)
+#define LOCK_ARGS_OFFSET (LOCK_CODE_HASH_OFFSET + BLAKE2B_BLOCK_SIZE + 1)
+#define LOCK_PREFIX_SIZE (LOCK_ARGS_OFFSET + MOL_NUM_T_SIZE + BLAKE160_SIZE)
+
+// nft cells are told apart by a digest of capacity, lock, type and data followed by a reference
+// to the cell: index | NFT_CELL_INPUT | NFT_CELL_USER2
+#define NFT_CELL_DIGEST_SIZE 8
+#define NFT_CELL_SIZE (NFT_CELL_DIGEST_SIZE + 4)
+#define NFT_CELL_INPUT 0x80000000u
+#define NFT_CELL_USER2 0x40000000u
+#define MAX_NFT_CELL_COUNT 512
+
+// leading bytes of compressed and call operations, lua source never starts with them
+#define OPERATION_COMPRESSED 0x00
+#define OPERATION_CALL 0x01
+
+// bytecode-only deployments link without lua parser, so source chunks are rejected by loader
+#ifdef KABLETOP_BYTECODE_ONLY
+#define KABLETOP_CHUNK_MODE "b"
+#else
+#define KABLETOP_CHUNK_MODE NULL
+#endif
+
+// kinds of molecule Argument in a call operation
+#define ARGUMENT_INTEGER 0
+#define ARGUMENT_STRING 1
+#define ARGUMENT_BOOLEAN 2
+
 enum
 {
     KABLETOP_SCRIPT_ERROR = 4,
@@ -32,7 +68,12 @@ enum
     KABLETOP_WRONG_LUA_CELLDEP_CODE,
     KABLETOP_WRONG_LUA_OPERATION_CODE,
     KABLETOP_WRONG_BATTLE_RESULT,
-    KABLETOP_WRONG_SINCE
+    KABLETOP_WRONG_SINCE,
+    KABLETOP_EXCESSIVE_OUTPUTS,
+    KABLETOP_WRONG_ROUND_LAYOUT,
+    KABLETOP_WRONG_OPERATION_ENCODING,
+    KABLETOP_WRONG_USER_DECK,
+    KABLETOP_WRONG_NFT_REVEAL
 };
 
 typedef enum
@@ -42,41 +83,114 @@ typedef enum
     MODE_UNKNOWN
 } MODE;
 
-MODE check_mode(Kabletop *kabletop, uint8_t challenge_data[2][MAX_CHALLENGE_DATA_SIZE])
+int load_lock_owner(OutputCell *cell, size_t i, size_t source)
 {
+    // lock scripts are loaded partially so that only the code_hash and leading args bytes are copied
+    uint8_t lock_prefix[LOCK_PREFIX_SIZE];
+    uint64_t len = LOCK_PREFIX_SIZE;
+    int ret = ckb_load_cell_by_field(lock_prefix, &len, 0, i, source, CKB_CELL_FIELD_LOCK);
+    if (ret != CKB_SUCCESS)
+    {
+        return ret;
+    }
+    if (len < LOCK_ARGS_OFFSET + MOL_NUM_T_SIZE
+        || mol_unpack_number(&lock_prefix[MOL_NUM_T_SIZE]) != LOCK_CODE_HASH_OFFSET
+        || mol_unpack_number(&lock_prefix[MOL_NUM_T_SIZE * 3]) != LOCK_ARGS_OFFSET)
+    {
+        return ERROR_ENCODING;
+    }
+    memcpy(cell->lock_code_hash, &lock_prefix[LOCK_CODE_HASH_OFFSET], BLAKE2B_BLOCK_SIZE);
+    cell->lock_args_size = mol_unpack_number(&lock_prefix[LOCK_ARGS_OFFSET]);
+    memcpy(cell->lock_args, &lock_prefix[LOCK_ARGS_OFFSET + MOL_NUM_T_SIZE],
+        cell->lock_args_size < BLAKE160_SIZE ? cell->lock_args_size : BLAKE160_SIZE);
+    return CKB_SUCCESS;
+}
+
+int output_owned_by(OutputCell *cell, const uint8_t *code_hash, const uint8_t *pkhash)
+{
+    return cell->lock_args_size >= BLAKE160_SIZE
+        && memcmp(cell->lock_code_hash, code_hash, BLAKE2B_BLOCK_SIZE) == 0
+        && memcmp(cell->lock_args, pkhash, BLAKE160_SIZE) == 0;
+}
+
+OutputCell * find_output(Kabletop *kabletop, size_t index)
+{
+    for (uint8_t i = 0; i < kabletop->output_count; ++i)
+    {
+        if (kabletop->outputs[i].index == index)
+        {
+            return &kabletop->outputs[i];
+        }
+    }
+    return NULL;
+}
+
+int index_outputs(Kabletop *kabletop)
+{
+    // walk outputs only once and keep the ones that mode checks look at, which are locked by this
+    // channel or owned by one of its users, so that unrelated outputs never count against the cap
+    int ret = CKB_SUCCESS;
     uint8_t expect_lock_hash[BLAKE2B_BLOCK_SIZE];
     uint64_t len = BLAKE2B_BLOCK_SIZE;
-    ckb_load_cell_by_field(expect_lock_hash, &len, 0, 0, CKB_SOURCE_GROUP_INPUT, CKB_CELL_FIELD_LOCK_HASH);
-
-    // search outputs by input's lock_hash
-    uint8_t lock_hash[BLAKE2B_BLOCK_SIZE];
-    uint8_t find = 0;
+    CHECK_RET(ckb_load_cell_by_field(expect_lock_hash, &len, 0, 0, CKB_SOURCE_GROUP_INPUT, CKB_CELL_FIELD_LOCK_HASH));
+    kabletop->output_count = 0;
     for (size_t i = 0; 1; ++i)
     {
-        int ret = ckb_load_cell_by_field(lock_hash, &len, 0, i, CKB_SOURCE_OUTPUT, CKB_CELL_FIELD_LOCK_HASH);
+        OutputCell cell;
+        len = BLAKE2B_BLOCK_SIZE;
+        ret = ckb_load_cell_by_field(cell.lock_hash, &len, 0, i, CKB_SOURCE_OUTPUT, CKB_CELL_FIELD_LOCK_HASH);
         if (ret == CKB_INDEX_OUT_OF_BOUND)
         {
             break;
         }
         if (ret != CKB_SUCCESS)
         {
-            return MODE_UNKNOWN;
+            return ERROR_ENCODING;
         }
-        if (memcmp(lock_hash, expect_lock_hash, BLAKE2B_BLOCK_SIZE) == 0)
+        CHECK_RET(load_lock_owner(&cell, i, CKB_SOURCE_OUTPUT));
+        if (memcmp(cell.lock_hash, expect_lock_hash, BLAKE2B_BLOCK_SIZE) != 0
+            && ! output_owned_by(&cell, _lock_code_hash(kabletop), _user1_pkhash(kabletop))
+            && ! output_owned_by(&cell, _lock_code_hash(kabletop), _user2_pkhash(kabletop)))
+        {
+            continue;
+        }
+        if (kabletop->output_count == MAX_OUTPUT_COUNT)
+        {
+            return KABLETOP_EXCESSIVE_OUTPUTS;
+        }
+        len = sizeof(uint64_t);
+        CHECK_RET(ckb_load_cell_by_field(&cell.capacity, &len, 0, i, CKB_SOURCE_OUTPUT, CKB_CELL_FIELD_CAPACITY));
+        cell.index = i;
+        kabletop->outputs[kabletop->output_count++] = cell;
+    }
+    return CKB_SUCCESS;
+}
+
+MODE check_mode(Kabletop *kabletop, uint8_t challenge_data[2][MAX_CHALLENGE_DATA_SIZE])
+{
+    uint8_t expect_lock_hash[BLAKE2B_BLOCK_SIZE];
+    uint64_t len = BLAKE2B_BLOCK_SIZE;
+    ckb_load_cell_by_field(expect_lock_hash, &len, 0, 0, CKB_SOURCE_GROUP_INPUT, CKB_CELL_FIELD_LOCK_HASH);
+
+    // search indexed outputs by input's lock_hash
+    uint8_t find = 0;
+    for (uint8_t i = 0; i < kabletop->output_count; ++i)
+    {
+        if (memcmp(kabletop->outputs[i].lock_hash, expect_lock_hash, BLAKE2B_BLOCK_SIZE) == 0)
         {
             if (find == 1)
             {
                 return MODE_UNKNOWN;
             }
             len = MAX_CHALLENGE_DATA_SIZE;
-            ckb_load_cell_data(challenge_data[1], &len, 0, i, CKB_SOURCE_OUTPUT);
+            ckb_load_cell_data(challenge_data[1], &len, 0, kabletop->outputs[i].index, CKB_SOURCE_OUTPUT);
             if (len > MAX_CHALLENGE_DATA_SIZE)
             {
                 return MODE_UNKNOWN;
             }
             kabletop->output_challenge.ptr = challenge_data[1];
             kabletop->output_challenge.size = len;
-            if (MolReader_Challenge_verify(&kabletop->output_challenge, false) != MOL_OK)
+            if (decode_challenge(&kabletop->output_challenge, &kabletop->decoded_output_challenge) != MOL_OK)
             {
                 return MODE_UNKNOWN;
             }
@@ -91,6 +205,10 @@ MODE check_mode(Kabletop *kabletop, uint8_t challenge_data[2][MAX_CHALLENGE_DATA
     {
         kabletop->input_challenge.ptr = challenge_data[0];
         kabletop->input_challenge.size = len;
+        if (decode_challenge(&kabletop->input_challenge, &kabletop->decoded_input_challenge) != MOL_OK)
+        {
+            return MODE_UNKNOWN;
+        }
     }
     if (find == 1)
     {
@@ -210,22 +328,700 @@ int verify_lock_args(Kabletop *kabletop, uint8_t script[MAX_SCRIPT_SIZE])
     }
     mol_seg_t args_seg = MolReader_Script_get_args(&script_seg);
     kabletop->args = MolReader_Bytes_raw_bytes(&args_seg);
-    if (MolReader_Args_verify(&kabletop->args, false) != MOL_OK)
+    if (decode_lock_args(kabletop) != MOL_OK)
     {
         return KABLETOP_ARGS_FORMAT_ERROR;
     }
-    // CAUTION: there should be some examination to ensure both users' nft count must
-    // be equal to _user_deck_size(kabletop), but this script is filled in lock_script
-    // and will not run while creating the kabletop-cell, so the examination should be
+    // CAUTION: this script is filled in lock_script and will not run while creating the
+    // kabletop-cell, so both users' decks are only examined here if the channel lists
+    // nft_type_hashes in NftArgs, see verify_user_decks, otherwise the examination should be
     // implemented off-chain, especially by two of kabletop game clients
     return CKB_SUCCESS;
 }
 
-int verify_witnesses(Kabletop *kabletop, uint8_t witnesses[MAX_ROUND_COUNT][MAX_ROUND_SIZE])
+int compare_nft(const uint8_t *a, const uint8_t *b)
+{
+    return memcmp(a, b, BLAKE160_SIZE);
+}
+
+void swap_items(uint8_t *a, uint8_t *b, size_t size)
+{
+    for (size_t i = 0; i < size; ++i)
+    {
+        uint8_t byte = a[i];
+        a[i] = b[i];
+        b[i] = byte;
+    }
+}
+
+void sift_items(uint8_t *items, size_t root, size_t count, size_t size)
+{
+    while (root * 2 + 1 < count)
+    {
+        size_t child = root * 2 + 1;
+        if (child + 1 < count && memcmp(&items[child * size], &items[(child + 1) * size], size) < 0)
+        {
+            child += 1;
+        }
+        if (memcmp(&items[root * size], &items[child * size], size) >= 0)
+        {
+            return;
+        }
+        swap_items(&items[root * size], &items[child * size], size);
+        root = child;
+    }
+}
+
+void sort_items(uint8_t *items, size_t count, size_t size)
+{
+    // in-place heap sort of byte strings, no recursion and no extra buffer on a stack already
+    // holding large arrays
+    for (size_t i = count / 2; i > 0; --i)
+    {
+        sift_items(items, i - 1, count, size);
+    }
+    for (size_t end = count; end > 1; --end)
+    {
+        swap_items(items, &items[(end - 1) * size], size);
+        sift_items(items, 0, end - 1, size);
+    }
+}
+
+void sort_nfts(uint8_t *nfts, size_t count)
+{
+    sort_items(nfts, count, BLAKE160_SIZE);
+}
+
+typedef struct
+{
+    uint8_t deck[MAX_NFT_DATA_SIZE];
+    uint8_t matched[256];
+    uint8_t owned[MAX_NFT_DATA_SIZE];
+    size_t owned_size;
+} UserDeck;
+
+void match_owned_nfts(UserDeck *user, size_t deck_count)
+{
+    // owned nfts are gathered until the buffer is full, then sorted and merged with the sorted
+    // deck at once, every owned nft consumes at most one unmatched card of the same hash
+    size_t owned_count = user->owned_size / BLAKE160_SIZE;
+    sort_nfts(user->owned, owned_count);
+    size_t d = 0, o = 0;
+    while (d < deck_count && o < owned_count)
+    {
+        int order = compare_nft(&user->deck[d * BLAKE160_SIZE], &user->owned[o * BLAKE160_SIZE]);
+        if (order < 0 || (order == 0 && user->matched[d]))
+        {
+            d += 1;
+        }
+        else if (order > 0)
+        {
+            o += 1;
+        }
+        else
+        {
+            user->matched[d] = 1;
+            d += 1;
+            o += 1;
+        }
+    }
+    user->owned_size = 0;
+}
+
+int gather_owned_nfts(UserDeck *user, size_t deck_count, size_t i, size_t source)
+{
+    // cell data is read straight into the free part of the buffer, so a cell may hold any number
+    // of nfts and is matched buffer by buffer
+    int ret = CKB_SUCCESS;
+    uint64_t offset = 0;
+    while (1)
+    {
+        uint64_t room = MAX_NFT_DATA_SIZE - user->owned_size;
+        uint64_t len = room;
+        CHECK_RET(ckb_load_cell_data(&user->owned[user->owned_size], &len, offset, i, source));
+        if (offset == 0 && len % BLAKE160_SIZE != 0)
+        {
+            return KABLETOP_WRONG_USER_DECK;
+        }
+        uint64_t loaded = len < room ? len : room;
+        user->owned_size += loaded;
+        offset += loaded;
+        if (user->owned_size == MAX_NFT_DATA_SIZE)
+        {
+            match_owned_nfts(user, deck_count);
+        }
+        if (loaded == len)
+        {
+            return CKB_SUCCESS;
+        }
+    }
+}
+
+int load_nft_cell(uint8_t nft_cell[NFT_CELL_SIZE], size_t i, size_t source, uint8_t u)
+{
+    // no syscall reads the out point of a cell dep, which a dep group only lists in data of its own
+    // cell, so cells are told apart by capacity, lock, type and data instead, cells alike in all of
+    // them and colliding digests only leave nfts uncounted
+    const size_t fields[3] = {CKB_CELL_FIELD_LOCK_HASH, CKB_CELL_FIELD_TYPE_HASH, CKB_CELL_FIELD_DATA_HASH};
+    blake2b_state blake2b_ctx;
+    blake2b_init(&blake2b_ctx, NFT_CELL_DIGEST_SIZE);
+    uint64_t capacity = 0;
+    uint64_t len = sizeof(capacity);
+    if (ckb_load_cell_by_field(&capacity, &len, 0, i, source, CKB_CELL_FIELD_CAPACITY) != CKB_SUCCESS || len != sizeof(capacity))
+    {
+        return KABLETOP_WRONG_USER_DECK;
+    }
+    blake2b_update(&blake2b_ctx, &capacity, sizeof(capacity));
+    for (uint8_t f = 0; f < 3; ++f)
+    {
+        uint8_t hash[BLAKE2B_BLOCK_SIZE];
+        len = BLAKE2B_BLOCK_SIZE;
+        if (ckb_load_cell_by_field(hash, &len, 0, i, source, fields[f]) != CKB_SUCCESS || len != BLAKE2B_BLOCK_SIZE)
+        {
+            return KABLETOP_WRONG_USER_DECK;
+        }
+        blake2b_update(&blake2b_ctx, hash, BLAKE2B_BLOCK_SIZE);
+    }
+    blake2b_final(&blake2b_ctx, nft_cell, NFT_CELL_DIGEST_SIZE);
+    uint32_t reference = (uint32_t)i;
+    if (source == CKB_SOURCE_INPUT)
+    {
+        reference |= NFT_CELL_INPUT;
+    }
+    if (u == 1)
+    {
+        reference |= NFT_CELL_USER2;
+    }
+    memcpy(&nft_cell[NFT_CELL_DIGEST_SIZE], &reference, sizeof(reference));
+    return CKB_SUCCESS;
+}
+
+int has_nft_type(Kabletop *kabletop, size_t i, size_t source)
+{
+    uint8_t type_hash[BLAKE2B_BLOCK_SIZE];
+    uint64_t len = BLAKE2B_BLOCK_SIZE;
+    if (ckb_load_cell_by_field(type_hash, &len, 0, i, source, CKB_CELL_FIELD_TYPE_HASH) != CKB_SUCCESS)
+    {
+        return 0;
+    }
+    for (uint8_t h = 0; h < kabletop->decoded_args.nft_type_hashes_count; ++h)
+    {
+        if (memcmp(&kabletop->decoded_args.nft_type_hashes[h * BLAKE2B_BLOCK_SIZE], type_hash, BLAKE2B_BLOCK_SIZE) == 0)
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+void hash_nft_node(uint8_t hash[BLAKE2B_BLOCK_SIZE], const uint8_t *left, const uint8_t *right)
+{
+    uint8_t prefix = NFT_MERKLE_NODE;
+    blake2b_state blake2b_ctx;
+    blake2b_init(&blake2b_ctx, BLAKE2B_BLOCK_SIZE);
+    blake2b_update(&blake2b_ctx, &prefix, 1);
+    blake2b_update(&blake2b_ctx, left, BLAKE2B_BLOCK_SIZE);
+    blake2b_update(&blake2b_ctx, right, BLAKE2B_BLOCK_SIZE);
+    blake2b_final(&blake2b_ctx, hash, BLAKE2B_BLOCK_SIZE);
+}
+
+int verify_nft_proof(const uint8_t *root, uint8_t count, uint8_t index, const uint8_t *nft,
+    const uint8_t *proof, size_t proof_count)
+{
+    // leaves are paired level by level and an odd last node is carried up unchanged, so the
+    // proof holds one sibling for every level where the node has one
+    if (index >= count)
+    {
+        return KABLETOP_WRONG_NFT_REVEAL;
+    }
+    uint8_t hash[BLAKE2B_BLOCK_SIZE];
+    uint8_t prefix = NFT_MERKLE_LEAF;
+    blake2b_state blake2b_ctx;
+    blake2b_init(&blake2b_ctx, BLAKE2B_BLOCK_SIZE);
+    blake2b_update(&blake2b_ctx, &prefix, 1);
+    blake2b_update(&blake2b_ctx, nft, BLAKE160_SIZE);
+    blake2b_final(&blake2b_ctx, hash, BLAKE2B_BLOCK_SIZE);
+    size_t p = 0;
+    for (size_t i = index, n = count; n > 1; i /= 2, n = (n + 1) / 2)
+    {
+        if (i % 2 == 0 && i + 1 == n)
+        {
+            continue;
+        }
+        if (p == proof_count)
+        {
+            return KABLETOP_WRONG_NFT_REVEAL;
+        }
+        const uint8_t *sibling = &proof[p++ * BLAKE2B_BLOCK_SIZE];
+        if (i % 2 == 0)
+        {
+            hash_nft_node(hash, hash, sibling);
+        }
+        else
+        {
+            hash_nft_node(hash, sibling, hash);
+        }
+    }
+    if (p != proof_count || memcmp(hash, root, BLAKE2B_BLOCK_SIZE) != 0)
+    {
+        return KABLETOP_WRONG_NFT_REVEAL;
+    }
+    return CKB_SUCCESS;
+}
+
+int verify_user_decks(Kabletop *kabletop)
+{
+    // decks are proved against nft cells in cell_deps and inputs, which are cells typed by one of
+    // nft_type_hashes, owned by lock_code_hash and a user's pkhash, and hold blake160s in any order
+    if (kabletop->decoded_args.nft_type_hashes_count == 0)
+    {
+        return CKB_SUCCESS;
+    }
+    uint8_t deck_size = _user_deck_size(kabletop);
+    if (kabletop->decoded_args.user1_nfts_count != deck_size
+        || kabletop->decoded_args.user2_nfts_count != deck_size)
+    {
+        return KABLETOP_WRONG_USER_DECK;
+    }
+
+    // nft cells of both users are collected once and sorted by digest, so a cell given as cell dep,
+    // through a dep group or as input as well is counted by the first of its equal run only
+    int ret = CKB_SUCCESS;
+    uint8_t nft_cells[MAX_NFT_CELL_COUNT * NFT_CELL_SIZE];
+    size_t nft_cell_count = 0;
+    const size_t sources[2] = {CKB_SOURCE_CELL_DEP, CKB_SOURCE_INPUT};
+    for (uint8_t s = 0; s < 2; ++s)
+    {
+        for (size_t i = 0; 1; ++i)
+        {
+            OutputCell owner;
+            ret = load_lock_owner(&owner, i, sources[s]);
+            if (ret == CKB_INDEX_OUT_OF_BOUND)
+            {
+                break;
+            }
+            if (ret != CKB_SUCCESS || ! has_nft_type(kabletop, i, sources[s]))
+            {
+                continue;
+            }
+            uint8_t u;
+            if (output_owned_by(&owner, _lock_code_hash(kabletop), _user1_pkhash(kabletop)))
+            {
+                u = 0;
+            }
+            else if (output_owned_by(&owner, _lock_code_hash(kabletop), _user2_pkhash(kabletop)))
+            {
+                u = 1;
+            }
+            else
+            {
+                continue;
+            }
+            if (nft_cell_count == MAX_NFT_CELL_COUNT)
+            {
+                return KABLETOP_WRONG_USER_DECK;
+            }
+            CHECK_RET(load_nft_cell(&nft_cells[nft_cell_count * NFT_CELL_SIZE], i, sources[s], u));
+            nft_cell_count += 1;
+        }
+    }
+    sort_items(nft_cells, nft_cell_count, NFT_CELL_SIZE);
+
+    UserDeck users[2];
+    memcpy(users[0].deck, kabletop->decoded_args.user1_nfts, deck_size * BLAKE160_SIZE);
+    memcpy(users[1].deck, kabletop->decoded_args.user2_nfts, deck_size * BLAKE160_SIZE);
+    for (uint8_t u = 0; u < 2; ++u)
+    {
+        sort_nfts(users[u].deck, deck_size);
+        memset(users[u].matched, 0, sizeof(users[u].matched));
+        users[u].owned_size = 0;
+    }
+    for (size_t c = 0; c < nft_cell_count; ++c)
+    {
+        const uint8_t *nft_cell = &nft_cells[c * NFT_CELL_SIZE];
+        if (c > 0 && memcmp(nft_cell - NFT_CELL_SIZE, nft_cell, NFT_CELL_DIGEST_SIZE) == 0)
+        {
+            continue;
+        }
+        uint32_t reference;
+        memcpy(&reference, &nft_cell[NFT_CELL_DIGEST_SIZE], sizeof(reference));
+        size_t source = (reference & NFT_CELL_INPUT) ? CKB_SOURCE_INPUT : CKB_SOURCE_CELL_DEP;
+        UserDeck *user = &users[(reference & NFT_CELL_USER2) ? 1 : 0];
+        size_t i = reference & ~(NFT_CELL_INPUT | NFT_CELL_USER2);
+        CHECK_RET(gather_owned_nfts(user, deck_size, i, source));
+    }
+    for (uint8_t u = 0; u < 2; ++u)
+    {
+        match_owned_nfts(&users[u], deck_size);
+        for (uint8_t i = 0; i < deck_size; ++i)
+        {
+            if (! users[u].matched[i])
+            {
+                return KABLETOP_WRONG_USER_DECK;
+            }
+        }
+    }
+    return CKB_SUCCESS;
+}
+
+int decode_round_layout(mol_seg_t *layout, uint16_t *offset, uint16_t *count, uint16_t user_outputs[2])
+{
+    if (MolReader_RoundLayout_verify(layout, false) != MOL_OK)
+    {
+        return KABLETOP_WRONG_ROUND_LAYOUT;
+    }
+    *offset = *(uint16_t *)MolReader_RoundLayout_get_offset(layout).ptr;
+    *count = *(uint16_t *)MolReader_RoundLayout_get_count(layout).ptr;
+    user_outputs[0] = *(uint16_t *)MolReader_RoundLayout_get_user1_output(layout).ptr;
+    user_outputs[1] = *(uint16_t *)MolReader_RoundLayout_get_user2_output(layout).ptr;
+    if (*count == 0 || user_outputs[0] == user_outputs[1])
+    {
+        return KABLETOP_WRONG_ROUND_LAYOUT;
+    }
+    return CKB_SUCCESS;
+}
+
+int load_round_layout(Kabletop *kabletop, uint8_t witness[MAX_WITNESS_SIZE], size_t *begin, size_t *end)
+{
+    // rounds start from the first witness not covered by inputs and run to the last one,
+    // unless a batched transaction which settles many channels places a RoundLayout into
+    // input_type of the group witness to point out where this channel's rounds and payouts are
+    *begin = ckb_calculate_inputs_len();
+    *end = SIZE_MAX;
+    kabletop->batched = 0;
+    uint64_t len = MAX_WITNESS_SIZE;
+    int ret = ckb_load_witness(witness, &len, 0, 0, CKB_SOURCE_GROUP_INPUT);
+    if (ret != CKB_SUCCESS || len > MAX_WITNESS_SIZE)
+    {
+        return ERROR_WITNESS_SIZE;
+    }
+    mol_seg_t layout;
+    if (extract_witness_input_type(witness, len, &layout) != CKB_SUCCESS)
+    {
+        return CKB_SUCCESS;
+    }
+    uint16_t offset, count;
+    CHECK_RET(decode_round_layout(&layout, &offset, &count, kabletop->user_outputs));
+    kabletop->batched = 1;
+    *begin += offset;
+    *end = *begin + count;
+    return CKB_SUCCESS;
+}
+
+int load_input_round_layout(size_t i, uint16_t user_outputs[2])
+{
+    // only the header and input_type of another channel's group witness are loaded, an empty or
+    // missing witness belongs to an input which is not the first one of its group
+    uint32_t header[4];
+    uint64_t len = sizeof(header);
+    int ret = ckb_load_witness(header, &len, 0, i, CKB_SOURCE_INPUT);
+    if (ret == CKB_INDEX_OUT_OF_BOUND || (ret == CKB_SUCCESS && len == 0))
+    {
+        return CKB_ITEM_MISSING;
+    }
+    if (ret != CKB_SUCCESS || len < sizeof(header) || header[0] != len || header[1] != sizeof(header)
+        || header[2] + MOL_NUM_T_SIZE > header[3] || header[3] - header[2] > MAX_ROUND_LAYOUT_SIZE)
+    {
+        return KABLETOP_WRONG_ROUND_LAYOUT;
+    }
+    uint8_t layout_bytes[MAX_ROUND_LAYOUT_SIZE];
+    uint32_t size = header[3] - header[2];
+    len = size;
+    ret = ckb_load_witness(layout_bytes, &len, header[2], i, CKB_SOURCE_INPUT);
+    if (ret != CKB_SUCCESS || len < size || *(uint32_t *)layout_bytes != size - MOL_NUM_T_SIZE)
+    {
+        return KABLETOP_WRONG_ROUND_LAYOUT;
+    }
+    mol_seg_t layout = {
+        .ptr = &layout_bytes[MOL_NUM_T_SIZE],
+        .size = size - MOL_NUM_T_SIZE
+    };
+    uint16_t offset, count;
+    return decode_round_layout(&layout, &offset, &count, user_outputs);
+}
+
+int verify_batch_layouts(Kabletop *kabletop)
+{
+    // other channels of this lock in the same transaction must be batched as well and claim payouts
+    // apart from ours, or two channels sharing a user could both be paid by one output
+    int ret = CKB_SUCCESS;
+    OutputCell self;
+    uint64_t len = BLAKE2B_BLOCK_SIZE;
+    CHECK_RET(ckb_load_cell_by_field(self.lock_hash, &len, 0, 0, CKB_SOURCE_GROUP_INPUT, CKB_CELL_FIELD_LOCK_HASH));
+    CHECK_RET(load_lock_owner(&self, 0, CKB_SOURCE_GROUP_INPUT));
+    for (size_t i = 0; 1; ++i)
+    {
+        OutputCell other;
+        ret = load_lock_owner(&other, i, CKB_SOURCE_INPUT);
+        if (ret == CKB_INDEX_OUT_OF_BOUND)
+        {
+            break;
+        }
+        if (ret != CKB_SUCCESS || memcmp(other.lock_code_hash, self.lock_code_hash, BLAKE2B_BLOCK_SIZE) != 0)
+        {
+            continue;
+        }
+        len = BLAKE2B_BLOCK_SIZE;
+        CHECK_RET(ckb_load_cell_by_field(other.lock_hash, &len, 0, i, CKB_SOURCE_INPUT, CKB_CELL_FIELD_LOCK_HASH));
+        if (memcmp(other.lock_hash, self.lock_hash, BLAKE2B_BLOCK_SIZE) == 0)
+        {
+            continue;
+        }
+        if (! kabletop->batched)
+        {
+            return KABLETOP_WRONG_ROUND_LAYOUT;
+        }
+        uint16_t user_outputs[2];
+        ret = load_input_round_layout(i, user_outputs);
+        if (ret == CKB_ITEM_MISSING)
+        {
+            continue;
+        }
+        if (ret != CKB_SUCCESS)
+        {
+            return ret;
+        }
+        for (uint8_t u = 0; u < 2; ++u)
+        {
+            if (user_outputs[u] == kabletop->user_outputs[0] || user_outputs[u] == kabletop->user_outputs[1])
+            {
+                return KABLETOP_WRONG_ROUND_LAYOUT;
+            }
+        }
+    }
+    return CKB_SUCCESS;
+}
+
+int load_witness_range(uint8_t *buffer, uint64_t size, size_t offset, size_t index)
+{
+    uint64_t len = size;
+    int ret = ckb_load_witness(buffer, &len, offset, index, CKB_SOURCE_INPUT);
+    if (ret != CKB_SUCCESS || len < size)
+    {
+        return KABLETOP_ROUND_FORMAT_ERROR;
+    }
+    return CKB_SUCCESS;
+}
+
+int is_packed_witness(const uint8_t *witness, uint64_t len)
+{
+    // round witnesses always sign in lock of WitnessArgs, a packed witness leaves it empty
+    uint32_t header[4];
+    if (len < sizeof(header))
+    {
+        return 0;
+    }
+    memcpy(header, witness, sizeof(header));
+    return header[1] == header[2];
+}
+
+int open_packed_rounds(Kabletop *kabletop, size_t index, const uint8_t *witness, uint64_t len)
+{
+    // only headers of WitnessArgs and SignedRounds are read here, rounds are streamed page by
+    // page later on, so the packed witness is not bounded by any buffer
+    int ret = CKB_SUCCESS;
+    uint32_t header[4];
+    memcpy(header, witness, sizeof(header));
+    uint32_t input_type = header[2];
+    uint32_t output_type = header[3];
+    if (header[0] != len || header[1] != sizeof(header)
+        || input_type + MOL_NUM_T_SIZE > output_type || output_type + MOL_NUM_T_SIZE > len)
+    {
+        return KABLETOP_ROUND_FORMAT_ERROR;
+    }
+    // input_type is Bytes of SignedRounds, whose first offset tells the round count
+    uint32_t rounds[3];
+    CHECK_RET(load_witness_range((uint8_t *)rounds, sizeof(rounds), input_type, index));
+    if (rounds[0] != output_type - input_type - MOL_NUM_T_SIZE || rounds[1] != rounds[0]
+        || rounds[1] < MOL_NUM_T_SIZE * 2 || rounds[2] % MOL_NUM_T_SIZE != 0
+        || rounds[2] < MOL_NUM_T_SIZE * 2 || rounds[2] > rounds[1])
+    {
+        return KABLETOP_ROUND_FORMAT_ERROR;
+    }
+    if (rounds[2] / MOL_NUM_T_SIZE - 1 > MAX_ROUND_COUNT)
+    {
+        return KABLETOP_EXCESSIVE_ROUNDS;
+    }
+    // output_type carries channel hash as it does in the first one of separate round witnesses
+    uint8_t channel_hash[MOL_NUM_T_SIZE + sizeof(Seed)];
+    CHECK_RET(load_witness_range(channel_hash, sizeof(channel_hash), output_type, index));
+    if (*(uint32_t *)channel_hash != len - output_type - MOL_NUM_T_SIZE
+        || *(uint32_t *)channel_hash < sizeof(Seed))
+    {
+        return KABLETOP_ROUND_FORMAT_ERROR;
+    }
+    memcpy(kabletop->channel_seed.randomseed, &channel_hash[MOL_NUM_T_SIZE], sizeof(Seed));
+    kabletop->packed = 1;
+    kabletop->packed_begin = input_type + MOL_NUM_T_SIZE;
+    kabletop->packed_size = rounds[1];
+    kabletop->round_count = rounds[2] / MOL_NUM_T_SIZE - 1;
+    return CKB_SUCCESS;
+}
+
+int load_packed_page(Kabletop *kabletop)
+{
+    // rounds of a page lie next to each other in SignedRounds, so the page costs one read
+    // of its offsets and one of its rounds, instead of one witness per round
+    int ret = CKB_SUCCESS;
+    uint16_t count = kabletop->round_count - kabletop->page_begin;
+    if (count > ROUND_PAGE_SIZE)
+    {
+        count = ROUND_PAGE_SIZE;
+    }
+    uint32_t offsets[ROUND_PAGE_SIZE + 1];
+    int last = kabletop->page_begin + count == kabletop->round_count;
+    CHECK_RET(load_witness_range((uint8_t *)offsets, (count + !last) * MOL_NUM_T_SIZE,
+        kabletop->packed_begin + MOL_NUM_T_SIZE * (1 + kabletop->page_begin), kabletop->round_offset));
+    if (last)
+    {
+        offsets[count] = kabletop->packed_size;
+    }
+    if (offsets[0] < MOL_NUM_T_SIZE * (1 + kabletop->round_count) || offsets[count] > kabletop->packed_size)
+    {
+        return KABLETOP_ROUND_FORMAT_ERROR;
+    }
+    for (uint16_t j = 0; j < count; ++j)
+    {
+        if (offsets[j + 1] < offsets[j] || offsets[j + 1] - offsets[j] > MAX_ROUND_SIZE)
+        {
+            return KABLETOP_EXCESSIVE_WITNESS_BYTES;
+        }
+    }
+    CHECK_RET(load_witness_range(kabletop->page, offsets[count] - offsets[0],
+        kabletop->packed_begin + offsets[0], kabletop->round_offset));
+    for (uint16_t j = 0; j < count; ++j)
+    {
+        mol_seg_t signed_round = {
+            .ptr = &kabletop->page[offsets[j] - offsets[0]],
+            .size = offsets[j + 1] - offsets[j]
+        };
+        if (MolReader_SignedRound_verify(&signed_round, false) != MOL_OK)
+        {
+            return KABLETOP_ROUND_FORMAT_ERROR;
+        }
+        kabletop->signatures[j] = MolReader_SignedRound_get_signature(&signed_round);
+        kabletop->rounds[j] = MolReader_SignedRound_get_round(&signed_round);
+        if (MolReader_Round_verify(&kabletop->rounds[j], false) != MOL_OK
+            || decode_round(&kabletop->rounds[j], &kabletop->decoded_rounds[j]) != MOL_OK)
+        {
+            return KABLETOP_ROUND_FORMAT_ERROR;
+        }
+    }
+    kabletop->page_size = count;
+    return CKB_SUCCESS;
+}
+
+int load_round_page(Kabletop *kabletop, uint16_t i)
+{
+    // reload the page of extra witnesses which contains round i, so that memory stays
+    // flat no matter how many rounds the game has gone through
+    int ret = CKB_SUCCESS;
+    kabletop->page_begin = i - i % ROUND_PAGE_SIZE;
+    kabletop->page_size = 0;
+    if (kabletop->packed)
+    {
+        return load_packed_page(kabletop);
+    }
+    for (uint16_t j = 0; j < ROUND_PAGE_SIZE && kabletop->page_begin + j < kabletop->round_count; ++j)
+    {
+        uint8_t *witness = &kabletop->page[j * MAX_ROUND_SIZE];
+        uint64_t len = MAX_ROUND_SIZE;
+        ret = ckb_load_witness(witness, &len, 0, kabletop->round_offset + kabletop->page_begin + j, CKB_SOURCE_INPUT);
+        if (ret != CKB_SUCCESS || len > MAX_ROUND_SIZE)
+        {
+            return KABLETOP_EXCESSIVE_WITNESS_BYTES;
+        }
+        // extract round signature from extra witness lock
+        CHECK_RET(extract_witness_lock(witness, len, &kabletop->signatures[j]));
+        if (kabletop->signatures[j].size != SIGNATURE_SIZE)
+        {
+            return ERROR_ARGUMENTS_LEN;
+        }
+        // extract round from extra witness input_type
+        CHECK_RET(extract_witness_input_type(witness, len, &kabletop->rounds[j]));
+        if (MolReader_Round_verify(&kabletop->rounds[j], false) != MOL_OK
+            || decode_round(&kabletop->rounds[j], &kabletop->decoded_rounds[j]) != MOL_OK)
+        {
+            return KABLETOP_ROUND_FORMAT_ERROR;
+        }
+        kabletop->page_size = j + 1;
+    }
+    return CKB_SUCCESS;
+}
+
+int load_round(Kabletop *kabletop, uint16_t i)
+{
+    // make round i resident before it is read through the accessors below, which never load
+    // pages by themselves
+    if (i >= kabletop->round_count)
+    {
+        return KABLETOP_EXCESSIVE_ROUNDS;
+    }
+    if (i < kabletop->page_begin || i >= kabletop->page_begin + kabletop->page_size)
+    {
+        return load_round_page(kabletop, i);
+    }
+    return CKB_SUCCESS;
+}
+
+mol_seg_t * _round(Kabletop *kabletop, uint16_t i)
 {
+    if (i >= kabletop->round_count || i < kabletop->page_begin || i >= kabletop->page_begin + kabletop->page_size)
+    {
+        return NULL;
+    }
+    return &kabletop->rounds[i - kabletop->page_begin];
+}
+
+mol_seg_t * _signature(Kabletop *kabletop, uint16_t i)
+{
+    if (_round(kabletop, i) == NULL)
+    {
+        return NULL;
+    }
+    return &kabletop->signatures[i - kabletop->page_begin];
+}
+
+DecodedRound * _decoded_round(Kabletop *kabletop, uint16_t i)
+{
+    if (_round(kabletop, i) == NULL)
+    {
+        return NULL;
+    }
+    return &kabletop->decoded_rounds[i - kabletop->page_begin];
+}
+
+#if ROUND_PAGE_SIZE * MAX_ROUND_SIZE < MAX_WITNESS_SIZE
+#error "round page is too small to hold the group witness"
+#endif
+
+// rounds are checked along the replay instead of in passes of their own, so that every round
+// witness is loaded only once, the last two messages are kept for recovery after the replay
+typedef struct
+{
+    secp256k1_context context;
+    MODE mode;
+    blake2b_state chain;
+    uint8_t messages[2][BLAKE2B_BLOCK_SIZE];
+    uint8_t signatures[2][SIGNATURE_SIZE];
+    uint8_t user_types[2];
+    // hash proof of the rounds before a challenged snapshot position
+    blake2b_state proof;
+    uint16_t proof_position;
+    const uint8_t *proof_expect;
+    int proof_error;
+} RoundPass;
+
+int verify_witnesses(Kabletop *kabletop, RoundPass *pass, uint8_t witnesses[ROUND_PAGE_SIZE][MAX_ROUND_SIZE],
+    uint8_t secp_data[CKB_SECP256K1_PARTIAL_DATA_SIZE])
+{
+    // all signatures of this run are recovered from one secp256k1 context, which costs
+    // much less than loading the precomputed data cell for every recovery, and only the
+    // table prefixes reached by WINDOW_G are loaded
     uint8_t pubkey_hash[BLAKE160_SIZE];
     int ret = CKB_SUCCESS;
-    CHECK_RET(get_secp256k1_blake160_sighash_all(pubkey_hash, 0, CKB_SOURCE_GROUP_INPUT));
+    CHECK_RET(ckb_secp256k1_custom_verify_only_initialize_partial(&pass->context, secp_data));
+    CHECK_RET(get_secp256k1_blake160_sighash_all_with_context(&pass->context, pubkey_hash, 0, CKB_SOURCE_GROUP_INPUT));
 
     // any one of users should match signature
     if (memcmp(pubkey_hash, _user1_pkhash(kabletop), BLAKE160_SIZE) == 0)
@@ -241,136 +1037,239 @@ int verify_witnesses(Kabletop *kabletop, uint8_t witnesses[MAX_ROUND_COUNT][MAX_
         return ERROR_PUBKEY_BLAKE160_HASH;
     }
 
-    int s = ckb_calculate_inputs_len();
-    int e = s;
+    size_t s, end;
+    // group witness may carry nft reveals as well, so it is loaded across the whole round page
+    CHECK_RET(load_round_layout(kabletop, (uint8_t *)witnesses, &s, &end));
+    CHECK_RET(verify_batch_layouts(kabletop));
+    size_t e = s;
     uint64_t len = MAX_ROUND_SIZE;
-    while (ckb_load_witness(witnesses[e-s], &len, 0, e, CKB_SOURCE_INPUT) != CKB_INDEX_OUT_OF_BOUND)
+    kabletop->packed = 0;
+    // only the first round witness is copied here, the others are counted by their lengths
+    while (e < end && ckb_load_witness(witnesses[0], &len, 0, e, CKB_SOURCE_INPUT) != CKB_INDEX_OUT_OF_BOUND)
     {
+        // the first witness may pack all rounds of this channel, then it stands alone
+        if (e == s && is_packed_witness(witnesses[0], len))
+        {
+            CHECK_RET(open_packed_rounds(kabletop, e, witnesses[0], len));
+            e += 1;
+            len = 0;
+            if (e < end && ckb_load_witness(witnesses[0], &len, 0, e, CKB_SOURCE_INPUT) != CKB_INDEX_OUT_OF_BOUND)
+            {
+                return KABLETOP_WRONG_ROUND_LAYOUT;
+            }
+            break;
+        }
         if (len > MAX_ROUND_SIZE)
         {
             return KABLETOP_EXCESSIVE_WITNESS_BYTES;
         }
+        if (e - s >= MAX_ROUND_COUNT)
+        {
+            return KABLETOP_EXCESSIVE_ROUNDS;
+        }
+        // fill channel random seed from first 16 bytes of channel hash in the first round
+        if (e == s)
+        {
+            mol_seg_t channel_hash_seg;
+            CHECK_RET(extract_witness_output_type(witnesses[0], len, &channel_hash_seg));
+            if (channel_hash_seg.size < sizeof(Seed))
+            {
+                return KABLETOP_ROUND_FORMAT_ERROR;
+            }
+            memcpy(kabletop->channel_seed.randomseed, channel_hash_seg.ptr, sizeof(Seed));
+        }
+        len = 0;
         e += 1;
     }
-    kabletop->round_count = e - s;
-    if (kabletop->round_count > MAX_ROUND_COUNT || kabletop->round_count == 0)
+    if (end != SIZE_MAX && e != end)
+    {
+        return KABLETOP_WRONG_ROUND_LAYOUT;
+    }
+    if (e == s)
     {
         return KABLETOP_EXCESSIVE_ROUNDS;
     }
+    if (!kabletop->packed)
+    {
+        kabletop->round_count = e - s;
+    }
+    kabletop->round_offset = s;
+    kabletop->page = (uint8_t *)witnesses;
+    kabletop->page_begin = 0;
+    kabletop->page_size = 0;
+    return CKB_SUCCESS;
+}
+
+int verify_hash_proof(RoundPass *pass)
+{
+    uint8_t hash_proof[BLAKE2B_BLOCK_SIZE];
+    blake2b_final(&pass->proof, hash_proof, BLAKE2B_BLOCK_SIZE);
+    if (memcmp(hash_proof, pass->proof_expect, BLAKE2B_BLOCK_SIZE) != 0)
+    {
+        return pass->proof_error;
+    }
+    return CKB_SUCCESS;
+}
 
+int begin_round_pass(Kabletop *kabletop, RoundPass *pass, MODE mode)
+{
     // check round signatures, always start from lock_hash and capacity
     uint8_t lock_hash[BLAKE2B_BLOCK_SIZE];
-    len = BLAKE2B_BLOCK_SIZE;
+    uint64_t len = BLAKE2B_BLOCK_SIZE;
     ckb_load_cell_by_field(lock_hash, &len, 0, 0, CKB_SOURCE_GROUP_INPUT, CKB_CELL_FIELD_LOCK_HASH);
+    blake2b_init(&pass->chain, BLAKE2B_BLOCK_SIZE);
+    blake2b_update(&pass->chain, lock_hash, BLAKE2B_BLOCK_SIZE);
 
-    blake2b_state blake2b_ctx;
-    blake2b_init(&blake2b_ctx, BLAKE2B_BLOCK_SIZE);
-    blake2b_update(&blake2b_ctx, lock_hash, BLAKE2B_BLOCK_SIZE);
+    // settlement proves the snapshot of the input challenge, challenge proves its own one
+    pass->mode = mode;
+    pass->proof_expect = NULL;
+    if (mode == MODE_CHALLENGE)
+    {
+        pass->proof_position = _snapshot_position(kabletop, output);
+        pass->proof_expect = _snapshot_hashproof(kabletop, output);
+        pass->proof_error = KABLETOP_CHALLENGE_FORMAT_ERROR;
+    }
+    else if (kabletop->input_challenge.ptr)
+    {
+        pass->proof_position = _snapshot_position(kabletop, input);
+        pass->proof_expect = _snapshot_hashproof(kabletop, input);
+        pass->proof_error = KABLETOP_SETTLEMENT_FORMAT_ERROR;
+    }
+    blake2b_init(&pass->proof, BLAKE2B_BLOCK_SIZE);
+    if (pass->proof_expect && pass->proof_position == 0)
+    {
+        return verify_hash_proof(pass);
+    }
+    return CKB_SUCCESS;
+}
 
-    mol_seg_t signature_seg;
-    uint8_t message[BLAKE2B_BLOCK_SIZE];
-    for (uint8_t i = 0; i < kabletop->round_count; ++i)
+int verify_challenge_round(Kabletop *kabletop, uint16_t i)
+{
+    // check signature samilarity between signature in challenge and the other in witness
+    if (i + 1 == _snapshot_position(kabletop, output))
     {
-        if (i > 0)
+        if (memcmp(_signature(kabletop, i)->ptr, _snapshot_signature(kabletop, output), SIGNATURE_SIZE) != 0)
         {
-            blake2b_init(&blake2b_ctx, BLAKE2B_BLOCK_SIZE);
-            blake2b_update(&blake2b_ctx, message, BLAKE2B_BLOCK_SIZE);
-            blake2b_update(&blake2b_ctx, signature_seg.ptr, SIGNATURE_SIZE);
+            return KABLETOP_CHALLENGE_FORMAT_ERROR;
         }
-        uint8_t *witness = witnesses[i];
-        len = MAX_ROUND_SIZE;
-        ckb_load_witness(witness, &len, 0, i + s, CKB_SOURCE_INPUT);
-        // extract round signature from extra witness lock
-        CHECK_RET(extract_witness_lock(witness, len, &signature_seg));
-        if (signature_seg.size != SIGNATURE_SIZE)
+        // check wether operations in challenge can be empty
+        uint8_t challenger = _challenger(kabletop, output);
+        uint8_t snapshot_user_type = _user_type(kabletop, i);
+        uint8_t pending_operations_count = _challenge_operations_count(kabletop, output);
+        if ((challenger == snapshot_user_type && pending_operations_count > 0)
+            || (challenger != snapshot_user_type && pending_operations_count == 0))
         {
-            return ERROR_ARGUMENTS_LEN;
+            return KABLETOP_CHALLENGE_FORMAT_ERROR;
         }
-        // extract round from extra witness input_type
-        CHECK_RET(extract_witness_input_type(witness, len, &kabletop->rounds[i]));
-        if (MolReader_Round_verify(&kabletop->rounds[i], false) != MOL_OK
-            || _operations_count(kabletop, i) > MAX_OPERATIONS_PER_ROUND)
+    }
+    // if input challenge has non-empty operations, they must be equal to the operations
+    // at snapshot position from kabletop rounds in bytes
+    if (kabletop->input_challenge.ptr
+        && _challenge_operations_count(kabletop, input) > 0
+        && i == _snapshot_position(kabletop, input))
+    {
+        mol_seg_t challenge_operations = _challenge_operations(kabletop, input);
+        mol_seg_t operations = _decoded_round(kabletop, i)->operations;
+        if (challenge_operations.size != operations.size
+            || memcmp(challenge_operations.ptr, operations.ptr, operations.size) != 0)
         {
-            return KABLETOP_ROUND_FORMAT_ERROR;
+            return KABLETOP_CHALLENGE_FORMAT_ERROR;
         }
-        // complete signature message with round data
-        blake2b_update(&blake2b_ctx, kabletop->rounds[i].ptr, kabletop->rounds[i].size);
-        blake2b_final(&blake2b_ctx, message, BLAKE2B_BLOCK_SIZE);
-        // CAUTION: the method "get_secp256k1_pubkey_blake160" is way too EXPENSIVE, so we just check
-        // two signatures from last TWO rounds of this game which already contain both two users' confirmation
-        if (i + 2 >= kabletop->round_count)
-        {
-            // recover pubkey blake160 hash
-            CHECK_RET(get_secp256k1_pubkey_blake160(pubkey_hash, signature_seg.ptr, message));
-            // check round owner
-            if ((_user_type(kabletop, i) == USER_1 && memcmp(pubkey_hash, _user2_pkhash(kabletop), BLAKE160_SIZE) != 0)
-                || (_user_type(kabletop, i) == USER_2 && memcmp(pubkey_hash, _user1_pkhash(kabletop), BLAKE160_SIZE) != 0))
-            {
-                return KABLETOP_WRONG_USER_ROUND;
-            }
-        }
-        // fill round random seed from first 16 bytes of round signature
-		if (i == 0)
-		{
-			mol_seg_t channel_hash_seg;
-			CHECK_RET(extract_witness_output_type(witness, len, &channel_hash_seg));
-			memcpy(kabletop->seeds[i].randomseed, channel_hash_seg.ptr, sizeof(uint64_t) * 2);
-		}
-		if (i + 1 < kabletop->round_count)
-		{
-			memcpy(kabletop->seeds[i + 1].randomseed, signature_seg.ptr, sizeof(uint64_t) * 2);
-		}
-		// save signature segment to kabletop for verifying challenge mode
-		kabletop->signatures[i] = signature_seg;
     }
     return CKB_SUCCESS;
 }
 
-int verify_settlement_mode(Kabletop *kabletop, uint64_t capacities[3])
+int verify_round(Kabletop *kabletop, RoundPass *pass, uint16_t i)
 {
-    const uint8_t *expect_code_hash = _lock_code_hash(kabletop);
-    uint8_t lock_script[MAX_SCRIPT_SIZE];
-    uint8_t user_checked[2] = {0, 0};
+    // rounds must be passed in order, round i is made resident for the replay as well
     int ret = CKB_SUCCESS;
-    for (size_t i = 0; 1; ++i)
+    CHECK_RET(load_round(kabletop, i));
+    mol_seg_t *round = _round(kabletop, i);
+    mol_seg_t *signature = _signature(kabletop, i);
+    if (i > 0)
     {
-        uint64_t len = MAX_SCRIPT_SIZE;
-        // filter cell by lock_script's code_hash
-        ret = ckb_load_cell_by_field(lock_script, &len, 0, i, CKB_SOURCE_OUTPUT, CKB_CELL_FIELD_LOCK);
-        if (ret == CKB_INDEX_OUT_OF_BOUND)
+        blake2b_init(&pass->chain, BLAKE2B_BLOCK_SIZE);
+        blake2b_update(&pass->chain, pass->messages[(i - 1) % 2], BLAKE2B_BLOCK_SIZE);
+        blake2b_update(&pass->chain, pass->signatures[(i - 1) % 2], SIGNATURE_SIZE);
+    }
+    // complete signature message with round data
+    blake2b_update(&pass->chain, round->ptr, round->size);
+    blake2b_final(&pass->chain, pass->messages[i % 2], BLAKE2B_BLOCK_SIZE);
+    memcpy(pass->signatures[i % 2], signature->ptr, SIGNATURE_SIZE);
+    pass->user_types[i % 2] = _user_type(kabletop, i);
+    // check current rounds hash proof
+    if (pass->proof_expect && i < pass->proof_position)
+    {
+        blake2b_update(&pass->proof, round->ptr, round->size);
+        blake2b_update(&pass->proof, signature->ptr, SIGNATURE_SIZE);
+        if (i + 1 == pass->proof_position)
         {
-            break;
+            CHECK_RET(verify_hash_proof(pass));
         }
-        if (ret != CKB_SUCCESS || len > MAX_SCRIPT_SIZE)
+    }
+    if (pass->mode == MODE_CHALLENGE)
+    {
+        CHECK_RET(verify_challenge_round(kabletop, i));
+    }
+    return CKB_SUCCESS;
+}
+
+int end_round_pass(Kabletop *kabletop, RoundPass *pass)
+{
+    // CAUTION: the method "get_secp256k1_pubkey_blake160" is way too EXPENSIVE, so we just check
+    // two signatures from last TWO rounds of this game which already contain both two users' confirmation
+    uint8_t pubkey_hash[BLAKE160_SIZE];
+    int ret = CKB_SUCCESS;
+    uint16_t i = kabletop->round_count < 2 ? 0 : kabletop->round_count - 2;
+    for (; i < kabletop->round_count; ++i)
+    {
+        // recover pubkey blake160 hash
+        CHECK_RET(get_secp256k1_pubkey_blake160_with_context(&pass->context, pubkey_hash,
+            pass->signatures[i % 2], pass->messages[i % 2]));
+        // check round owner
+        if ((pass->user_types[i % 2] == USER_1 && memcmp(pubkey_hash, _user2_pkhash(kabletop), BLAKE160_SIZE) != 0)
+            || (pass->user_types[i % 2] == USER_2 && memcmp(pubkey_hash, _user1_pkhash(kabletop), BLAKE160_SIZE) != 0))
         {
-            return ERROR_ENCODING;
+            return KABLETOP_WRONG_USER_ROUND;
         }
-        mol_seg_t script;
-        script.ptr = lock_script;
-        script.size = len;
-        mol_seg_t code_hash = MolReader_Script_get_code_hash(&script);
-        if (code_hash.size != BLAKE2B_BLOCK_SIZE)
+    }
+    return CKB_SUCCESS;
+}
+
+int verify_settlement_mode(Kabletop *kabletop, uint64_t capacities[3])
+{
+    const uint8_t *expect_code_hash = _lock_code_hash(kabletop);
+    uint8_t user_checked[2] = {0, 0};
+    int ret = CKB_SUCCESS;
+    if (kabletop->batched)
+    {
+        // a batched channel is only paid by the outputs its round layout points out
+        OutputCell *user1_cell = find_output(kabletop, kabletop->user_outputs[0]);
+        OutputCell *user2_cell = find_output(kabletop, kabletop->user_outputs[1]);
+        if (user1_cell && output_owned_by(user1_cell, expect_code_hash, _user1_pkhash(kabletop)))
         {
-            return ERROR_ENCODING;
+            user_checked[0] = 1;
+            capacities[USER_1] = user1_cell->capacity;
         }
-        if (memcmp(code_hash.ptr, expect_code_hash, BLAKE2B_BLOCK_SIZE) != 0)
+        if (user2_cell && output_owned_by(user2_cell, expect_code_hash, _user2_pkhash(kabletop)))
         {
-            continue;
+            user_checked[1] = 1;
+            capacities[USER_2] = user2_cell->capacity;
         }
-        // check lock_args difference between input and output
-        mol_seg_t lock_args = MolReader_Script_get_args(&script);
-        lock_args = MolReader_Bytes_raw_bytes(&lock_args);
-        if (memcmp(lock_args.ptr, _user1_pkhash(kabletop), BLAKE160_SIZE) == 0 && user_checked[0] == 0)
+    }
+    for (uint8_t i = 0; i < kabletop->output_count && ! kabletop->batched; ++i)
+    {
+        // filter cell by lock_script's code_hash and check lock_args difference between input and output
+        OutputCell *cell = &kabletop->outputs[i];
+        if (output_owned_by(cell, expect_code_hash, _user1_pkhash(kabletop)) && user_checked[0] == 0)
         {
             user_checked[0] = 1;
-            len = sizeof(uint64_t);
-            CHECK_RET(ckb_load_cell_by_field(&capacities[USER_1], &len, 0, i, CKB_SOURCE_OUTPUT, CKB_CELL_FIELD_CAPACITY));
+            capacities[USER_1] = cell->capacity;
         }
-        else if (memcmp(lock_args.ptr, _user2_pkhash(kabletop), BLAKE160_SIZE) == 0 && user_checked[1] == 0)
+        else if (output_owned_by(cell, expect_code_hash, _user2_pkhash(kabletop)) && user_checked[1] == 0)
         {
             user_checked[1] = 1;
-            len = sizeof(uint64_t);
-            CHECK_RET(ckb_load_cell_by_field(&capacities[USER_2], &len, 0, i, CKB_SOURCE_OUTPUT, CKB_CELL_FIELD_CAPACITY));
+            capacities[USER_2] = cell->capacity;
         }
     }
     // check wether contain both of two users output cells
@@ -388,20 +1287,6 @@ int verify_settlement_mode(Kabletop *kabletop, uint64_t capacities[3])
 		{
 			return KABLETOP_SETTLEMENT_FORMAT_ERROR;
 		}
-		// check current rounds hash proof
-		blake2b_state hash;
-		blake2b_init(&hash, BLAKE2B_BLOCK_SIZE);
-		for (uint8_t i = 0; i < _snapshot_position(kabletop, input); ++i)
-		{
-			blake2b_update(&hash, kabletop->rounds[i].ptr, kabletop->rounds[i].size);
-			blake2b_update(&hash, kabletop->signatures[i].ptr, kabletop->signatures[i].size);
-		}
-		uint8_t hash_proof[BLAKE2B_BLOCK_SIZE];
-		blake2b_final(&hash, hash_proof, BLAKE2B_BLOCK_SIZE);
-		if (memcmp(hash_proof, _snapshot_hashproof(kabletop, input), BLAKE2B_BLOCK_SIZE) != 0)
-		{
-			return KABLETOP_SETTLEMENT_FORMAT_ERROR;
-		}
 	}
     return CKB_SUCCESS;
 }
@@ -413,86 +1298,50 @@ int verify_challenge_mode(Kabletop *kabletop)
 	{
         return KABLETOP_CHALLENGE_FORMAT_ERROR;
 	}
-	// check hash proof of rounds and signatures in kabletop witness
-	blake2b_state hash;
-	blake2b_init(&hash, BLAKE2B_BLOCK_SIZE);
-	for (uint8_t i = 0; i < _snapshot_position(kabletop, output); ++i)
-	{
-		blake2b_update(&hash, kabletop->rounds[i].ptr, kabletop->rounds[i].size);
-		blake2b_update(&hash, kabletop->signatures[i].ptr, kabletop->signatures[i].size);
-	}
-	uint8_t hash_proof[BLAKE2B_BLOCK_SIZE];
-	blake2b_final(&hash, hash_proof, BLAKE2B_BLOCK_SIZE);
-	if (memcmp(hash_proof, _snapshot_hashproof(kabletop, output), BLAKE2B_BLOCK_SIZE) != 0)
-	{
-		return KABLETOP_CHALLENGE_FORMAT_ERROR;
-	}
-	// check signature samilarity between signature in challenge and the other in witness
-	uint8_t spi = _snapshot_position(kabletop, output) - 1;
-	if (memcmp(kabletop->signatures[spi].ptr, _snapshot_signature(kabletop, output), SIGNATURE_SIZE) != 0)
-	{
-		return KABLETOP_CHALLENGE_FORMAT_ERROR;
-	}
-	// check wether operations in challenge can be empty
-	uint8_t snapshot_user_type = _user_type(kabletop, _snapshot_position(kabletop, output) - 1);
-	uint8_t pending_operations_count = _output_challenge_operations_count(kabletop);
-	if ((challenger == snapshot_user_type && pending_operations_count > 0)
-		|| (challenger != snapshot_user_type && pending_operations_count == 0))
+	// rounds at the snapshot positions are checked along the replay by verify_challenge_round
+	if (_snapshot_position(kabletop, output) == 0)
 	{
 		return KABLETOP_CHALLENGE_FORMAT_ERROR;
 	}
-	// if input challenge has non-empty operations, they must be equal to the operations
-	// at snapshot position from kabletop rounds in bytes
 	if (kabletop->input_challenge.ptr)
 	{
-        if (_input_challenge_operations_count(kabletop) > 0)
+        if (_challenge_operations_count(kabletop, input) > 0
+            && _snapshot_position(kabletop, input) >= kabletop->round_count)
         {
-            uint8_t i = _snapshot_position(kabletop, input);
-            mol_seg_t challenge_operations = MolReader_Challenge_get_operations(&kabletop->input_challenge);
-            mol_seg_t operations = MolReader_Round_get_operations(&kabletop->rounds[i]);
-            if (challenge_operations.size != operations.size
-                || memcmp(challenge_operations.ptr, operations.ptr, operations.size) != 0)
-            {
-                return KABLETOP_CHALLENGE_FORMAT_ERROR;
-            }
+            return KABLETOP_CHALLENGE_FORMAT_ERROR;
         }
-        // check the challenger has payed back ckb which equals to input_challenge data size to last challenger
-        uint64_t ckb;
-        uint64_t len = sizeof(uint64_t);
-        for (size_t i = 0; 1; ++i)
+        // check the challenger has payed back ckb which equals to input_challenge data size to last challenger,
+        // a batched channel pays back at the output its round layout points out for that user
+        uint8_t user_type = _challenger(kabletop, input);
+        OutputCell *payback = NULL;
+        if (kabletop->batched)
         {
-            int ret = ckb_load_cell_by_field(&ckb, &len, 0, i, CKB_SOURCE_OUTPUT, CKB_CELL_FIELD_CAPACITY);
-            if (ret != CKB_SUCCESS)
+            if (user_type == USER_1 || user_type == USER_2)
             {
-                return KABLETOP_CHALLENGE_FORMAT_ERROR;
+                payback = find_output(kabletop, kabletop->user_outputs[user_type - USER_1]);
             }
-            if (TO_CAPACITY(kabletop->input_challenge.size) == ckb)
+        }
+        else
+        {
+            for (uint8_t i = 0; i < kabletop->output_count && payback == NULL; ++i)
             {
-                uint8_t lock_script[MAX_SCRIPT_SIZE];
-                len = MAX_SCRIPT_SIZE;
-                ckb_load_cell_by_field(lock_script, &len, 0, i, CKB_SOURCE_OUTPUT, CKB_CELL_FIELD_LOCK);
-                mol_seg_t script;
-                script.ptr = lock_script;
-                script.size = len;
-                mol_seg_t code_hash = MolReader_Script_get_code_hash(&script);
-                // check code_hash
-                if (code_hash.size != BLAKE2B_BLOCK_SIZE
-                    || memcmp(code_hash.ptr, _lock_code_hash(kabletop), BLAKE2B_BLOCK_SIZE) != 0)
+                if (kabletop->outputs[i].capacity == TO_CAPACITY(kabletop->input_challenge.size))
                 {
-                    return KABLETOP_CHALLENGE_FORMAT_ERROR;
+                    payback = &kabletop->outputs[i];
                 }
-                // check lock_args which presents user_pkhash
-                mol_seg_t lock_args = MolReader_Script_get_args(&script);
-                lock_args = MolReader_Bytes_raw_bytes(&lock_args);
-                uint8_t user_type = _challenger(kabletop, input);
-                if ((user_type == USER_1 && memcmp(lock_args.ptr, _user1_pkhash(kabletop), BLAKE160_SIZE) != 0)
-                    || (user_type == USER_2 && memcmp(lock_args.ptr, _user2_pkhash(kabletop), BLAKE160_SIZE) != 0))
-                {
-                    return KABLETOP_CHALLENGE_FORMAT_ERROR;
-                }
-                break;
             }
         }
+        if (payback == NULL || payback->capacity != TO_CAPACITY(kabletop->input_challenge.size))
+        {
+            return KABLETOP_CHALLENGE_FORMAT_ERROR;
+        }
+        // check code_hash and lock_args which presents user_pkhash
+        const uint8_t *pkhash = user_type == USER_1 ? _user1_pkhash(kabletop) : _user2_pkhash(kabletop);
+        if ((user_type == USER_1 || user_type == USER_2)
+            && !output_owned_by(payback, _lock_code_hash(kabletop), pkhash))
+        {
+            return KABLETOP_CHALLENGE_FORMAT_ERROR;
+        }
 	}
     else if (_challenge_count(kabletop, output) != 1)
     {
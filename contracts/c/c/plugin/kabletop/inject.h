@@ -4,22 +4,276 @@
 #include "../inject.h"
 #include "core.h"
 #include "luacode.c"
+#include "trace.h"
+#include <stdio.h>
+
+void hex(char *hex, uint8_t *bytes, int size)
+{
+	int pointer = 0;
+	char hex_char[16];
+	for (int i = 0; i < size; ++i)
+	{
+		sprintf(hex_char, "%02x", (int)bytes[i]);
+		memcpy(&hex[pointer], hex_char, strlen(hex_char));
+		pointer += strlen(hex_char);
+	}
+}
+
+void import_user_nft(Kabletop *k, lua_State *L, _USER_NFT_F _user_nft, const char *name)
+{
+    lua_newtable(L);
+	char hash[BLAKE160_SIZE * 2 + 1] = "";
+    for (uint8_t i = 0; i < _user_deck_size(k); ++i)
+    {
+		uint8_t *nft = _user_nft(k, i);
+		if (nft == NULL) break;
+		hex(hash, nft, BLAKE160_SIZE);
+        lua_pushstring(L, hash);
+        lua_rawseti(L, -2, i + 1);
+    }
+    lua_setglobal(L, name);
+}
+
+int unrevealed_nft(lua_State *L)
+{
+    return luaL_error(L, "nft %d of deck is not revealed", (int)lua_tointeger(L, 2));
+}
+
+void import_unrevealed_deck(lua_State *L, const char *name)
+{
+    // cards of a merkle committed deck show up once revealed, reading any other card fails replay
+    lua_newtable(L);
+    lua_newtable(L);
+    lua_pushcfunction(L, unrevealed_nft);
+    lua_setfield(L, -2, "__index");
+    lua_setmetatable(L, -2);
+    lua_setglobal(L, name);
+}
+
+int reveal_user_nft(Kabletop *k, lua_State *L, uint8_t user_type, uint8_t index, const uint8_t *nft,
+    const uint8_t *proof, size_t proof_count)
+{
+    const uint8_t *root;
+    const char *name;
+    switch (user_type)
+    {
+        case USER_1: root = k->decoded_args.user1_nft_root; name = "_user1_nfts"; break;
+        case USER_2: root = k->decoded_args.user2_nft_root; name = "_user2_nfts"; break;
+        default: return KABLETOP_WRONG_NFT_REVEAL;
+    }
+    int ret = CKB_SUCCESS;
+    CHECK_RET(verify_nft_proof(root, _user_deck_size(k), index, nft, proof, proof_count));
+	char hash[BLAKE160_SIZE * 2 + 1] = "";
+	hex(hash, (uint8_t *)nft, BLAKE160_SIZE);
+    lua_getglobal(L, name);
+    lua_pushstring(L, hash);
+    lua_rawseti(L, -2, index + 1);
+    lua_pop(L, 1);
+    return CKB_SUCCESS;
+}
+
+int import_revealed_nfts(Kabletop *k, lua_State *L, uint8_t reveals[MAX_REVEALS_SIZE])
+{
+    // revealed cards come from output_type of the group witness, missing means none is revealed
+    import_unrevealed_deck(L, "_user1_nfts");
+    import_unrevealed_deck(L, "_user2_nfts");
+    uint64_t len = MAX_REVEALS_SIZE;
+    int ret = ckb_load_witness(reveals, &len, 0, 0, CKB_SOURCE_GROUP_INPUT);
+    if (ret != CKB_SUCCESS || len > MAX_REVEALS_SIZE)
+    {
+        return KABLETOP_WRONG_NFT_REVEAL;
+    }
+    mol_seg_t reveals_seg;
+    if (extract_witness_output_type(reveals, len, &reveals_seg) != CKB_SUCCESS)
+    {
+        return CKB_SUCCESS;
+    }
+    if (MolReader_Reveals_verify(&reveals_seg, false) != MOL_OK)
+    {
+        return KABLETOP_WRONG_NFT_REVEAL;
+    }
+    mol_num_t count = MolReader_Reveals_length(&reveals_seg);
+    for (mol_num_t i = 0; i < count; ++i)
+    {
+        mol_seg_t reveal = MolReader_Reveals_get(&reveals_seg, i).seg;
+        mol_seg_t proof = MolReader_Reveal_get_proof(&reveal);
+        CHECK_RET(reveal_user_nft(k, L,
+            *(uint8_t *)MolReader_Reveal_get_user_type(&reveal).ptr,
+            *(uint8_t *)MolReader_Reveal_get_index(&reveal).ptr,
+            MolReader_Reveal_get_nft(&reveal).ptr,
+            proof.ptr + MOL_NUM_T_SIZE, MolReader_Hashes_length(&proof)));
+    }
+    return CKB_SUCCESS;
+}
+
+int set_random_seed(lua_State *L)
+{
+    // math.randomseed is looked up on every call in case game code replaced it
+    lua_getglobal(L, "math");
+    lua_getfield(L, -1, "randomseed");
+    lua_remove(L, -2);
+    lua_insert(L, 1);
+    lua_call(L, lua_gettop(L) - 1, 0);
+    return 0;
+}
+
+#ifdef KABLETOP_NOFLOAT
+// "/" of liblua-nofloat.a, see nofloat.h
+double kabletop_float_division(lua_State *L)
+{
+    luaL_error(L, "float division is disabled, divide integers with \"//\"");
+    return 0;
+}
+
+int integer_random(lua_State *L)
+{
+    if (lua_isnoneornil(L, 1))
+    {
+        return luaL_error(L, "math.random needs integer bounds");
+    }
+    if (lua_isnoneornil(L, 2))
+    {
+        lua_settop(L, 1);
+    }
+    lua_pushvalue(L, lua_upvalueindex(1));
+    lua_insert(L, 1);
+    lua_call(L, lua_gettop(L) - 1, 1);
+    return 1;
+}
+#endif
+
+// a tracked state table is emptied and keeps its fields in a backing table, so that every write
+// reaches __newindex and marks the state name dirty for the current round, writes into nested
+// tables are not seen and such tables should be tracked on their own
+int state_next(lua_State *L)
+{
+    lua_settop(L, 2);
+    if (lua_next(L, 1))
+    {
+        return 2;
+    }
+    lua_pushnil(L);
+    return 1;
+}
+
+int state_pairs(lua_State *L)
+{
+    lua_pushcfunction(L, state_next);
+    lua_pushvalue(L, lua_upvalueindex(1));
+    lua_pushnil(L);
+    return 3;
+}
+
+int state_len(lua_State *L)
+{
+    lua_pushinteger(L, lua_rawlen(L, lua_upvalueindex(1)));
+    return 1;
+}
+
+int state_newindex(lua_State *L)
+{
+    lua_settop(L, 3);
+    lua_rawset(L, lua_upvalueindex(1));
+    lua_getfield(L, LUA_REGISTRYINDEX, "_kabletop_dirty");
+    lua_pushvalue(L, lua_upvalueindex(2));
+    lua_pushboolean(L, 1);
+    lua_rawset(L, -3);
+    return 0;
+}
+
+int track_state(lua_State *L)
+{
+    luaL_checkstring(L, 1);
+    luaL_checktype(L, 2, LUA_TTABLE);
+    lua_settop(L, 2);
+    if (lua_getmetatable(L, 2))
+    {
+        return luaL_error(L, "state %s already has a metatable", lua_tostring(L, 1));
+    }
+    // move fields into backing table, clearing fields during traversal is allowed by lua_next
+    lua_newtable(L);
+    lua_pushnil(L);
+    while (lua_next(L, 2))
+    {
+        lua_pushvalue(L, -2);
+        lua_insert(L, -2);
+        lua_rawset(L, 3);
+        lua_pushvalue(L, -1);
+        lua_pushnil(L);
+        lua_rawset(L, 2);
+    }
+    lua_createtable(L, 0, 4);
+    lua_pushvalue(L, 3);
+    lua_setfield(L, -2, "__index");
+    lua_pushvalue(L, 3);
+    lua_pushvalue(L, 1);
+    lua_pushcclosure(L, state_newindex, 2);
+    lua_setfield(L, -2, "__newindex");
+    lua_pushvalue(L, 3);
+    lua_pushcclosure(L, state_pairs, 1);
+    lua_setfield(L, -2, "__pairs");
+    lua_pushvalue(L, 3);
+    lua_pushcclosure(L, state_len, 1);
+    lua_setfield(L, -2, "__len");
+    lua_setmetatable(L, 2);
+    lua_pushvalue(L, 2);
+    return 1;
+}
+
+void clear_dirty_states(lua_State *L)
+{
+    lua_getfield(L, LUA_REGISTRYINDEX, "_kabletop_dirty");
+    lua_pushnil(L);
+    while (lua_next(L, -2))
+    {
+        lua_pop(L, 1);
+        lua_pushvalue(L, -1);
+        lua_pushnil(L);
+        lua_rawset(L, -4);
+    }
+    lua_pop(L, 1);
+}
 
 int inject_kabletop_functions(lua_State *L, int herr)
 {
     inject_ckb_functions(L);
 
-	// load internal code
-    luaL_dostring(L, "                  \
-        _winner = 0                     \
-        function _set_random_seed(x, y) \
-            math.randomseed(x, y)       \
-        end                             \
-    ");
+    // internal globals are set up from C so that no source chunk is needed
+    lua_pushinteger(L, 0);
+    lua_setglobal(L, "_winner");
+    lua_newtable(L);
+    lua_setglobal(L, "_calls");
+    lua_pushcfunction(L, set_random_seed);
+    lua_setglobal(L, "_set_random_seed");
+    lua_pushcfunction(L, track_state);
+    lua_setglobal(L, "_track_state");
+    // names of tracked states written since the current round began
+    lua_newtable(L);
+    lua_pushvalue(L, -1);
+    lua_setfield(L, LUA_REGISTRYINDEX, "_kabletop_dirty");
+    lua_setglobal(L, "_dirty");
+
+#ifdef KABLETOP_NOFLOAT
+    // integer-only profile, float math is removed and math.random must be called with integer
+    // bounds, divisions must use "//" since "/" raises an error in liblua-nofloat.a
+    const char *float_fields[] = { "sqrt", "sin", "cos", "tan", "asin", "acos", "atan", "exp", "log", "modf", "pi", "huge" };
+    lua_getglobal(L, "math");
+    lua_getfield(L, -1, "random");
+    lua_pushcclosure(L, integer_random, 1);
+    lua_setfield(L, -2, "random");
+    for (size_t i = 0; i < sizeof(float_fields) / sizeof(float_fields[0]); ++i)
+    {
+        lua_pushnil(L);
+        lua_setfield(L, -2, float_fields[i]);
+    }
+    lua_pop(L, 1);
+#endif
+    TRACE_INJECT(L);
 
 	// load native code
-    if (luaL_loadbuffer(L, (const char *)_GAME_CHUNK, _GAME_CHUNK_SIZE, "native")
-        || lua_pcall(L, 0, 0, herr))
+    if (_GAME_CHUNK_SIZE > 0
+        && (luaL_loadbufferx(L, (const char *)_GAME_CHUNK, _GAME_CHUNK_SIZE, "native", KABLETOP_CHUNK_MODE)
+            || lua_pcall(L, 0, 0, herr)))
     {
         ckb_debug("Invalid lua script: please check native code.");
         return KABLETOP_WRONG_LUA_CONTEXT_CODE;
@@ -28,16 +282,20 @@ int inject_kabletop_functions(lua_State *L, int herr)
     return CKB_SUCCESS;
 }
 
-int inject_celldep_functions(Kabletop *k, lua_State *L, int herr)
+int inject_celldep_functions(Kabletop *k, lua_State *L, int herr, uint8_t dictionary[MAX_LUACODE_SIZE])
 {
 	// molecule buffers
 	uint8_t data_hash[BLAKE2B_BLOCK_SIZE];
-	uint8_t luacode[MAX_LUACODE_SIZE];
+	uint8_t buffer[MAX_LUACODE_SIZE];
 
+	k->dictionary = dictionary;
+	k->dictionary_size = 0;
 	uint8_t hashes_count = _lua_code_hashes_count(k);
 	for (uint8_t h = 0; h < hashes_count; ++h)
 	{
 		bool matched = false;
+		// keep the first lua code alive for decompressing operations
+		uint8_t *luacode = h == 0 ? dictionary : buffer;
 		uint8_t *hash = _lua_code_hash(k, h);
 		for (size_t i = 0; 1; ++i)
 		{
@@ -60,9 +318,13 @@ int inject_celldep_functions(Kabletop *k, lua_State *L, int herr)
 			// load luacode from celldep data
 			size = MAX_LUACODE_SIZE;
 			ckb_load_cell_data(luacode, &size, 0, i, CKB_SOURCE_CELL_DEP);
+			if (h == 0)
+			{
+				k->dictionary_size = size;
+			}
 
 			// load celldep code
-			if (luaL_loadbuffer(L, (const char *)luacode, size, "celldep")
+			if (luaL_loadbufferx(L, (const char *)luacode, size, "celldep", KABLETOP_CHUNK_MODE)
 				|| lua_pcall(L, 0, 0, herr))
 			{
 				ckb_debug("Invalid lua script: please check celldep code.");
@@ -80,4 +342,409 @@ int inject_celldep_functions(Kabletop *k, lua_State *L, int herr)
 	return CKB_SUCCESS;
 }
 
+// compressed operation is OPERATION_COMPRESSED followed by LZ tokens, token 0x00-0x7f copies
+// next (token + 1) literal bytes and token 0x80-0xff copies (token & 0x7f) + 3 bytes from a
+// 2-byte little-endian distance behind, the window is dictionary followed by decompressed bytes
+size_t decompress_operation(Kabletop *k, const uint8_t *code, size_t size, uint8_t buffer[MAX_OPERATION_SIZE])
+{
+    size_t out = 0;
+    size_t p = 1;
+    while (p < size)
+    {
+        uint8_t token = code[p++];
+        if (token < 0x80)
+        {
+            size_t len = token + 1;
+            if (p + len > size || out + len > MAX_OPERATION_SIZE)
+            {
+                return 0;
+            }
+            memcpy(&buffer[out], &code[p], len);
+            p += len;
+            out += len;
+        }
+        else
+        {
+            size_t len = (token & 0x7f) + 3;
+            if (p + 2 > size || out + len > MAX_OPERATION_SIZE)
+            {
+                return 0;
+            }
+            size_t distance = code[p] | (code[p + 1] << 8);
+            p += 2;
+            if (distance == 0 || distance > out + k->dictionary_size)
+            {
+                return 0;
+            }
+            // copy byte by byte since match may overlap its own output
+            for (size_t n = 0; n < len; ++n, ++out)
+            {
+                buffer[out] = distance > out
+                    ? k->dictionary[k->dictionary_size - (distance - out)]
+                    : buffer[out - distance];
+            }
+        }
+    }
+    return out;
+}
+
+uint32_t fnv1a(const uint8_t *bytes, size_t size)
+{
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < size; ++i)
+    {
+        hash = (hash ^ bytes[i]) * 16777619u;
+    }
+    return hash;
+}
+
+// push compiled operation onto stack, identical operations of this run are compiled only once
+// and are looked up by hash and size then confirmed by their source bytes
+int load_kabletop_operation(Kabletop *k, lua_State *L, const uint8_t *code, size_t size)
+{
+    OperationCache *cache = &k->operation_cache;
+    if (lua_getfield(L, LUA_REGISTRYINDEX, "_kabletop_operations") != LUA_TTABLE)
+    {
+        lua_pop(L, 1);
+        lua_newtable(L);
+        lua_pushvalue(L, -1);
+        lua_setfield(L, LUA_REGISTRYINDEX, "_kabletop_operations");
+    }
+    uint32_t hash = fnv1a(code, size);
+    for (uint8_t e = 0; e < cache->count; ++e)
+    {
+        CachedOperation *entry = &cache->entries[e];
+        if (entry->hash == hash && entry->size == size
+            && memcmp(&cache->sources[entry->offset], code, size) == 0)
+        {
+            cache->hits += 1;
+            lua_rawgeti(L, -1, e + 1);
+            lua_remove(L, -2);
+            return LUA_OK;
+        }
+    }
+    cache->misses += 1;
+    int ret = luaL_loadbufferx(L, (const char *)code, size, "kabletop-running-operation", KABLETOP_CHUNK_MODE);
+    if (ret == LUA_OK && cache->count < OPERATION_CACHE_SIZE && cache->bytes + size <= MAX_OPERATION_CACHE_BYTES)
+    {
+        CachedOperation *entry = &cache->entries[cache->count];
+        entry->hash = hash;
+        entry->size = size;
+        entry->offset = cache->bytes;
+        memcpy(&cache->sources[cache->bytes], code, size);
+        cache->bytes += size;
+        cache->count += 1;
+        lua_pushvalue(L, -1);
+        lua_rawseti(L, -3, cache->count);
+    }
+    lua_remove(L, -2);
+    return ret;
+}
+
+// call operation is OPERATION_CALL followed by molecule Call, function is looked up by id
+// from lua global "_calls" which game libraries fill, arguments are pushed without parsing
+int call_kabletop_function(lua_State *L, int herr, const uint8_t *code, size_t size)
+{
+    mol_seg_t call = { (uint8_t *)code + 1, size - 1 };
+    if (MolReader_Call_verify(&call, false) != MOL_OK)
+    {
+        return KABLETOP_WRONG_OPERATION_ENCODING;
+    }
+    int top = lua_gettop(L);
+    uint16_t id = *(uint16_t *)MolReader_Call_get_function_id(&call).ptr;
+    lua_getglobal(L, "_calls");
+    if (lua_type(L, -1) != LUA_TTABLE || lua_rawgeti(L, -1, id) != LUA_TFUNCTION)
+    {
+        lua_settop(L, top);
+        return KABLETOP_WRONG_LUA_OPERATION_CODE;
+    }
+    lua_remove(L, -2);
+    mol_seg_t arguments = MolReader_Call_get_arguments(&call);
+    mol_num_t count = MolReader_Arguments_length(&arguments);
+    if (! lua_checkstack(L, count))
+    {
+        lua_settop(L, top);
+        return KABLETOP_WRONG_OPERATION_ENCODING;
+    }
+    for (mol_num_t i = 0; i < count; ++i)
+    {
+        mol_seg_t argument = MolReader_Arguments_get(&arguments, i).seg;
+        uint8_t kind = *(uint8_t *)MolReader_Argument_get_kind(&argument).ptr;
+        mol_seg_t data = MolReader_Argument_get_data(&argument);
+        data = MolReader_bytes_raw_bytes(&data);
+        if (kind == ARGUMENT_INTEGER && data.size == sizeof(int64_t))
+        {
+            int64_t value;
+            memcpy(&value, data.ptr, sizeof(int64_t));
+            lua_pushinteger(L, value);
+        }
+        else if (kind == ARGUMENT_STRING)
+        {
+            lua_pushlstring(L, (const char *)data.ptr, data.size);
+        }
+        else if (kind == ARGUMENT_BOOLEAN && data.size == 1)
+        {
+            lua_pushboolean(L, data.ptr[0]);
+        }
+        else
+        {
+            lua_settop(L, top);
+            return KABLETOP_WRONG_OPERATION_ENCODING;
+        }
+    }
+    if (lua_pcall(L, count, 0, herr))
+    {
+        lua_settop(L, top);
+        return KABLETOP_WRONG_LUA_OPERATION_CODE;
+    }
+    return CKB_SUCCESS;
+}
+
+#ifdef KABLETOP_FUSED_ROUNDS
+// every operation is fused as "do <operation>\n end", which is only equal to running it alone if it
+// can not escape its block, so operations containing a keyword able to close a block or return early,
+// opening a long bracket, continuing a string or loading as bytecode are not fused
+#define FUSED_ROUND_SIZE (MAX_ROUND_SIZE + MAX_OPERATIONS_PER_ROUND * 8)
+#define ROUND_NOT_FUSED -1
+
+typedef struct
+{
+    // first line of every operation in fused chunk, the operation which raised an error is
+    // found from the line its chunk was running at
+    uint32_t lines[MAX_OPERATIONS_PER_ROUND];
+    uint8_t count;
+    uint8_t failed;
+} FusedRound;
+
+bool identifier_char(uint8_t c)
+{
+    return c == '_' || (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9');
+}
+
+// keywords only match as whole identifiers, so that "spend" or "append" never block fusion
+bool contains(const uint8_t *code, size_t size, const char *token)
+{
+    size_t len = strlen(token);
+    bool keyword = identifier_char(token[0]);
+    for (size_t p = 0; p + len <= size; ++p)
+    {
+        if (memcmp(&code[p], token, len) == 0
+            && (! keyword || ((p == 0 || ! identifier_char(code[p - 1]))
+                && (p + len == size || ! identifier_char(code[p + len])))))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool fusible_operation(const uint8_t *code, size_t size)
+{
+    const char *blockers[] = { "end", "until", "return", "[[", "[=", "\\" };
+    if (size > 0 && (code[0] == OPERATION_COMPRESSED || code[0] == OPERATION_CALL || code[0] == LUA_SIGNATURE[0]))
+    {
+        return false;
+    }
+    for (size_t b = 0; b < sizeof(blockers) / sizeof(blockers[0]); ++b)
+    {
+        if (contains(code, size, blockers[b]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t fuse_kabletop_round(Kabletop *k, uint16_t i, uint8_t buffer[FUSED_ROUND_SIZE], FusedRound *fused)
+{
+    const char *head = "do ";
+    const char *tail = "\n end ";
+    size_t size = 0;
+    uint32_t line = 1;
+    DecodedRound *round = _decoded_round(k, i);
+    for (uint8_t n = 0; n < round->operations_count; ++n)
+    {
+        Operation operation = round->operation[n];
+        if (! fusible_operation(operation.code, operation.size)
+            || size + strlen(head) + operation.size + strlen(tail) > FUSED_ROUND_SIZE)
+        {
+            return 0;
+        }
+        fused->lines[n] = line;
+        // lines are counted the way lua lexer does, "\r\n" and "\n\r" are single line breaks
+        for (size_t p = 0; p < operation.size; ++p)
+        {
+            uint8_t c = operation.code[p];
+            if (c == '\n' || c == '\r')
+            {
+                line += 1;
+                p += p + 1 < operation.size && operation.code[p + 1] != c
+                    && (operation.code[p + 1] == '\n' || operation.code[p + 1] == '\r');
+            }
+        }
+        line += 1;
+        memcpy(&buffer[size], head, strlen(head));
+        size += strlen(head);
+        memcpy(&buffer[size], operation.code, operation.size);
+        size += operation.size;
+        memcpy(&buffer[size], tail, strlen(tail));
+        size += strlen(tail);
+    }
+    fused->count = round->operations_count;
+    fused->failed = 0;
+    return size;
+}
+
+// message handler of fused chunk, finds the operation from the line its main function was running
+// at, so that errors raised inside functions or celldep code are blamed on the operation calling
+// them like the per-operation path does, and then hands the error over to contract error handler
+int fused_error_handler(lua_State *L)
+{
+    FusedRound *fused = (FusedRound *)lua_touserdata(L, lua_upvalueindex(1));
+    lua_Debug ar;
+    for (int level = 1; lua_getstack(L, level, &ar); ++level)
+    {
+        lua_getinfo(L, "Sl", &ar);
+        if (strcmp(ar.what, "main") == 0 && strcmp(ar.source, "kabletop-running-operation") == 0
+            && ar.currentline > 0)
+        {
+            while (fused->failed + 1 < fused->count && fused->lines[fused->failed + 1] <= (uint32_t)ar.currentline)
+            {
+                fused->failed += 1;
+            }
+            break;
+        }
+    }
+    lua_pushvalue(L, lua_upvalueindex(2));
+    lua_pushvalue(L, 1);
+    lua_call(L, 1, 1);
+    return 1;
+}
+
+// run all operations of round as one chunk, returns ROUND_NOT_FUSED if round can not be fused or compiled
+// so that caller falls back to per-operation path which reports compile errors precisely
+int run_fused_kabletop_round(Kabletop *k, lua_State *L, int herr, uint16_t i)
+{
+    uint8_t buffer[FUSED_ROUND_SIZE];
+    FusedRound fused;
+    size_t size = fuse_kabletop_round(k, i, buffer, &fused);
+    if (size == 0)
+    {
+        return ROUND_NOT_FUSED;
+    }
+    lua_pushlightuserdata(L, &fused);
+    lua_pushvalue(L, herr);
+    lua_pushcclosure(L, fused_error_handler, 2);
+    if (load_kabletop_operation(k, L, buffer, size))
+    {
+        lua_pop(L, 2);
+        return ROUND_NOT_FUSED;
+    }
+    int ret = lua_pcall(L, 0, 0, -2);
+    lua_pop(L, ret ? 2 : 1);
+    if (ret)
+    {
+        char error[512] = "";
+        sprintf(error, "Invalid lua script: please check operation code [%u-%u].", i, fused.failed);
+        ckb_debug(error);
+        return KABLETOP_WRONG_LUA_OPERATION_CODE;
+    }
+    return CKB_SUCCESS;
+}
+#endif
+
+int run_kabletop_operations(Kabletop *k, lua_State *L, int herr, uint16_t i)
+{
+    uint8_t buffer[MAX_OPERATION_SIZE];
+#ifdef KABLETOP_FUSED_ROUNDS
+    int fused = run_fused_kabletop_round(k, L, herr, i);
+    if (fused != ROUND_NOT_FUSED)
+    {
+        return fused;
+    }
+#endif
+    DecodedRound *round = _decoded_round(k, i);
+    for (uint8_t n = 0; n < round->operations_count; ++n)
+    {
+        Operation operation = round->operation[n];
+        const uint8_t *code = operation.code;
+        size_t size = operation.size;
+        if (size > 0 && code[0] == OPERATION_COMPRESSED)
+        {
+            size = decompress_operation(k, code, size, buffer);
+            if (size == 0)
+            {
+                char error[512] = "";
+                sprintf(error, "Invalid compressed operation [%u-%u].", i, n);
+                ckb_debug(error);
+                return KABLETOP_WRONG_OPERATION_ENCODING;
+            }
+            code = buffer;
+        }
+        TRACE_OPERATION(i, n, fnv1a(code, size), size);
+        if (size > 0 && code[0] == OPERATION_CALL)
+        {
+            int ret = call_kabletop_function(L, herr, code, size);
+            if (ret != CKB_SUCCESS)
+            {
+                char error[512] = "";
+                sprintf(error, "Invalid call operation [%u-%u].", i, n);
+                ckb_debug(error);
+                return ret;
+            }
+        }
+        else if (load_kabletop_operation(k, L, code, size)
+            || lua_pcall(L, 0, 0, herr))
+        {
+            char error[512] = "";
+            sprintf(error, "Invalid lua script: please check operation code [%u-%u].", i, n);
+            ckb_debug(error);
+            return KABLETOP_WRONG_LUA_OPERATION_CODE;
+        }
+        TRACE_WINNER(L);
+    }
+    return CKB_SUCCESS;
+}
+
+// optional "_on_round_begin(i, user_type)" and "_on_round_end(i)" of game code are called
+// around operations of every round, so that per-turn bookkeeping needs no detection of its own
+int call_round_hook(lua_State *L, int herr, const char *hook, uint16_t i, int nargs)
+{
+    // arguments of the hook are already pushed
+    if (lua_getglobal(L, hook) != LUA_TFUNCTION)
+    {
+        lua_pop(L, 1 + nargs);
+        return CKB_SUCCESS;
+    }
+    lua_insert(L, -1 - nargs);
+    if (lua_pcall(L, nargs, 0, herr))
+    {
+        char error[512] = "";
+        sprintf(error, "Invalid lua script: please check %s [%u].", hook, i);
+        ckb_debug(error);
+        return KABLETOP_WRONG_LUA_OPERATION_CODE;
+    }
+    return CKB_SUCCESS;
+}
+
+int run_kabletop_round(Kabletop *k, lua_State *L, int herr, uint16_t i, Seed *seed)
+{
+    int ret = CKB_SUCCESS;
+    CHECK_RET(load_round(k, i));
+    lua_getglobal(L, "_set_random_seed");
+    lua_pushinteger(L, seed->randomseed[0]);
+    lua_pushinteger(L, seed->randomseed[1]);
+    lua_pcall(L, 2, 0, herr);
+    clear_dirty_states(L);
+    TRACE_ROUND_BEGIN(i, _user_type(k, i), seed);
+    lua_pushinteger(L, i);
+    lua_pushinteger(L, _user_type(k, i));
+    CHECK_RET(call_round_hook(L, herr, "_on_round_begin", i, 2));
+    CHECK_RET(run_kabletop_operations(k, L, herr, i));
+    lua_pushinteger(L, i);
+    CHECK_RET(call_round_hook(L, herr, "_on_round_end", i, 1));
+    TRACE_ROUND_END(L, i);
+    return CKB_SUCCESS;
+}
+
 #endif
\ No newline at end of file
@@ -0,0 +1,136 @@
+#ifndef CKB_LUA_KABLETOP_MEMORY
+#define CKB_LUA_KABLETOP_MEMORY
+
+#include "lauxlib.h"
+#include <stdio.h>
+
+// memory profile of a verification run, built with -DKABLETOP_MEMORY_PROFILE, reports the high-water
+// marks of stack and lua heap for every phase of plugin_verify, and sizes of its fixed buffers, through
+// debug output like:
+//   memory buffer: witnesses 32768
+//   memory profile: witnesses stack 1097760 lua 23184 lua peak 23184
+// a phase whose stack reached the heap is reported with "capped" at the end, its stack size is then
+// only a lower bound
+#ifdef KABLETOP_MEMORY_PROFILE
+
+// the stack grows down from the top of VM memory, where sp starts, towards the heap, which grows up
+// from _end of the binary by _sbrk of ckb-c-stdlib, so that the stack may run far below CKB_BRK_MAX
+// while the heap is small, the unused part between heap break and sp is painted with a pattern and
+// the first overwritten word above the break tells how deep the stack has gone
+#ifndef KABLETOP_STACK_TOP
+#define KABLETOP_STACK_TOP 0x400000
+#endif
+#define STACK_PAINT 0x5aa5c33c5aa5c33cull
+#define STACK_PAINT_GUARD 256
+
+extern char _end[];
+extern void *_sbrk(uintptr_t incr) __attribute__((weak));
+
+uintptr_t heap_break()
+{
+    uintptr_t brk = (uintptr_t)_end;
+    if (_sbrk)
+    {
+        uintptr_t current = (uintptr_t)_sbrk(0);
+        if (current != (uintptr_t)-1 && current > brk)
+        {
+            brk = current;
+        }
+    }
+    return (brk + 7) & ~(uintptr_t)7;
+}
+
+typedef struct
+{
+    lua_Alloc alloc;
+    void *ud;
+    size_t current;
+    size_t peak;
+} LuaHeapProfile;
+
+LuaHeapProfile lua_heap_profile;
+
+void *profile_lua_alloc(void *ud, void *ptr, size_t osize, size_t nsize)
+{
+    // osize only means the block size when ptr is not NULL, otherwise it is the lua object type
+    void *block = lua_heap_profile.alloc(lua_heap_profile.ud, ptr, osize, nsize);
+    size_t old_size = ptr ? osize : 0;
+    if (nsize == 0)
+    {
+        lua_heap_profile.current -= old_size;
+    }
+    else if (block)
+    {
+        lua_heap_profile.current += nsize - old_size;
+        if (lua_heap_profile.current > lua_heap_profile.peak)
+        {
+            lua_heap_profile.peak = lua_heap_profile.current;
+        }
+    }
+    return block;
+}
+
+__attribute__((noinline)) void paint_stack()
+{
+    uint64_t marker = 0;
+    uintptr_t end = ((uintptr_t)&marker - STACK_PAINT_GUARD) & ~(uintptr_t)7;
+    for (uintptr_t p = heap_break(); p < end; p += sizeof(uint64_t))
+    {
+        *(volatile uint64_t *)p = STACK_PAINT;
+    }
+}
+
+// scans up from the current break since the heap may have grown over painted words meanwhile,
+// capped is set when not even the lowest word is left, the stack met the heap or was never painted
+size_t scan_stack(int *capped)
+{
+    uintptr_t floor = heap_break();
+    uintptr_t p = floor;
+    while (p < KABLETOP_STACK_TOP && *(volatile uint64_t *)p == STACK_PAINT)
+    {
+        p += sizeof(uint64_t);
+    }
+    *capped = p == floor;
+    return KABLETOP_STACK_TOP - p;
+}
+
+void memory_profile_begin(lua_State *L)
+{
+    // blocks allocated before the allocator is wrapped are only known by lua's own gc count
+    lua_heap_profile.alloc = lua_getallocf(L, &lua_heap_profile.ud);
+    lua_heap_profile.current = lua_gc(L, LUA_GCCOUNT, 0) * 1024 + lua_gc(L, LUA_GCCOUNTB, 0);
+    lua_heap_profile.peak = lua_heap_profile.current;
+    lua_setallocf(L, profile_lua_alloc, NULL);
+    paint_stack();
+}
+
+void memory_profile_phase(const char *phase)
+{
+    // peaks restart from here so that every phase reports its own high-water marks
+    char profile[128] = "";
+    int capped = 0;
+    size_t stack = scan_stack(&capped);
+    sprintf(profile, "memory profile: %s stack %lu lua %lu lua peak %lu%s", phase, (unsigned long)stack,
+        (unsigned long)lua_heap_profile.current, (unsigned long)lua_heap_profile.peak, capped ? " capped" : "");
+    ckb_debug(profile);
+    lua_heap_profile.peak = lua_heap_profile.current;
+    paint_stack();
+}
+
+void memory_profile_buffer(const char *name, size_t size)
+{
+    char profile[128] = "";
+    sprintf(profile, "memory buffer: %s %lu", name, (unsigned long)size);
+    ckb_debug(profile);
+}
+
+#define MEMORY_PROFILE_BEGIN(L) memory_profile_begin(L)
+#define MEMORY_PROFILE_PHASE(phase) memory_profile_phase(phase)
+#define MEMORY_PROFILE_BUFFER(name, size) memory_profile_buffer(name, size)
+#else
+#define MEMORY_PROFILE_BEGIN(L)
+#define MEMORY_PROFILE_PHASE(phase)
+#define MEMORY_PROFILE_BUFFER(name, size)
+#endif
+
+#endif
@@ -24,6 +24,9 @@ extern "C" {
 
 #define                                 MolReader_uint8_t_verify(s, c)                  mol_verify_fixed_size(s, 1)
 #define                                 MolReader_uint8_t_get_nth0(s)                   mol_slice_by_offset(s, 0, 1)
+#define                                 MolReader_uint16_t_verify(s, c)                 mol_verify_fixed_size(s, 2)
+#define                                 MolReader_uint16_t_get_nth0(s)                  mol_slice_by_offset(s, 0, 1)
+#define                                 MolReader_uint16_t_get_nth1(s)                  mol_slice_by_offset(s, 1, 1)
 #define                                 MolReader_uint64_t_verify(s, c)                 mol_verify_fixed_size(s, 8)
 #define                                 MolReader_uint64_t_get_nth0(s)                  mol_slice_by_offset(s, 0, 1)
 #define                                 MolReader_uint64_t_get_nth1(s)                  mol_slice_by_offset(s, 1, 1)
@@ -171,6 +174,14 @@ MOLECULE_API_DECORATOR  mol_errno       MolReader_Round_verify
 #define                                 MolReader_Round_has_extra_fields(s)             mol_table_has_extra_fields(s, 2)
 #define                                 MolReader_Round_get_user_type(s)                mol_table_slice_by_index(s, 0)
 #define                                 MolReader_Round_get_operations(s)               mol_table_slice_by_index(s, 1)
+MOLECULE_API_DECORATOR  mol_errno       MolReader_SignedRound_verify                    (const mol_seg_t*, bool);
+#define                                 MolReader_SignedRound_actual_field_count(s)     mol_table_actual_field_count(s)
+#define                                 MolReader_SignedRound_has_extra_fields(s)       mol_table_has_extra_fields(s, 2)
+#define                                 MolReader_SignedRound_get_round(s)              mol_table_slice_by_index(s, 0)
+#define                                 MolReader_SignedRound_get_signature(s)          mol_table_slice_by_index(s, 1)
+MOLECULE_API_DECORATOR  mol_errno       MolReader_SignedRounds_verify                   (const mol_seg_t*, bool);
+#define                                 MolReader_SignedRounds_length(s)                mol_dynvec_length(s)
+#define                                 MolReader_SignedRounds_get(s, i)                mol_dynvec_slice_by_index(s, i)
 MOLECULE_API_DECORATOR  mol_errno       MolReader_Args_verify                           (const mol_seg_t*, bool);
 #define                                 MolReader_Args_actual_field_count(s)            mol_table_actual_field_count(s)
 #define                                 MolReader_Args_has_extra_fields(s)              mol_table_has_extra_fields(s, 9)
@@ -183,6 +194,41 @@ MOLECULE_API_DECORATOR  mol_errno       MolReader_Args_verify
 #define                                 MolReader_Args_get_user1_nfts(s)                mol_table_slice_by_index(s, 6)
 #define                                 MolReader_Args_get_user2_pkhash(s)              mol_table_slice_by_index(s, 7)
 #define                                 MolReader_Args_get_user2_nfts(s)                mol_table_slice_by_index(s, 8)
+MOLECULE_API_DECORATOR  mol_errno       MolReader_NftArgs_verify                        (const mol_seg_t*, bool);
+#define                                 MolReader_NftArgs_actual_field_count(s)         mol_table_actual_field_count(s)
+#define                                 MolReader_NftArgs_has_extra_fields(s)           mol_table_has_extra_fields(s, 10)
+#define                                 MolReader_NftArgs_get_user_staking_ckb(s)       mol_table_slice_by_index(s, 0)
+#define                                 MolReader_NftArgs_get_user_deck_size(s)         mol_table_slice_by_index(s, 1)
+#define                                 MolReader_NftArgs_get_begin_blocknumber(s)      mol_table_slice_by_index(s, 2)
+#define                                 MolReader_NftArgs_get_lock_code_hash(s)         mol_table_slice_by_index(s, 3)
+#define                                 MolReader_NftArgs_get_lua_code_hashes(s)        mol_table_slice_by_index(s, 4)
+#define                                 MolReader_NftArgs_get_user1_pkhash(s)           mol_table_slice_by_index(s, 5)
+#define                                 MolReader_NftArgs_get_user1_nfts(s)             mol_table_slice_by_index(s, 6)
+#define                                 MolReader_NftArgs_get_user2_pkhash(s)           mol_table_slice_by_index(s, 7)
+#define                                 MolReader_NftArgs_get_user2_nfts(s)             mol_table_slice_by_index(s, 8)
+#define                                 MolReader_NftArgs_get_nft_type_hashes(s)        mol_table_slice_by_index(s, 9)
+MOLECULE_API_DECORATOR  mol_errno       MolReader_MerkleArgs_verify                     (const mol_seg_t*, bool);
+#define                                 MolReader_MerkleArgs_actual_field_count(s)      mol_table_actual_field_count(s)
+#define                                 MolReader_MerkleArgs_has_extra_fields(s)        mol_table_has_extra_fields(s, 9)
+#define                                 MolReader_MerkleArgs_get_user_staking_ckb(s)    mol_table_slice_by_index(s, 0)
+#define                                 MolReader_MerkleArgs_get_user_deck_size(s)      mol_table_slice_by_index(s, 1)
+#define                                 MolReader_MerkleArgs_get_begin_blocknumber(s)   mol_table_slice_by_index(s, 2)
+#define                                 MolReader_MerkleArgs_get_lock_code_hash(s)      mol_table_slice_by_index(s, 3)
+#define                                 MolReader_MerkleArgs_get_lua_code_hashes(s)     mol_table_slice_by_index(s, 4)
+#define                                 MolReader_MerkleArgs_get_user1_pkhash(s)        mol_table_slice_by_index(s, 5)
+#define                                 MolReader_MerkleArgs_get_user1_nft_root(s)      mol_table_slice_by_index(s, 6)
+#define                                 MolReader_MerkleArgs_get_user2_pkhash(s)        mol_table_slice_by_index(s, 7)
+#define                                 MolReader_MerkleArgs_get_user2_nft_root(s)      mol_table_slice_by_index(s, 8)
+MOLECULE_API_DECORATOR  mol_errno       MolReader_Reveal_verify                         (const mol_seg_t*, bool);
+#define                                 MolReader_Reveal_actual_field_count(s)          mol_table_actual_field_count(s)
+#define                                 MolReader_Reveal_has_extra_fields(s)            mol_table_has_extra_fields(s, 4)
+#define                                 MolReader_Reveal_get_user_type(s)               mol_table_slice_by_index(s, 0)
+#define                                 MolReader_Reveal_get_index(s)                   mol_table_slice_by_index(s, 1)
+#define                                 MolReader_Reveal_get_nft(s)                     mol_table_slice_by_index(s, 2)
+#define                                 MolReader_Reveal_get_proof(s)                   mol_table_slice_by_index(s, 3)
+MOLECULE_API_DECORATOR  mol_errno       MolReader_Reveals_verify                        (const mol_seg_t*, bool);
+#define                                 MolReader_Reveals_length(s)                     mol_dynvec_length(s)
+#define                                 MolReader_Reveals_get(s, i)                     mol_dynvec_slice_by_index(s, i)
 MOLECULE_API_DECORATOR  mol_errno       MolReader_Challenge_verify                      (const mol_seg_t*, bool);
 #define                                 MolReader_Challenge_actual_field_count(s)       mol_table_actual_field_count(s)
 #define                                 MolReader_Challenge_has_extra_fields(s)         mol_table_has_extra_fields(s, 6)
@@ -192,6 +238,26 @@ MOLECULE_API_DECORATOR  mol_errno       MolReader_Challenge_verify
 #define                                 MolReader_Challenge_get_snapshot_hashproof(s)   mol_table_slice_by_index(s, 3)
 #define                                 MolReader_Challenge_get_snapshot_signature(s)   mol_table_slice_by_index(s, 4)
 #define                                 MolReader_Challenge_get_operations(s)           mol_table_slice_by_index(s, 5)
+MOLECULE_API_DECORATOR  mol_errno       MolReader_Argument_verify                       (const mol_seg_t*, bool);
+#define                                 MolReader_Argument_actual_field_count(s)        mol_table_actual_field_count(s)
+#define                                 MolReader_Argument_has_extra_fields(s)          mol_table_has_extra_fields(s, 2)
+#define                                 MolReader_Argument_get_kind(s)                  mol_table_slice_by_index(s, 0)
+#define                                 MolReader_Argument_get_data(s)                  mol_table_slice_by_index(s, 1)
+MOLECULE_API_DECORATOR  mol_errno       MolReader_Arguments_verify                      (const mol_seg_t*, bool);
+#define                                 MolReader_Arguments_length(s)                   mol_dynvec_length(s)
+#define                                 MolReader_Arguments_get(s, i)                   mol_dynvec_slice_by_index(s, i)
+MOLECULE_API_DECORATOR  mol_errno       MolReader_Call_verify                           (const mol_seg_t*, bool);
+#define                                 MolReader_Call_actual_field_count(s)            mol_table_actual_field_count(s)
+#define                                 MolReader_Call_has_extra_fields(s)              mol_table_has_extra_fields(s, 2)
+#define                                 MolReader_Call_get_function_id(s)               mol_table_slice_by_index(s, 0)
+#define                                 MolReader_Call_get_arguments(s)                 mol_table_slice_by_index(s, 1)
+MOLECULE_API_DECORATOR  mol_errno       MolReader_RoundLayout_verify                    (const mol_seg_t*, bool);
+#define                                 MolReader_RoundLayout_actual_field_count(s)     mol_table_actual_field_count(s)
+#define                                 MolReader_RoundLayout_has_extra_fields(s)       mol_table_has_extra_fields(s, 4)
+#define                                 MolReader_RoundLayout_get_offset(s)             mol_table_slice_by_index(s, 0)
+#define                                 MolReader_RoundLayout_get_count(s)              mol_table_slice_by_index(s, 1)
+#define                                 MolReader_RoundLayout_get_user1_output(s)       mol_table_slice_by_index(s, 2)
+#define                                 MolReader_RoundLayout_get_user2_output(s)       mol_table_slice_by_index(s, 3)
 
 /*
  * Builder APIs
@@ -201,6 +267,11 @@ MOLECULE_API_DECORATOR  mol_errno       MolReader_Challenge_verify
 #define                                 MolBuilder_uint8_t_set_nth0(b, p)               mol_builder_set_byte_by_offset(b, 0, p)
 #define                                 MolBuilder_uint8_t_build(b)                     mol_builder_finalize_simple(b)
 #define                                 MolBuilder_uint8_t_clear(b)                     mol_builder_discard(b)
+#define                                 MolBuilder_uint16_t_init(b)                     mol_builder_initialize_fixed_size(b, 2)
+#define                                 MolBuilder_uint16_t_set_nth0(b, p)              mol_builder_set_byte_by_offset(b, 0, p)
+#define                                 MolBuilder_uint16_t_set_nth1(b, p)              mol_builder_set_byte_by_offset(b, 1, p)
+#define                                 MolBuilder_uint16_t_build(b)                    mol_builder_finalize_simple(b)
+#define                                 MolBuilder_uint16_t_clear(b)                    mol_builder_discard(b)
 #define                                 MolBuilder_uint64_t_init(b)                     mol_builder_initialize_fixed_size(b, 8)
 #define                                 MolBuilder_uint64_t_set_nth0(b, p)              mol_builder_set_byte_by_offset(b, 0, p)
 #define                                 MolBuilder_uint64_t_set_nth1(b, p)              mol_builder_set_byte_by_offset(b, 1, p)
@@ -359,6 +430,15 @@ MOLECULE_API_DECORATOR  mol_errno       MolReader_Challenge_verify
 #define                                 MolBuilder_Round_set_operations(b, p, l)        mol_table_builder_add(b, 1, p, l)
 MOLECULE_API_DECORATOR  mol_seg_res_t   MolBuilder_Round_build                          (mol_builder_t);
 #define                                 MolBuilder_Round_clear(b)                       mol_builder_discard(b)
+#define                                 MolBuilder_SignedRound_init(b)                  mol_table_builder_initialize(b, 512, 2)
+#define                                 MolBuilder_SignedRound_set_round(b, p, l)       mol_table_builder_add(b, 0, p, l)
+#define                                 MolBuilder_SignedRound_set_signature(b, p, l)   mol_table_builder_add(b, 1, p, l)
+MOLECULE_API_DECORATOR  mol_seg_res_t   MolBuilder_SignedRound_build                    (mol_builder_t);
+#define                                 MolBuilder_SignedRound_clear(b)                 mol_builder_discard(b)
+#define                                 MolBuilder_SignedRounds_init(b)                 mol_builder_initialize_with_capacity(b, 64, 64)
+#define                                 MolBuilder_SignedRounds_push(b, p, l)           mol_dynvec_builder_push(b, p, l)
+#define                                 MolBuilder_SignedRounds_build(b)                mol_dynvec_builder_finalize(b)
+#define                                 MolBuilder_SignedRounds_clear(b)                mol_builder_discard(b)
 #define                                 MolBuilder_Args_init(b)                         mol_table_builder_initialize(b, 1024, 9)
 #define                                 MolBuilder_Args_set_user_staking_ckb(b, p, l)   mol_table_builder_add(b, 0, p, l)
 #define                                 MolBuilder_Args_set_user_deck_size(b, p, l)     mol_table_builder_add(b, 1, p, l)
@@ -371,6 +451,42 @@ MOLECULE_API_DECORATOR  mol_seg_res_t   MolBuilder_Round_build
 #define                                 MolBuilder_Args_set_user2_nfts(b, p, l)         mol_table_builder_add(b, 8, p, l)
 MOLECULE_API_DECORATOR  mol_seg_res_t   MolBuilder_Args_build                           (mol_builder_t);
 #define                                 MolBuilder_Args_clear(b)                        mol_builder_discard(b)
+#define                                 MolBuilder_NftArgs_init(b)                      mol_table_builder_initialize(b, 1024, 10)
+#define                                 MolBuilder_NftArgs_set_user_staking_ckb(b, p, l) mol_table_builder_add(b, 0, p, l)
+#define                                 MolBuilder_NftArgs_set_user_deck_size(b, p, l)  mol_table_builder_add(b, 1, p, l)
+#define                                 MolBuilder_NftArgs_set_begin_blocknumber(b, p, l) mol_table_builder_add(b, 2, p, l)
+#define                                 MolBuilder_NftArgs_set_lock_code_hash(b, p, l)  mol_table_builder_add(b, 3, p, l)
+#define                                 MolBuilder_NftArgs_set_lua_code_hashes(b, p, l) mol_table_builder_add(b, 4, p, l)
+#define                                 MolBuilder_NftArgs_set_user1_pkhash(b, p, l)    mol_table_builder_add(b, 5, p, l)
+#define                                 MolBuilder_NftArgs_set_user1_nfts(b, p, l)      mol_table_builder_add(b, 6, p, l)
+#define                                 MolBuilder_NftArgs_set_user2_pkhash(b, p, l)    mol_table_builder_add(b, 7, p, l)
+#define                                 MolBuilder_NftArgs_set_user2_nfts(b, p, l)      mol_table_builder_add(b, 8, p, l)
+#define                                 MolBuilder_NftArgs_set_nft_type_hashes(b, p, l) mol_table_builder_add(b, 9, p, l)
+MOLECULE_API_DECORATOR  mol_seg_res_t   MolBuilder_NftArgs_build                        (mol_builder_t);
+#define                                 MolBuilder_NftArgs_clear(b)                     mol_builder_discard(b)
+#define                                 MolBuilder_MerkleArgs_init(b)                   mol_table_builder_initialize(b, 1024, 9)
+#define                                 MolBuilder_MerkleArgs_set_user_staking_ckb(b, p, l) mol_table_builder_add(b, 0, p, l)
+#define                                 MolBuilder_MerkleArgs_set_user_deck_size(b, p, l) mol_table_builder_add(b, 1, p, l)
+#define                                 MolBuilder_MerkleArgs_set_begin_blocknumber(b, p, l) mol_table_builder_add(b, 2, p, l)
+#define                                 MolBuilder_MerkleArgs_set_lock_code_hash(b, p, l) mol_table_builder_add(b, 3, p, l)
+#define                                 MolBuilder_MerkleArgs_set_lua_code_hashes(b, p, l) mol_table_builder_add(b, 4, p, l)
+#define                                 MolBuilder_MerkleArgs_set_user1_pkhash(b, p, l) mol_table_builder_add(b, 5, p, l)
+#define                                 MolBuilder_MerkleArgs_set_user1_nft_root(b, p, l) mol_table_builder_add(b, 6, p, l)
+#define                                 MolBuilder_MerkleArgs_set_user2_pkhash(b, p, l) mol_table_builder_add(b, 7, p, l)
+#define                                 MolBuilder_MerkleArgs_set_user2_nft_root(b, p, l) mol_table_builder_add(b, 8, p, l)
+MOLECULE_API_DECORATOR  mol_seg_res_t   MolBuilder_MerkleArgs_build                     (mol_builder_t);
+#define                                 MolBuilder_MerkleArgs_clear(b)                  mol_builder_discard(b)
+#define                                 MolBuilder_Reveal_init(b)                       mol_table_builder_initialize(b, 256, 4)
+#define                                 MolBuilder_Reveal_set_user_type(b, p, l)        mol_table_builder_add(b, 0, p, l)
+#define                                 MolBuilder_Reveal_set_index(b, p, l)            mol_table_builder_add(b, 1, p, l)
+#define                                 MolBuilder_Reveal_set_nft(b, p, l)              mol_table_builder_add(b, 2, p, l)
+#define                                 MolBuilder_Reveal_set_proof(b, p, l)            mol_table_builder_add(b, 3, p, l)
+MOLECULE_API_DECORATOR  mol_seg_res_t   MolBuilder_Reveal_build                         (mol_builder_t);
+#define                                 MolBuilder_Reveal_clear(b)                      mol_builder_discard(b)
+#define                                 MolBuilder_Reveals_init(b)                      mol_builder_initialize_with_capacity(b, 64, 64)
+#define                                 MolBuilder_Reveals_push(b, p, l)                mol_dynvec_builder_push(b, p, l)
+#define                                 MolBuilder_Reveals_build(b)                     mol_dynvec_builder_finalize(b)
+#define                                 MolBuilder_Reveals_clear(b)                     mol_builder_discard(b)
 #define                                 MolBuilder_Challenge_init(b)                    mol_table_builder_initialize(b, 1024, 6)
 #define                                 MolBuilder_Challenge_set_count(b, p, l)         mol_table_builder_add(b, 0, p, l)
 #define                                 MolBuilder_Challenge_set_challenger(b, p, l)    mol_table_builder_add(b, 1, p, l)
@@ -380,6 +496,27 @@ MOLECULE_API_DECORATOR  mol_seg_res_t   MolBuilder_Args_build
 #define                                 MolBuilder_Challenge_set_operations(b, p, l)    mol_table_builder_add(b, 5, p, l)
 MOLECULE_API_DECORATOR  mol_seg_res_t   MolBuilder_Challenge_build                      (mol_builder_t);
 #define                                 MolBuilder_Challenge_clear(b)                   mol_builder_discard(b)
+#define                                 MolBuilder_Argument_init(b)                     mol_table_builder_initialize(b, 128, 2)
+#define                                 MolBuilder_Argument_set_kind(b, p, l)           mol_table_builder_add(b, 0, p, l)
+#define                                 MolBuilder_Argument_set_data(b, p, l)           mol_table_builder_add(b, 1, p, l)
+MOLECULE_API_DECORATOR  mol_seg_res_t   MolBuilder_Argument_build                       (mol_builder_t);
+#define                                 MolBuilder_Argument_clear(b)                    mol_builder_discard(b)
+#define                                 MolBuilder_Arguments_init(b)                    mol_builder_initialize_with_capacity(b, 64, 64)
+#define                                 MolBuilder_Arguments_push(b, p, l)              mol_dynvec_builder_push(b, p, l)
+#define                                 MolBuilder_Arguments_build(b)                   mol_dynvec_builder_finalize(b)
+#define                                 MolBuilder_Arguments_clear(b)                   mol_builder_discard(b)
+#define                                 MolBuilder_Call_init(b)                         mol_table_builder_initialize(b, 128, 2)
+#define                                 MolBuilder_Call_set_function_id(b, p, l)        mol_table_builder_add(b, 0, p, l)
+#define                                 MolBuilder_Call_set_arguments(b, p, l)          mol_table_builder_add(b, 1, p, l)
+MOLECULE_API_DECORATOR  mol_seg_res_t   MolBuilder_Call_build                           (mol_builder_t);
+#define                                 MolBuilder_Call_clear(b)                        mol_builder_discard(b)
+#define                                 MolBuilder_RoundLayout_init(b)                  mol_table_builder_initialize(b, 128, 4)
+#define                                 MolBuilder_RoundLayout_set_offset(b, p, l)      mol_table_builder_add(b, 0, p, l)
+#define                                 MolBuilder_RoundLayout_set_count(b, p, l)       mol_table_builder_add(b, 1, p, l)
+#define                                 MolBuilder_RoundLayout_set_user1_output(b, p, l) mol_table_builder_add(b, 2, p, l)
+#define                                 MolBuilder_RoundLayout_set_user2_output(b, p, l) mol_table_builder_add(b, 3, p, l)
+MOLECULE_API_DECORATOR  mol_seg_res_t   MolBuilder_RoundLayout_build                    (mol_builder_t);
+#define                                 MolBuilder_RoundLayout_clear(b)                 mol_builder_discard(b)
 
 /*
  * Default Value
@@ -388,6 +525,7 @@ MOLECULE_API_DECORATOR  mol_seg_res_t   MolBuilder_Challenge_build
 #define ____ 0x00
 
 MOLECULE_API_DECORATOR const uint8_t MolDefault_uint8_t[1]       =  {____};
+MOLECULE_API_DECORATOR const uint8_t MolDefault_uint16_t[2]      =  {____, ____};
 MOLECULE_API_DECORATOR const uint8_t MolDefault_uint64_t[8]      =  {
     ____, ____, ____, ____, ____, ____, ____, ____,
 };
@@ -416,6 +554,17 @@ MOLECULE_API_DECORATOR const uint8_t MolDefault_Round[17]        =  {
     0x11, ____, ____, ____, 0x0c, ____, ____, ____, 0x0d, ____, ____, ____,
     ____, 0x04, ____, ____, ____,
 };
+MOLECULE_API_DECORATOR const uint8_t MolDefault_SignedRound[94]  =  {
+    0x5e, ____, ____, ____, 0x0c, ____, ____, ____, 0x1d, ____, ____, ____,
+    0x11, ____, ____, ____, 0x0c, ____, ____, ____, 0x0d, ____, ____, ____,
+    ____, 0x04, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+};
+MOLECULE_API_DECORATOR const uint8_t MolDefault_SignedRounds[4]  =  {0x04, ____, ____, ____};
 MOLECULE_API_DECORATOR const uint8_t MolDefault_Args[141]        =  {
     0x8d, ____, ____, ____, 0x28, ____, ____, ____, 0x30, ____, ____, ____,
     0x31, ____, ____, ____, 0x39, ____, ____, ____, 0x59, ____, ____, ____,
@@ -430,10 +579,51 @@ MOLECULE_API_DECORATOR const uint8_t MolDefault_Args[141]        =  {
     ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
     ____, ____, ____, ____, ____, ____, ____, ____, ____,
 };
-MOLECULE_API_DECORATOR const uint8_t MolDefault_Challenge[132]   =  {
-    0x84, ____, ____, ____, 0x1c, ____, ____, ____, 0x1d, ____, ____, ____,
-    0x1e, ____, ____, ____, 0x1f, ____, ____, ____, 0x3f, ____, ____, ____,
-    0x80, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+MOLECULE_API_DECORATOR const uint8_t MolDefault_NftArgs[149]     =  {
+    0x95, ____, ____, ____, 0x2c, ____, ____, ____, 0x34, ____, ____, ____,
+    0x35, ____, ____, ____, 0x3d, ____, ____, ____, 0x5d, ____, ____, ____,
+    0x61, ____, ____, ____, 0x75, ____, ____, ____, 0x79, ____, ____, ____,
+    0x8d, ____, ____, ____, 0x91, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____,
+};
+MOLECULE_API_DECORATOR const uint8_t MolDefault_MerkleArgs[197]  =  {
+    0xc5, ____, ____, ____, 0x28, ____, ____, ____, 0x30, ____, ____, ____,
+    0x31, ____, ____, ____, 0x39, ____, ____, ____, 0x59, ____, ____, ____,
+    0x5d, ____, ____, ____, 0x71, ____, ____, ____, 0x91, ____, ____, ____,
+    0xa5, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____,
+};
+MOLECULE_API_DECORATOR const uint8_t MolDefault_Reveal[46]       =  {
+    0x2e, ____, ____, ____, 0x14, ____, ____, ____, 0x15, ____, ____, ____,
+    0x16, ____, ____, ____, 0x2a, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
+};
+MOLECULE_API_DECORATOR const uint8_t MolDefault_Reveals[4]       =  {0x04, ____, ____, ____};
+MOLECULE_API_DECORATOR const uint8_t MolDefault_Challenge[134]   =  {
+    0x86, ____, ____, ____, 0x1c, ____, ____, ____, 0x1e, ____, ____, ____,
+    0x1f, ____, ____, ____, 0x21, ____, ____, ____, 0x41, ____, ____, ____,
+    0x82, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
     ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
     ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
     ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
@@ -441,7 +631,22 @@ MOLECULE_API_DECORATOR const uint8_t MolDefault_Challenge[132]   =  {
     ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
     ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
     ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, ____,
-    ____, ____, ____, ____, ____, ____, ____, ____, 0x04, ____, ____, ____,
+    ____, ____, ____, ____, ____, ____, ____, ____, ____, ____, 0x04, ____,
+    ____, ____,
+};
+MOLECULE_API_DECORATOR const uint8_t MolDefault_Argument[17]     =  {
+    0x11, ____, ____, ____, 0x0c, ____, ____, ____, 0x0d, ____, ____, ____,
+    ____, ____, ____, ____, ____,
+};
+MOLECULE_API_DECORATOR const uint8_t MolDefault_Arguments[4]     =  {0x04, ____, ____, ____};
+MOLECULE_API_DECORATOR const uint8_t MolDefault_Call[18]         =  {
+    0x12, ____, ____, ____, 0x0c, ____, ____, ____, 0x0e, ____, ____, ____,
+    ____, ____, 0x04, ____, ____, ____,
+};
+MOLECULE_API_DECORATOR const uint8_t MolDefault_RoundLayout[28]  =  {
+    0x1c, ____, ____, ____, 0x14, ____, ____, ____, 0x16, ____, ____, ____,
+    0x18, ____, ____, ____, 0x1a, ____, ____, ____, ____, ____, ____, ____,
+    ____, ____, ____, ____,
 };
 
 #undef ____
@@ -553,6 +758,109 @@ MOLECULE_API_DECORATOR mol_errno MolReader_Round_verify (const mol_seg_t *input,
         }
     return MOL_OK;
 }
+MOLECULE_API_DECORATOR mol_errno MolReader_SignedRound_verify (const mol_seg_t *input, bool compatible) {
+    if (input->size < MOL_NUM_T_SIZE) {
+        return MOL_ERR_HEADER;
+    }
+    uint8_t *ptr = input->ptr;
+    mol_num_t total_size = mol_unpack_number(ptr);
+    if (input->size != total_size) {
+        return MOL_ERR_TOTAL_SIZE;
+    }
+    if (input->size < MOL_NUM_T_SIZE * 2) {
+        return MOL_ERR_HEADER;
+    }
+    ptr += MOL_NUM_T_SIZE;
+    mol_num_t offset = mol_unpack_number(ptr);
+    if (offset % 4 > 0 || offset < MOL_NUM_T_SIZE*2) {
+        return MOL_ERR_OFFSET;
+    }
+    mol_num_t field_count = offset / 4 - 1;
+    if (field_count < 2) {
+        return MOL_ERR_FIELD_COUNT;
+    } else if (!compatible && field_count > 2) {
+        return MOL_ERR_FIELD_COUNT;
+    }
+    if (input->size < MOL_NUM_T_SIZE*(field_count+1)){
+        return MOL_ERR_HEADER;
+    }
+    mol_num_t offsets[field_count+1];
+    offsets[0] = offset;
+    for (mol_num_t i=1; i<field_count; i++) {
+        ptr += MOL_NUM_T_SIZE;
+        offsets[i] = mol_unpack_number(ptr);
+        if (offsets[i-1] > offsets[i]) {
+            return MOL_ERR_OFFSET;
+        }
+    }
+    if (offsets[field_count-1] > total_size) {
+        return MOL_ERR_OFFSET;
+    }
+    offsets[field_count] = total_size;
+        mol_seg_t inner;
+        mol_errno errno;
+        inner.ptr = input->ptr + offsets[0];
+        inner.size = offsets[1] - offsets[0];
+        errno = MolReader_Round_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[1];
+        inner.size = offsets[2] - offsets[1];
+        errno = MolReader_signature_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+    return MOL_OK;
+}
+MOLECULE_API_DECORATOR mol_errno MolReader_SignedRounds_verify (const mol_seg_t *input, bool compatible) {
+    if (input->size < MOL_NUM_T_SIZE) {
+        return MOL_ERR_HEADER;
+    }
+    uint8_t *ptr = input->ptr;
+    mol_num_t total_size = mol_unpack_number(ptr);
+    if (input->size != total_size) {
+        return MOL_ERR_TOTAL_SIZE;
+    }
+    if (input->size == MOL_NUM_T_SIZE) {
+        return MOL_OK;
+    }
+    if (input->size < MOL_NUM_T_SIZE * 2) {
+        return MOL_ERR_HEADER;
+    }
+    ptr += MOL_NUM_T_SIZE;
+    mol_num_t offset = mol_unpack_number(ptr);
+    if (offset % 4 > 0 || offset < MOL_NUM_T_SIZE*2) {
+        return MOL_ERR_OFFSET;
+    }
+    mol_num_t item_count = offset / 4 - 1;
+    if (input->size < MOL_NUM_T_SIZE*(item_count+1)) {
+        return MOL_ERR_HEADER;
+    }
+    mol_num_t end;
+    for (mol_num_t i=1; i<item_count; i++) {
+        ptr += MOL_NUM_T_SIZE;
+        end = mol_unpack_number(ptr);
+        if (offset > end) {
+            return MOL_ERR_OFFSET;
+        }
+        mol_seg_t inner;
+        inner.ptr = input->ptr + offset;
+        inner.size = end - offset;
+        mol_errno errno = MolReader_SignedRound_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        offset = end;
+    }
+    if (offset > total_size) {
+        return MOL_ERR_OFFSET;
+    }
+    mol_seg_t inner;
+    inner.ptr = input->ptr + offset;
+    inner.size = total_size - offset;
+    return MolReader_SignedRound_verify(&inner, compatible);
+}
 MOLECULE_API_DECORATOR mol_errno MolReader_Args_verify (const mol_seg_t *input, bool compatible) {
     if (input->size < MOL_NUM_T_SIZE) {
         return MOL_ERR_HEADER;
@@ -650,7 +958,7 @@ MOLECULE_API_DECORATOR mol_errno MolReader_Args_verify (const mol_seg_t *input,
         }
     return MOL_OK;
 }
-MOLECULE_API_DECORATOR mol_errno MolReader_Challenge_verify (const mol_seg_t *input, bool compatible) {
+MOLECULE_API_DECORATOR mol_errno MolReader_NftArgs_verify (const mol_seg_t *input, bool compatible) {
     if (input->size < MOL_NUM_T_SIZE) {
         return MOL_ERR_HEADER;
     }
@@ -668,9 +976,9 @@ MOLECULE_API_DECORATOR mol_errno MolReader_Challenge_verify (const mol_seg_t *in
         return MOL_ERR_OFFSET;
     }
     mol_num_t field_count = offset / 4 - 1;
-    if (field_count < 6) {
+    if (field_count < 10) {
         return MOL_ERR_FIELD_COUNT;
-    } else if (!compatible && field_count > 6) {
+    } else if (!compatible && field_count > 10) {
         return MOL_ERR_FIELD_COUNT;
     }
     if (input->size < MOL_NUM_T_SIZE*(field_count+1)){
@@ -693,7 +1001,7 @@ MOLECULE_API_DECORATOR mol_errno MolReader_Challenge_verify (const mol_seg_t *in
         mol_errno errno;
         inner.ptr = input->ptr + offsets[0];
         inner.size = offsets[1] - offsets[0];
-        errno = MolReader_uint8_t_verify(&inner, compatible);
+        errno = MolReader_uint64_t_verify(&inner, compatible);
         if (errno != MOL_OK) {
             return MOL_ERR_DATA;
         }
@@ -705,7 +1013,7 @@ MOLECULE_API_DECORATOR mol_errno MolReader_Challenge_verify (const mol_seg_t *in
         }
         inner.ptr = input->ptr + offsets[2];
         inner.size = offsets[3] - offsets[2];
-        errno = MolReader_uint8_t_verify(&inner, compatible);
+        errno = MolReader_uint64_t_verify(&inner, compatible);
         if (errno != MOL_OK) {
             return MOL_ERR_DATA;
         }
@@ -717,101 +1025,998 @@ MOLECULE_API_DECORATOR mol_errno MolReader_Challenge_verify (const mol_seg_t *in
         }
         inner.ptr = input->ptr + offsets[4];
         inner.size = offsets[5] - offsets[4];
-        errno = MolReader_signature_verify(&inner, compatible);
+        errno = MolReader_Hashes_verify(&inner, compatible);
         if (errno != MOL_OK) {
             return MOL_ERR_DATA;
         }
         inner.ptr = input->ptr + offsets[5];
         inner.size = offsets[6] - offsets[5];
-        errno = MolReader_Operations_verify(&inner, compatible);
+        errno = MolReader_blake160_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[6];
+        inner.size = offsets[7] - offsets[6];
+        errno = MolReader_nfts_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[7];
+        inner.size = offsets[8] - offsets[7];
+        errno = MolReader_blake160_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[8];
+        inner.size = offsets[9] - offsets[8];
+        errno = MolReader_nfts_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[9];
+        inner.size = offsets[10] - offsets[9];
+        errno = MolReader_Hashes_verify(&inner, compatible);
         if (errno != MOL_OK) {
             return MOL_ERR_DATA;
         }
     return MOL_OK;
 }
-
-/*
- * Builder Functions
- */
-
-MOLECULE_API_DECORATOR mol_seg_res_t MolBuilder_Round_build (mol_builder_t builder) {
-    mol_seg_res_t res;
-    res.errno = MOL_OK;
-    mol_num_t offset = 12;
-    mol_num_t len;
-    res.seg.size = offset;
-    len = builder.number_ptr[1];
-    res.seg.size += len == 0 ? 1 : len;
-    len = builder.number_ptr[3];
-    res.seg.size += len == 0 ? 4 : len;
-    res.seg.ptr = (uint8_t*)malloc(res.seg.size);
-    uint8_t *dst = res.seg.ptr;
-    mol_pack_number(dst, &res.seg.size);
-    dst += MOL_NUM_T_SIZE;
-    mol_pack_number(dst, &offset);
-    dst += MOL_NUM_T_SIZE;
-    len = builder.number_ptr[1];
-    offset += len == 0 ? 1 : len;
-    mol_pack_number(dst, &offset);
-    dst += MOL_NUM_T_SIZE;
-    len = builder.number_ptr[3];
-    offset += len == 0 ? 4 : len;
-    uint8_t *src = builder.data_ptr;
-    len = builder.number_ptr[1];
-    if (len == 0) {
-        len = 1;
-        memcpy(dst, &MolDefault_uint8_t, len);
-    } else {
-        mol_num_t of = builder.number_ptr[0];
-        memcpy(dst, src+of, len);
+MOLECULE_API_DECORATOR mol_errno MolReader_MerkleArgs_verify (const mol_seg_t *input, bool compatible) {
+    if (input->size < MOL_NUM_T_SIZE) {
+        return MOL_ERR_HEADER;
     }
-    dst += len;
-    len = builder.number_ptr[3];
-    if (len == 0) {
-        len = 4;
-        memcpy(dst, &MolDefault_Operations, len);
-    } else {
-        mol_num_t of = builder.number_ptr[2];
-        memcpy(dst, src+of, len);
+    uint8_t *ptr = input->ptr;
+    mol_num_t total_size = mol_unpack_number(ptr);
+    if (input->size != total_size) {
+        return MOL_ERR_TOTAL_SIZE;
     }
-    dst += len;
-    mol_builder_discard(builder);
-    return res;
-}
-MOLECULE_API_DECORATOR mol_seg_res_t MolBuilder_Args_build (mol_builder_t builder) {
-    mol_seg_res_t res;
-    res.errno = MOL_OK;
-    mol_num_t offset = 40;
-    mol_num_t len;
-    res.seg.size = offset;
-    len = builder.number_ptr[1];
-    res.seg.size += len == 0 ? 8 : len;
-    len = builder.number_ptr[3];
-    res.seg.size += len == 0 ? 1 : len;
-    len = builder.number_ptr[5];
-    res.seg.size += len == 0 ? 8 : len;
-    len = builder.number_ptr[7];
-    res.seg.size += len == 0 ? 32 : len;
-    len = builder.number_ptr[9];
-    res.seg.size += len == 0 ? 4 : len;
-    len = builder.number_ptr[11];
-    res.seg.size += len == 0 ? 20 : len;
-    len = builder.number_ptr[13];
-    res.seg.size += len == 0 ? 4 : len;
-    len = builder.number_ptr[15];
-    res.seg.size += len == 0 ? 20 : len;
-    len = builder.number_ptr[17];
-    res.seg.size += len == 0 ? 4 : len;
-    res.seg.ptr = (uint8_t*)malloc(res.seg.size);
-    uint8_t *dst = res.seg.ptr;
-    mol_pack_number(dst, &res.seg.size);
-    dst += MOL_NUM_T_SIZE;
-    mol_pack_number(dst, &offset);
-    dst += MOL_NUM_T_SIZE;
-    len = builder.number_ptr[1];
-    offset += len == 0 ? 8 : len;
-    mol_pack_number(dst, &offset);
-    dst += MOL_NUM_T_SIZE;
+    if (input->size < MOL_NUM_T_SIZE * 2) {
+        return MOL_ERR_HEADER;
+    }
+    ptr += MOL_NUM_T_SIZE;
+    mol_num_t offset = mol_unpack_number(ptr);
+    if (offset % 4 > 0 || offset < MOL_NUM_T_SIZE*2) {
+        return MOL_ERR_OFFSET;
+    }
+    mol_num_t field_count = offset / 4 - 1;
+    if (field_count < 9) {
+        return MOL_ERR_FIELD_COUNT;
+    } else if (!compatible && field_count > 9) {
+        return MOL_ERR_FIELD_COUNT;
+    }
+    if (input->size < MOL_NUM_T_SIZE*(field_count+1)){
+        return MOL_ERR_HEADER;
+    }
+    mol_num_t offsets[field_count+1];
+    offsets[0] = offset;
+    for (mol_num_t i=1; i<field_count; i++) {
+        ptr += MOL_NUM_T_SIZE;
+        offsets[i] = mol_unpack_number(ptr);
+        if (offsets[i-1] > offsets[i]) {
+            return MOL_ERR_OFFSET;
+        }
+    }
+    if (offsets[field_count-1] > total_size) {
+        return MOL_ERR_OFFSET;
+    }
+    offsets[field_count] = total_size;
+        mol_seg_t inner;
+        mol_errno errno;
+        inner.ptr = input->ptr + offsets[0];
+        inner.size = offsets[1] - offsets[0];
+        errno = MolReader_uint64_t_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[1];
+        inner.size = offsets[2] - offsets[1];
+        errno = MolReader_uint8_t_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[2];
+        inner.size = offsets[3] - offsets[2];
+        errno = MolReader_uint64_t_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[3];
+        inner.size = offsets[4] - offsets[3];
+        errno = MolReader_blake256_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[4];
+        inner.size = offsets[5] - offsets[4];
+        errno = MolReader_Hashes_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[5];
+        inner.size = offsets[6] - offsets[5];
+        errno = MolReader_blake160_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[6];
+        inner.size = offsets[7] - offsets[6];
+        errno = MolReader_blake256_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[7];
+        inner.size = offsets[8] - offsets[7];
+        errno = MolReader_blake160_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[8];
+        inner.size = offsets[9] - offsets[8];
+        errno = MolReader_blake256_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+    return MOL_OK;
+}
+MOLECULE_API_DECORATOR mol_errno MolReader_Reveal_verify (const mol_seg_t *input, bool compatible) {
+    if (input->size < MOL_NUM_T_SIZE) {
+        return MOL_ERR_HEADER;
+    }
+    uint8_t *ptr = input->ptr;
+    mol_num_t total_size = mol_unpack_number(ptr);
+    if (input->size != total_size) {
+        return MOL_ERR_TOTAL_SIZE;
+    }
+    if (input->size < MOL_NUM_T_SIZE * 2) {
+        return MOL_ERR_HEADER;
+    }
+    ptr += MOL_NUM_T_SIZE;
+    mol_num_t offset = mol_unpack_number(ptr);
+    if (offset % 4 > 0 || offset < MOL_NUM_T_SIZE*2) {
+        return MOL_ERR_OFFSET;
+    }
+    mol_num_t field_count = offset / 4 - 1;
+    if (field_count < 4) {
+        return MOL_ERR_FIELD_COUNT;
+    } else if (!compatible && field_count > 4) {
+        return MOL_ERR_FIELD_COUNT;
+    }
+    if (input->size < MOL_NUM_T_SIZE*(field_count+1)){
+        return MOL_ERR_HEADER;
+    }
+    mol_num_t offsets[field_count+1];
+    offsets[0] = offset;
+    for (mol_num_t i=1; i<field_count; i++) {
+        ptr += MOL_NUM_T_SIZE;
+        offsets[i] = mol_unpack_number(ptr);
+        if (offsets[i-1] > offsets[i]) {
+            return MOL_ERR_OFFSET;
+        }
+    }
+    if (offsets[field_count-1] > total_size) {
+        return MOL_ERR_OFFSET;
+    }
+    offsets[field_count] = total_size;
+        mol_seg_t inner;
+        mol_errno errno;
+        inner.ptr = input->ptr + offsets[0];
+        inner.size = offsets[1] - offsets[0];
+        errno = MolReader_uint8_t_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[1];
+        inner.size = offsets[2] - offsets[1];
+        errno = MolReader_uint8_t_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[2];
+        inner.size = offsets[3] - offsets[2];
+        errno = MolReader_blake160_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[3];
+        inner.size = offsets[4] - offsets[3];
+        errno = MolReader_Hashes_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+    return MOL_OK;
+}
+MOLECULE_API_DECORATOR mol_errno MolReader_Reveals_verify (const mol_seg_t *input, bool compatible) {
+    if (input->size < MOL_NUM_T_SIZE) {
+        return MOL_ERR_HEADER;
+    }
+    uint8_t *ptr = input->ptr;
+    mol_num_t total_size = mol_unpack_number(ptr);
+    if (input->size != total_size) {
+        return MOL_ERR_TOTAL_SIZE;
+    }
+    if (input->size == MOL_NUM_T_SIZE) {
+        return MOL_OK;
+    }
+    if (input->size < MOL_NUM_T_SIZE * 2) {
+        return MOL_ERR_HEADER;
+    }
+    ptr += MOL_NUM_T_SIZE;
+    mol_num_t offset = mol_unpack_number(ptr);
+    if (offset % 4 > 0 || offset < MOL_NUM_T_SIZE*2) {
+        return MOL_ERR_OFFSET;
+    }
+    mol_num_t item_count = offset / 4 - 1;
+    if (input->size < MOL_NUM_T_SIZE*(item_count+1)) {
+        return MOL_ERR_HEADER;
+    }
+    mol_num_t end;
+    for (mol_num_t i=1; i<item_count; i++) {
+        ptr += MOL_NUM_T_SIZE;
+        end = mol_unpack_number(ptr);
+        if (offset > end) {
+            return MOL_ERR_OFFSET;
+        }
+        mol_seg_t inner;
+        inner.ptr = input->ptr + offset;
+        inner.size = end - offset;
+        mol_errno errno = MolReader_Reveal_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        offset = end;
+    }
+    if (offset > total_size) {
+        return MOL_ERR_OFFSET;
+    }
+    mol_seg_t inner;
+    inner.ptr = input->ptr + offset;
+    inner.size = total_size - offset;
+    return MolReader_Reveal_verify(&inner, compatible);
+}
+MOLECULE_API_DECORATOR mol_errno MolReader_Challenge_verify (const mol_seg_t *input, bool compatible) {
+    if (input->size < MOL_NUM_T_SIZE) {
+        return MOL_ERR_HEADER;
+    }
+    uint8_t *ptr = input->ptr;
+    mol_num_t total_size = mol_unpack_number(ptr);
+    if (input->size != total_size) {
+        return MOL_ERR_TOTAL_SIZE;
+    }
+    if (input->size < MOL_NUM_T_SIZE * 2) {
+        return MOL_ERR_HEADER;
+    }
+    ptr += MOL_NUM_T_SIZE;
+    mol_num_t offset = mol_unpack_number(ptr);
+    if (offset % 4 > 0 || offset < MOL_NUM_T_SIZE*2) {
+        return MOL_ERR_OFFSET;
+    }
+    mol_num_t field_count = offset / 4 - 1;
+    if (field_count < 6) {
+        return MOL_ERR_FIELD_COUNT;
+    } else if (!compatible && field_count > 6) {
+        return MOL_ERR_FIELD_COUNT;
+    }
+    if (input->size < MOL_NUM_T_SIZE*(field_count+1)){
+        return MOL_ERR_HEADER;
+    }
+    mol_num_t offsets[field_count+1];
+    offsets[0] = offset;
+    for (mol_num_t i=1; i<field_count; i++) {
+        ptr += MOL_NUM_T_SIZE;
+        offsets[i] = mol_unpack_number(ptr);
+        if (offsets[i-1] > offsets[i]) {
+            return MOL_ERR_OFFSET;
+        }
+    }
+    if (offsets[field_count-1] > total_size) {
+        return MOL_ERR_OFFSET;
+    }
+    offsets[field_count] = total_size;
+        mol_seg_t inner;
+        mol_errno errno;
+        inner.ptr = input->ptr + offsets[0];
+        inner.size = offsets[1] - offsets[0];
+        errno = MolReader_uint16_t_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[1];
+        inner.size = offsets[2] - offsets[1];
+        errno = MolReader_uint8_t_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[2];
+        inner.size = offsets[3] - offsets[2];
+        errno = MolReader_uint16_t_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[3];
+        inner.size = offsets[4] - offsets[3];
+        errno = MolReader_blake256_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[4];
+        inner.size = offsets[5] - offsets[4];
+        errno = MolReader_signature_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[5];
+        inner.size = offsets[6] - offsets[5];
+        errno = MolReader_Operations_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+    return MOL_OK;
+}
+MOLECULE_API_DECORATOR mol_errno MolReader_Argument_verify (const mol_seg_t *input, bool compatible) {
+    if (input->size < MOL_NUM_T_SIZE) {
+        return MOL_ERR_HEADER;
+    }
+    uint8_t *ptr = input->ptr;
+    mol_num_t total_size = mol_unpack_number(ptr);
+    if (input->size != total_size) {
+        return MOL_ERR_TOTAL_SIZE;
+    }
+    if (input->size < MOL_NUM_T_SIZE * 2) {
+        return MOL_ERR_HEADER;
+    }
+    ptr += MOL_NUM_T_SIZE;
+    mol_num_t offset = mol_unpack_number(ptr);
+    if (offset % 4 > 0 || offset < MOL_NUM_T_SIZE*2) {
+        return MOL_ERR_OFFSET;
+    }
+    mol_num_t field_count = offset / 4 - 1;
+    if (field_count < 2) {
+        return MOL_ERR_FIELD_COUNT;
+    } else if (!compatible && field_count > 2) {
+        return MOL_ERR_FIELD_COUNT;
+    }
+    if (input->size < MOL_NUM_T_SIZE*(field_count+1)){
+        return MOL_ERR_HEADER;
+    }
+    mol_num_t offsets[field_count+1];
+    offsets[0] = offset;
+    for (mol_num_t i=1; i<field_count; i++) {
+        ptr += MOL_NUM_T_SIZE;
+        offsets[i] = mol_unpack_number(ptr);
+        if (offsets[i-1] > offsets[i]) {
+            return MOL_ERR_OFFSET;
+        }
+    }
+    if (offsets[field_count-1] > total_size) {
+        return MOL_ERR_OFFSET;
+    }
+    offsets[field_count] = total_size;
+        mol_seg_t inner;
+        mol_errno errno;
+        inner.ptr = input->ptr + offsets[0];
+        inner.size = offsets[1] - offsets[0];
+        errno = MolReader_uint8_t_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[1];
+        inner.size = offsets[2] - offsets[1];
+        errno = MolReader_bytes_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+    return MOL_OK;
+}
+MOLECULE_API_DECORATOR mol_errno MolReader_Arguments_verify (const mol_seg_t *input, bool compatible) {
+    if (input->size < MOL_NUM_T_SIZE) {
+        return MOL_ERR_HEADER;
+    }
+    uint8_t *ptr = input->ptr;
+    mol_num_t total_size = mol_unpack_number(ptr);
+    if (input->size != total_size) {
+        return MOL_ERR_TOTAL_SIZE;
+    }
+    if (input->size == MOL_NUM_T_SIZE) {
+        return MOL_OK;
+    }
+    if (input->size < MOL_NUM_T_SIZE * 2) {
+        return MOL_ERR_HEADER;
+    }
+    ptr += MOL_NUM_T_SIZE;
+    mol_num_t offset = mol_unpack_number(ptr);
+    if (offset % 4 > 0 || offset < MOL_NUM_T_SIZE*2) {
+        return MOL_ERR_OFFSET;
+    }
+    mol_num_t item_count = offset / 4 - 1;
+    if (input->size < MOL_NUM_T_SIZE*(item_count+1)) {
+        return MOL_ERR_HEADER;
+    }
+    mol_num_t end;
+    for (mol_num_t i=1; i<item_count; i++) {
+        ptr += MOL_NUM_T_SIZE;
+        end = mol_unpack_number(ptr);
+        if (offset > end) {
+            return MOL_ERR_OFFSET;
+        }
+        mol_seg_t inner;
+        inner.ptr = input->ptr + offset;
+        inner.size = end - offset;
+        mol_errno errno = MolReader_Argument_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        offset = end;
+    }
+    if (offset > total_size) {
+        return MOL_ERR_OFFSET;
+    }
+    mol_seg_t inner;
+    inner.ptr = input->ptr + offset;
+    inner.size = total_size - offset;
+    return MolReader_Argument_verify(&inner, compatible);
+}
+MOLECULE_API_DECORATOR mol_errno MolReader_Call_verify (const mol_seg_t *input, bool compatible) {
+    if (input->size < MOL_NUM_T_SIZE) {
+        return MOL_ERR_HEADER;
+    }
+    uint8_t *ptr = input->ptr;
+    mol_num_t total_size = mol_unpack_number(ptr);
+    if (input->size != total_size) {
+        return MOL_ERR_TOTAL_SIZE;
+    }
+    if (input->size < MOL_NUM_T_SIZE * 2) {
+        return MOL_ERR_HEADER;
+    }
+    ptr += MOL_NUM_T_SIZE;
+    mol_num_t offset = mol_unpack_number(ptr);
+    if (offset % 4 > 0 || offset < MOL_NUM_T_SIZE*2) {
+        return MOL_ERR_OFFSET;
+    }
+    mol_num_t field_count = offset / 4 - 1;
+    if (field_count < 2) {
+        return MOL_ERR_FIELD_COUNT;
+    } else if (!compatible && field_count > 2) {
+        return MOL_ERR_FIELD_COUNT;
+    }
+    if (input->size < MOL_NUM_T_SIZE*(field_count+1)){
+        return MOL_ERR_HEADER;
+    }
+    mol_num_t offsets[field_count+1];
+    offsets[0] = offset;
+    for (mol_num_t i=1; i<field_count; i++) {
+        ptr += MOL_NUM_T_SIZE;
+        offsets[i] = mol_unpack_number(ptr);
+        if (offsets[i-1] > offsets[i]) {
+            return MOL_ERR_OFFSET;
+        }
+    }
+    if (offsets[field_count-1] > total_size) {
+        return MOL_ERR_OFFSET;
+    }
+    offsets[field_count] = total_size;
+        mol_seg_t inner;
+        mol_errno errno;
+        inner.ptr = input->ptr + offsets[0];
+        inner.size = offsets[1] - offsets[0];
+        errno = MolReader_uint16_t_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[1];
+        inner.size = offsets[2] - offsets[1];
+        errno = MolReader_Arguments_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+    return MOL_OK;
+}
+MOLECULE_API_DECORATOR mol_errno MolReader_RoundLayout_verify (const mol_seg_t *input, bool compatible) {
+    if (input->size < MOL_NUM_T_SIZE) {
+        return MOL_ERR_HEADER;
+    }
+    uint8_t *ptr = input->ptr;
+    mol_num_t total_size = mol_unpack_number(ptr);
+    if (input->size != total_size) {
+        return MOL_ERR_TOTAL_SIZE;
+    }
+    if (input->size < MOL_NUM_T_SIZE * 2) {
+        return MOL_ERR_HEADER;
+    }
+    ptr += MOL_NUM_T_SIZE;
+    mol_num_t offset = mol_unpack_number(ptr);
+    if (offset % 4 > 0 || offset < MOL_NUM_T_SIZE*2) {
+        return MOL_ERR_OFFSET;
+    }
+    mol_num_t field_count = offset / 4 - 1;
+    if (field_count < 4) {
+        return MOL_ERR_FIELD_COUNT;
+    } else if (!compatible && field_count > 4) {
+        return MOL_ERR_FIELD_COUNT;
+    }
+    if (input->size < MOL_NUM_T_SIZE*(field_count+1)){
+        return MOL_ERR_HEADER;
+    }
+    mol_num_t offsets[field_count+1];
+    offsets[0] = offset;
+    for (mol_num_t i=1; i<field_count; i++) {
+        ptr += MOL_NUM_T_SIZE;
+        offsets[i] = mol_unpack_number(ptr);
+        if (offsets[i-1] > offsets[i]) {
+            return MOL_ERR_OFFSET;
+        }
+    }
+    if (offsets[field_count-1] > total_size) {
+        return MOL_ERR_OFFSET;
+    }
+    offsets[field_count] = total_size;
+        mol_seg_t inner;
+        mol_errno errno;
+        inner.ptr = input->ptr + offsets[0];
+        inner.size = offsets[1] - offsets[0];
+        errno = MolReader_uint16_t_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[1];
+        inner.size = offsets[2] - offsets[1];
+        errno = MolReader_uint16_t_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[2];
+        inner.size = offsets[3] - offsets[2];
+        errno = MolReader_uint16_t_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+        inner.ptr = input->ptr + offsets[3];
+        inner.size = offsets[4] - offsets[3];
+        errno = MolReader_uint16_t_verify(&inner, compatible);
+        if (errno != MOL_OK) {
+            return MOL_ERR_DATA;
+        }
+    return MOL_OK;
+}
+
+/*
+ * Builder Functions
+ */
+
+MOLECULE_API_DECORATOR mol_seg_res_t MolBuilder_Round_build (mol_builder_t builder) {
+    mol_seg_res_t res;
+    res.errno = MOL_OK;
+    mol_num_t offset = 12;
+    mol_num_t len;
+    res.seg.size = offset;
+    len = builder.number_ptr[1];
+    res.seg.size += len == 0 ? 1 : len;
+    len = builder.number_ptr[3];
+    res.seg.size += len == 0 ? 4 : len;
+    res.seg.ptr = (uint8_t*)malloc(res.seg.size);
+    uint8_t *dst = res.seg.ptr;
+    mol_pack_number(dst, &res.seg.size);
+    dst += MOL_NUM_T_SIZE;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[1];
+    offset += len == 0 ? 1 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[3];
+    offset += len == 0 ? 4 : len;
+    uint8_t *src = builder.data_ptr;
+    len = builder.number_ptr[1];
+    if (len == 0) {
+        len = 1;
+        memcpy(dst, &MolDefault_uint8_t, len);
+    } else {
+        mol_num_t of = builder.number_ptr[0];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[3];
+    if (len == 0) {
+        len = 4;
+        memcpy(dst, &MolDefault_Operations, len);
+    } else {
+        mol_num_t of = builder.number_ptr[2];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    mol_builder_discard(builder);
+    return res;
+}
+MOLECULE_API_DECORATOR mol_seg_res_t MolBuilder_SignedRound_build (mol_builder_t builder) {
+    mol_seg_res_t res;
+    res.errno = MOL_OK;
+    mol_num_t offset = 12;
+    mol_num_t len;
+    res.seg.size = offset;
+    len = builder.number_ptr[1];
+    res.seg.size += len == 0 ? 17 : len;
+    len = builder.number_ptr[3];
+    res.seg.size += len == 0 ? 65 : len;
+    res.seg.ptr = (uint8_t*)malloc(res.seg.size);
+    uint8_t *dst = res.seg.ptr;
+    mol_pack_number(dst, &res.seg.size);
+    dst += MOL_NUM_T_SIZE;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[1];
+    offset += len == 0 ? 17 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[3];
+    offset += len == 0 ? 65 : len;
+    uint8_t *src = builder.data_ptr;
+    len = builder.number_ptr[1];
+    if (len == 0) {
+        len = 17;
+        memcpy(dst, &MolDefault_Round, len);
+    } else {
+        mol_num_t of = builder.number_ptr[0];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[3];
+    if (len == 0) {
+        len = 65;
+        memcpy(dst, &MolDefault_signature, len);
+    } else {
+        mol_num_t of = builder.number_ptr[2];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    mol_builder_discard(builder);
+    return res;
+}
+MOLECULE_API_DECORATOR mol_seg_res_t MolBuilder_Args_build (mol_builder_t builder) {
+    mol_seg_res_t res;
+    res.errno = MOL_OK;
+    mol_num_t offset = 40;
+    mol_num_t len;
+    res.seg.size = offset;
+    len = builder.number_ptr[1];
+    res.seg.size += len == 0 ? 8 : len;
+    len = builder.number_ptr[3];
+    res.seg.size += len == 0 ? 1 : len;
+    len = builder.number_ptr[5];
+    res.seg.size += len == 0 ? 8 : len;
+    len = builder.number_ptr[7];
+    res.seg.size += len == 0 ? 32 : len;
+    len = builder.number_ptr[9];
+    res.seg.size += len == 0 ? 4 : len;
+    len = builder.number_ptr[11];
+    res.seg.size += len == 0 ? 20 : len;
+    len = builder.number_ptr[13];
+    res.seg.size += len == 0 ? 4 : len;
+    len = builder.number_ptr[15];
+    res.seg.size += len == 0 ? 20 : len;
+    len = builder.number_ptr[17];
+    res.seg.size += len == 0 ? 4 : len;
+    res.seg.ptr = (uint8_t*)malloc(res.seg.size);
+    uint8_t *dst = res.seg.ptr;
+    mol_pack_number(dst, &res.seg.size);
+    dst += MOL_NUM_T_SIZE;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[1];
+    offset += len == 0 ? 8 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[3];
+    offset += len == 0 ? 1 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[5];
+    offset += len == 0 ? 8 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[7];
+    offset += len == 0 ? 32 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[9];
+    offset += len == 0 ? 4 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[11];
+    offset += len == 0 ? 20 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[13];
+    offset += len == 0 ? 4 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[15];
+    offset += len == 0 ? 20 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[17];
+    offset += len == 0 ? 4 : len;
+    uint8_t *src = builder.data_ptr;
+    len = builder.number_ptr[1];
+    if (len == 0) {
+        len = 8;
+        memcpy(dst, &MolDefault_uint64_t, len);
+    } else {
+        mol_num_t of = builder.number_ptr[0];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[3];
+    if (len == 0) {
+        len = 1;
+        memcpy(dst, &MolDefault_uint8_t, len);
+    } else {
+        mol_num_t of = builder.number_ptr[2];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[5];
+    if (len == 0) {
+        len = 8;
+        memcpy(dst, &MolDefault_uint64_t, len);
+    } else {
+        mol_num_t of = builder.number_ptr[4];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[7];
+    if (len == 0) {
+        len = 32;
+        memcpy(dst, &MolDefault_blake256, len);
+    } else {
+        mol_num_t of = builder.number_ptr[6];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[9];
+    if (len == 0) {
+        len = 4;
+        memcpy(dst, &MolDefault_Hashes, len);
+    } else {
+        mol_num_t of = builder.number_ptr[8];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[11];
+    if (len == 0) {
+        len = 20;
+        memcpy(dst, &MolDefault_blake160, len);
+    } else {
+        mol_num_t of = builder.number_ptr[10];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[13];
+    if (len == 0) {
+        len = 4;
+        memcpy(dst, &MolDefault_nfts, len);
+    } else {
+        mol_num_t of = builder.number_ptr[12];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[15];
+    if (len == 0) {
+        len = 20;
+        memcpy(dst, &MolDefault_blake160, len);
+    } else {
+        mol_num_t of = builder.number_ptr[14];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[17];
+    if (len == 0) {
+        len = 4;
+        memcpy(dst, &MolDefault_nfts, len);
+    } else {
+        mol_num_t of = builder.number_ptr[16];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    mol_builder_discard(builder);
+    return res;
+}
+MOLECULE_API_DECORATOR mol_seg_res_t MolBuilder_NftArgs_build (mol_builder_t builder) {
+    mol_seg_res_t res;
+    res.errno = MOL_OK;
+    mol_num_t offset = 44;
+    mol_num_t len;
+    res.seg.size = offset;
+    len = builder.number_ptr[1];
+    res.seg.size += len == 0 ? 8 : len;
+    len = builder.number_ptr[3];
+    res.seg.size += len == 0 ? 1 : len;
+    len = builder.number_ptr[5];
+    res.seg.size += len == 0 ? 8 : len;
+    len = builder.number_ptr[7];
+    res.seg.size += len == 0 ? 32 : len;
+    len = builder.number_ptr[9];
+    res.seg.size += len == 0 ? 4 : len;
+    len = builder.number_ptr[11];
+    res.seg.size += len == 0 ? 20 : len;
+    len = builder.number_ptr[13];
+    res.seg.size += len == 0 ? 4 : len;
+    len = builder.number_ptr[15];
+    res.seg.size += len == 0 ? 20 : len;
+    len = builder.number_ptr[17];
+    res.seg.size += len == 0 ? 4 : len;
+    len = builder.number_ptr[19];
+    res.seg.size += len == 0 ? 4 : len;
+    res.seg.ptr = (uint8_t*)malloc(res.seg.size);
+    uint8_t *dst = res.seg.ptr;
+    mol_pack_number(dst, &res.seg.size);
+    dst += MOL_NUM_T_SIZE;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[1];
+    offset += len == 0 ? 8 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[3];
+    offset += len == 0 ? 1 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[5];
+    offset += len == 0 ? 8 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[7];
+    offset += len == 0 ? 32 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[9];
+    offset += len == 0 ? 4 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[11];
+    offset += len == 0 ? 20 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[13];
+    offset += len == 0 ? 4 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[15];
+    offset += len == 0 ? 20 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[17];
+    offset += len == 0 ? 4 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[19];
+    offset += len == 0 ? 4 : len;
+    uint8_t *src = builder.data_ptr;
+    len = builder.number_ptr[1];
+    if (len == 0) {
+        len = 8;
+        memcpy(dst, &MolDefault_uint64_t, len);
+    } else {
+        mol_num_t of = builder.number_ptr[0];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[3];
+    if (len == 0) {
+        len = 1;
+        memcpy(dst, &MolDefault_uint8_t, len);
+    } else {
+        mol_num_t of = builder.number_ptr[2];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[5];
+    if (len == 0) {
+        len = 8;
+        memcpy(dst, &MolDefault_uint64_t, len);
+    } else {
+        mol_num_t of = builder.number_ptr[4];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[7];
+    if (len == 0) {
+        len = 32;
+        memcpy(dst, &MolDefault_blake256, len);
+    } else {
+        mol_num_t of = builder.number_ptr[6];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[9];
+    if (len == 0) {
+        len = 4;
+        memcpy(dst, &MolDefault_Hashes, len);
+    } else {
+        mol_num_t of = builder.number_ptr[8];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[11];
+    if (len == 0) {
+        len = 20;
+        memcpy(dst, &MolDefault_blake160, len);
+    } else {
+        mol_num_t of = builder.number_ptr[10];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[13];
+    if (len == 0) {
+        len = 4;
+        memcpy(dst, &MolDefault_nfts, len);
+    } else {
+        mol_num_t of = builder.number_ptr[12];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[15];
+    if (len == 0) {
+        len = 20;
+        memcpy(dst, &MolDefault_blake160, len);
+    } else {
+        mol_num_t of = builder.number_ptr[14];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[17];
+    if (len == 0) {
+        len = 4;
+        memcpy(dst, &MolDefault_nfts, len);
+    } else {
+        mol_num_t of = builder.number_ptr[16];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[19];
+    if (len == 0) {
+        len = 4;
+        memcpy(dst, &MolDefault_Hashes, len);
+    } else {
+        mol_num_t of = builder.number_ptr[18];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    mol_builder_discard(builder);
+    return res;
+}
+MOLECULE_API_DECORATOR mol_seg_res_t MolBuilder_MerkleArgs_build (mol_builder_t builder) {
+    mol_seg_res_t res;
+    res.errno = MOL_OK;
+    mol_num_t offset = 40;
+    mol_num_t len;
+    res.seg.size = offset;
+    len = builder.number_ptr[1];
+    res.seg.size += len == 0 ? 8 : len;
+    len = builder.number_ptr[3];
+    res.seg.size += len == 0 ? 1 : len;
+    len = builder.number_ptr[5];
+    res.seg.size += len == 0 ? 8 : len;
+    len = builder.number_ptr[7];
+    res.seg.size += len == 0 ? 32 : len;
+    len = builder.number_ptr[9];
+    res.seg.size += len == 0 ? 4 : len;
+    len = builder.number_ptr[11];
+    res.seg.size += len == 0 ? 20 : len;
+    len = builder.number_ptr[13];
+    res.seg.size += len == 0 ? 32 : len;
+    len = builder.number_ptr[15];
+    res.seg.size += len == 0 ? 20 : len;
+    len = builder.number_ptr[17];
+    res.seg.size += len == 0 ? 32 : len;
+    res.seg.ptr = (uint8_t*)malloc(res.seg.size);
+    uint8_t *dst = res.seg.ptr;
+    mol_pack_number(dst, &res.seg.size);
+    dst += MOL_NUM_T_SIZE;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[1];
+    offset += len == 0 ? 8 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
     len = builder.number_ptr[3];
     offset += len == 0 ? 1 : len;
     mol_pack_number(dst, &offset);
@@ -833,7 +2038,7 @@ MOLECULE_API_DECORATOR mol_seg_res_t MolBuilder_Args_build (mol_builder_t builde
     mol_pack_number(dst, &offset);
     dst += MOL_NUM_T_SIZE;
     len = builder.number_ptr[13];
-    offset += len == 0 ? 4 : len;
+    offset += len == 0 ? 32 : len;
     mol_pack_number(dst, &offset);
     dst += MOL_NUM_T_SIZE;
     len = builder.number_ptr[15];
@@ -841,7 +2046,7 @@ MOLECULE_API_DECORATOR mol_seg_res_t MolBuilder_Args_build (mol_builder_t builde
     mol_pack_number(dst, &offset);
     dst += MOL_NUM_T_SIZE;
     len = builder.number_ptr[17];
-    offset += len == 0 ? 4 : len;
+    offset += len == 0 ? 32 : len;
     uint8_t *src = builder.data_ptr;
     len = builder.number_ptr[1];
     if (len == 0) {
@@ -899,8 +2104,8 @@ MOLECULE_API_DECORATOR mol_seg_res_t MolBuilder_Args_build (mol_builder_t builde
     dst += len;
     len = builder.number_ptr[13];
     if (len == 0) {
-        len = 4;
-        memcpy(dst, &MolDefault_nfts, len);
+        len = 32;
+        memcpy(dst, &MolDefault_blake256, len);
     } else {
         mol_num_t of = builder.number_ptr[12];
         memcpy(dst, src+of, len);
@@ -917,8 +2122,8 @@ MOLECULE_API_DECORATOR mol_seg_res_t MolBuilder_Args_build (mol_builder_t builde
     dst += len;
     len = builder.number_ptr[17];
     if (len == 0) {
-        len = 4;
-        memcpy(dst, &MolDefault_nfts, len);
+        len = 32;
+        memcpy(dst, &MolDefault_blake256, len);
     } else {
         mol_num_t of = builder.number_ptr[16];
         memcpy(dst, src+of, len);
@@ -927,10 +2132,10 @@ MOLECULE_API_DECORATOR mol_seg_res_t MolBuilder_Args_build (mol_builder_t builde
     mol_builder_discard(builder);
     return res;
 }
-MOLECULE_API_DECORATOR mol_seg_res_t MolBuilder_Challenge_build (mol_builder_t builder) {
+MOLECULE_API_DECORATOR mol_seg_res_t MolBuilder_Reveal_build (mol_builder_t builder) {
     mol_seg_res_t res;
     res.errno = MOL_OK;
-    mol_num_t offset = 28;
+    mol_num_t offset = 20;
     mol_num_t len;
     res.seg.size = offset;
     len = builder.number_ptr[1];
@@ -938,7 +2143,81 @@ MOLECULE_API_DECORATOR mol_seg_res_t MolBuilder_Challenge_build (mol_builder_t b
     len = builder.number_ptr[3];
     res.seg.size += len == 0 ? 1 : len;
     len = builder.number_ptr[5];
+    res.seg.size += len == 0 ? 20 : len;
+    len = builder.number_ptr[7];
+    res.seg.size += len == 0 ? 4 : len;
+    res.seg.ptr = (uint8_t*)malloc(res.seg.size);
+    uint8_t *dst = res.seg.ptr;
+    mol_pack_number(dst, &res.seg.size);
+    dst += MOL_NUM_T_SIZE;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[1];
+    offset += len == 0 ? 1 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[3];
+    offset += len == 0 ? 1 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[5];
+    offset += len == 0 ? 20 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[7];
+    offset += len == 0 ? 4 : len;
+    uint8_t *src = builder.data_ptr;
+    len = builder.number_ptr[1];
+    if (len == 0) {
+        len = 1;
+        memcpy(dst, &MolDefault_uint8_t, len);
+    } else {
+        mol_num_t of = builder.number_ptr[0];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[3];
+    if (len == 0) {
+        len = 1;
+        memcpy(dst, &MolDefault_uint8_t, len);
+    } else {
+        mol_num_t of = builder.number_ptr[2];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[5];
+    if (len == 0) {
+        len = 20;
+        memcpy(dst, &MolDefault_blake160, len);
+    } else {
+        mol_num_t of = builder.number_ptr[4];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[7];
+    if (len == 0) {
+        len = 4;
+        memcpy(dst, &MolDefault_Hashes, len);
+    } else {
+        mol_num_t of = builder.number_ptr[6];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    mol_builder_discard(builder);
+    return res;
+}
+MOLECULE_API_DECORATOR mol_seg_res_t MolBuilder_Challenge_build (mol_builder_t builder) {
+    mol_seg_res_t res;
+    res.errno = MOL_OK;
+    mol_num_t offset = 28;
+    mol_num_t len;
+    res.seg.size = offset;
+    len = builder.number_ptr[1];
+    res.seg.size += len == 0 ? 2 : len;
+    len = builder.number_ptr[3];
     res.seg.size += len == 0 ? 1 : len;
+    len = builder.number_ptr[5];
+    res.seg.size += len == 0 ? 2 : len;
     len = builder.number_ptr[7];
     res.seg.size += len == 0 ? 32 : len;
     len = builder.number_ptr[9];
@@ -952,7 +2231,7 @@ MOLECULE_API_DECORATOR mol_seg_res_t MolBuilder_Challenge_build (mol_builder_t b
     mol_pack_number(dst, &offset);
     dst += MOL_NUM_T_SIZE;
     len = builder.number_ptr[1];
-    offset += len == 0 ? 1 : len;
+    offset += len == 0 ? 2 : len;
     mol_pack_number(dst, &offset);
     dst += MOL_NUM_T_SIZE;
     len = builder.number_ptr[3];
@@ -960,7 +2239,7 @@ MOLECULE_API_DECORATOR mol_seg_res_t MolBuilder_Challenge_build (mol_builder_t b
     mol_pack_number(dst, &offset);
     dst += MOL_NUM_T_SIZE;
     len = builder.number_ptr[5];
-    offset += len == 0 ? 1 : len;
+    offset += len == 0 ? 2 : len;
     mol_pack_number(dst, &offset);
     dst += MOL_NUM_T_SIZE;
     len = builder.number_ptr[7];
@@ -976,8 +2255,8 @@ MOLECULE_API_DECORATOR mol_seg_res_t MolBuilder_Challenge_build (mol_builder_t b
     uint8_t *src = builder.data_ptr;
     len = builder.number_ptr[1];
     if (len == 0) {
-        len = 1;
-        memcpy(dst, &MolDefault_uint8_t, len);
+        len = 2;
+        memcpy(dst, &MolDefault_uint16_t, len);
     } else {
         mol_num_t of = builder.number_ptr[0];
         memcpy(dst, src+of, len);
@@ -994,8 +2273,8 @@ MOLECULE_API_DECORATOR mol_seg_res_t MolBuilder_Challenge_build (mol_builder_t b
     dst += len;
     len = builder.number_ptr[5];
     if (len == 0) {
-        len = 1;
-        memcpy(dst, &MolDefault_uint8_t, len);
+        len = 2;
+        memcpy(dst, &MolDefault_uint16_t, len);
     } else {
         mol_num_t of = builder.number_ptr[4];
         memcpy(dst, src+of, len);
@@ -1031,6 +2310,168 @@ MOLECULE_API_DECORATOR mol_seg_res_t MolBuilder_Challenge_build (mol_builder_t b
     mol_builder_discard(builder);
     return res;
 }
+MOLECULE_API_DECORATOR mol_seg_res_t MolBuilder_Argument_build (mol_builder_t builder) {
+    mol_seg_res_t res;
+    res.errno = MOL_OK;
+    mol_num_t offset = 12;
+    mol_num_t len;
+    res.seg.size = offset;
+    len = builder.number_ptr[1];
+    res.seg.size += len == 0 ? 1 : len;
+    len = builder.number_ptr[3];
+    res.seg.size += len == 0 ? 4 : len;
+    res.seg.ptr = (uint8_t*)malloc(res.seg.size);
+    uint8_t *dst = res.seg.ptr;
+    mol_pack_number(dst, &res.seg.size);
+    dst += MOL_NUM_T_SIZE;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[1];
+    offset += len == 0 ? 1 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[3];
+    offset += len == 0 ? 4 : len;
+    uint8_t *src = builder.data_ptr;
+    len = builder.number_ptr[1];
+    if (len == 0) {
+        len = 1;
+        memcpy(dst, &MolDefault_uint8_t, len);
+    } else {
+        mol_num_t of = builder.number_ptr[0];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[3];
+    if (len == 0) {
+        len = 4;
+        memcpy(dst, &MolDefault_bytes, len);
+    } else {
+        mol_num_t of = builder.number_ptr[2];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    mol_builder_discard(builder);
+    return res;
+}
+MOLECULE_API_DECORATOR mol_seg_res_t MolBuilder_Call_build (mol_builder_t builder) {
+    mol_seg_res_t res;
+    res.errno = MOL_OK;
+    mol_num_t offset = 12;
+    mol_num_t len;
+    res.seg.size = offset;
+    len = builder.number_ptr[1];
+    res.seg.size += len == 0 ? 2 : len;
+    len = builder.number_ptr[3];
+    res.seg.size += len == 0 ? 4 : len;
+    res.seg.ptr = (uint8_t*)malloc(res.seg.size);
+    uint8_t *dst = res.seg.ptr;
+    mol_pack_number(dst, &res.seg.size);
+    dst += MOL_NUM_T_SIZE;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[1];
+    offset += len == 0 ? 2 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[3];
+    offset += len == 0 ? 4 : len;
+    uint8_t *src = builder.data_ptr;
+    len = builder.number_ptr[1];
+    if (len == 0) {
+        len = 2;
+        memcpy(dst, &MolDefault_uint16_t, len);
+    } else {
+        mol_num_t of = builder.number_ptr[0];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[3];
+    if (len == 0) {
+        len = 4;
+        memcpy(dst, &MolDefault_Arguments, len);
+    } else {
+        mol_num_t of = builder.number_ptr[2];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    mol_builder_discard(builder);
+    return res;
+}
+MOLECULE_API_DECORATOR mol_seg_res_t MolBuilder_RoundLayout_build (mol_builder_t builder) {
+    mol_seg_res_t res;
+    res.errno = MOL_OK;
+    mol_num_t offset = 20;
+    mol_num_t len;
+    res.seg.size = offset;
+    len = builder.number_ptr[1];
+    res.seg.size += len == 0 ? 2 : len;
+    len = builder.number_ptr[3];
+    res.seg.size += len == 0 ? 2 : len;
+    len = builder.number_ptr[5];
+    res.seg.size += len == 0 ? 2 : len;
+    len = builder.number_ptr[7];
+    res.seg.size += len == 0 ? 2 : len;
+    res.seg.ptr = (uint8_t*)malloc(res.seg.size);
+    uint8_t *dst = res.seg.ptr;
+    mol_pack_number(dst, &res.seg.size);
+    dst += MOL_NUM_T_SIZE;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[1];
+    offset += len == 0 ? 2 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[3];
+    offset += len == 0 ? 2 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[5];
+    offset += len == 0 ? 2 : len;
+    mol_pack_number(dst, &offset);
+    dst += MOL_NUM_T_SIZE;
+    len = builder.number_ptr[7];
+    offset += len == 0 ? 2 : len;
+    uint8_t *src = builder.data_ptr;
+    len = builder.number_ptr[1];
+    if (len == 0) {
+        len = 2;
+        memcpy(dst, &MolDefault_uint16_t, len);
+    } else {
+        mol_num_t of = builder.number_ptr[0];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[3];
+    if (len == 0) {
+        len = 2;
+        memcpy(dst, &MolDefault_uint16_t, len);
+    } else {
+        mol_num_t of = builder.number_ptr[2];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[5];
+    if (len == 0) {
+        len = 2;
+        memcpy(dst, &MolDefault_uint16_t, len);
+    } else {
+        mol_num_t of = builder.number_ptr[4];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    len = builder.number_ptr[7];
+    if (len == 0) {
+        len = 2;
+        memcpy(dst, &MolDefault_uint16_t, len);
+    } else {
+        mol_num_t of = builder.number_ptr[6];
+        memcpy(dst, src+of, len);
+    }
+    dst += len;
+    mol_builder_discard(builder);
+    return res;
+}
 
 #ifdef __DEFINE_MOLECULE_API_DECORATOR_KABLETOP
 #undef MOLECULE_API_DECORATOR
@@ -3,7 +3,12 @@
 
 #include "kabletop.h"
 
-#define MAX_ROUND_COUNT 256
+#define MAX_ROUND_COUNT 65535
+#define ROUND_PAGE_SIZE 16
+#define MAX_OPERATIONS_PER_ROUND 64
+#define MAX_OUTPUT_COUNT 64
+#define OPERATION_CACHE_SIZE 64
+#define MAX_OPERATION_CACHE_BYTES 8192
 
 typedef enum
 {
@@ -14,7 +19,7 @@ typedef enum
 
 typedef struct
 {
-    uint8_t  size;
+    uint32_t size;
     uint8_t *code;
 } Operation;
 
@@ -23,103 +28,305 @@ typedef struct
     uint64_t randomseed[2];
 } Seed;
 
+// molecule tables are decoded once right after verification, so that hot paths read plain
+// fields instead of walking offsets again on every access
+typedef struct
+{
+    uint64_t staking_ckb;
+    uint64_t begin_blocknumber;
+    uint8_t deck_size;
+    uint8_t lua_code_hashes_count;
+    uint8_t user1_nfts_count;
+    uint8_t user2_nfts_count;
+    uint8_t nft_type_hashes_count;
+    uint8_t *lock_code_hash;
+    uint8_t *lua_code_hashes;
+    uint8_t *user1_pkhash;
+    uint8_t *user1_nfts;
+    uint8_t *user2_pkhash;
+    uint8_t *user2_nfts;
+    uint8_t *nft_type_hashes;
+    // only set by MerkleArgs, whose decks are revealed card by card instead of listed
+    uint8_t *user1_nft_root;
+    uint8_t *user2_nft_root;
+} DecodedArgs;
+
+typedef struct
+{
+    uint8_t user_type;
+    uint8_t operations_count;
+    mol_seg_t operations;
+    Operation operation[MAX_OPERATIONS_PER_ROUND];
+} DecodedRound;
+
+typedef struct
+{
+    uint16_t count;
+    uint8_t challenger;
+    uint16_t snapshot_position;
+    uint8_t *snapshot_hashproof;
+    uint8_t *snapshot_signature;
+    uint8_t operations_count;
+    mol_seg_t operations;
+} DecodedChallenge;
+
+typedef struct
+{
+    uint8_t  lock_hash[32];
+    uint8_t  lock_code_hash[32];
+    uint8_t  lock_args[20];
+    uint32_t lock_args_size;
+    uint64_t capacity;
+    // position in transaction outputs, only relevant outputs are indexed
+    size_t   index;
+} OutputCell;
+
+typedef struct
+{
+    uint32_t hash;
+    uint32_t size;
+    uint32_t offset;
+} CachedOperation;
+
+// compiled operations live in a registry table of lua, here only keeps their source bytes
+// to confirm hits, memory is capped by both entry count and source bytes
+typedef struct
+{
+    uint8_t count;
+    uint32_t bytes;
+    uint32_t hits;
+    uint32_t misses;
+    CachedOperation entries[OPERATION_CACHE_SIZE];
+    uint8_t sources[MAX_OPERATION_CACHE_BYTES];
+} OperationCache;
+
 typedef struct
 {
     // from input lock_args
     mol_seg_t args;
+    DecodedArgs decoded_args;
 
-    // from witnesses
-    uint8_t round_count;
-    mol_seg_t rounds[MAX_ROUND_COUNT];
-	mol_seg_t signatures[MAX_ROUND_COUNT];
+    // from witnesses, rounds are paged into a bounded window
+    uint16_t round_count;
+    size_t round_offset;
+    uint16_t page_begin;
+    uint16_t page_size;
+    uint8_t *page;
+    // set when rounds are packed into one witness, pages are then streamed out of the
+    // SignedRounds vector which starts at packed_begin of that witness
+    uint8_t packed;
+    size_t packed_begin;
+    uint32_t packed_size;
+    // set when a RoundLayout of a batched transaction points out this channel's rounds, payouts
+    // are then taken from the outputs at user_outputs instead of the first ones owned by users
+    uint8_t batched;
+    uint16_t user_outputs[2];
+    mol_seg_t rounds[ROUND_PAGE_SIZE];
+	mol_seg_t signatures[ROUND_PAGE_SIZE];
+    DecodedRound decoded_rounds[ROUND_PAGE_SIZE];
 
     // from data
     mol_seg_t input_challenge;
     mol_seg_t output_challenge;
+    DecodedChallenge decoded_input_challenge;
+    DecodedChallenge decoded_output_challenge;
+
+    // from outputs
+    uint8_t output_count;
+    OutputCell outputs[MAX_OUTPUT_COUNT];
+
+    // from celldeps, the first lua code is the dictionary of compressed operations
+    const uint8_t *dictionary;
+    size_t dictionary_size;
+
+    // from replay
+    OperationCache operation_cache;
 
     // others
-    Seed seeds[MAX_ROUND_COUNT];
+    Seed channel_seed;
     USER_TYPE signer;
 } Kabletop;
 
-#define _user_staking_ckb(k)       *(uint64_t *)MolReader_Args_get_user_staking_ckb(&k->args).ptr
-#define _user_deck_size(k)         *(uint8_t *)MolReader_Args_get_user_deck_size(&k->args).ptr
-#define _begin_blocknumber(k)      *(uint64_t *)MolReader_Args_get_begin_blocknumber(&k->args).ptr
-#define _lock_code_hash(k)          (uint8_t *)MolReader_Args_get_lock_code_hash(&k->args).ptr
-#define _user1_pkhash(k)            (uint8_t *)MolReader_Args_get_user1_pkhash(&k->args).ptr
-#define _user2_pkhash(k)            (uint8_t *)MolReader_Args_get_user2_pkhash(&k->args).ptr
-#define _user_type(k, i)           *(uint8_t *)MolReader_Round_get_user_type(&k->rounds[i]).ptr
-#define _challenger(k, io)         *(uint8_t *)MolReader_Challenge_get_challenger(&k->io##_challenge).ptr
-#define _snapshot_position(k, io)  *(uint8_t *)MolReader_Challenge_get_snapshot_position(&k->io##_challenge).ptr
-#define _snapshot_hashproof(k, io)  (uint8_t *)MolReader_Challenge_get_snapshot_hashproof(&k->io##_challenge).ptr
-#define _snapshot_signature(k, io)  (uint8_t *)MolReader_Challenge_get_snapshot_signature(&k->io##_challenge).ptr
-#define _challenge_count(k, io)    *(uint8_t *)MolReader_Challenge_get_count(&k->io##_challenge).ptr
-
-uint8_t _lua_code_hashes_count(Kabletop *k)
+// accessors of rounds made resident by load_round, NULL for any other round
+mol_seg_t * _round(Kabletop *k, uint16_t i);
+mol_seg_t * _signature(Kabletop *k, uint16_t i);
+DecodedRound * _decoded_round(Kabletop *k, uint16_t i);
+
+#define _user_staking_ckb(k)         (k)->decoded_args.staking_ckb
+#define _user_deck_size(k)           (k)->decoded_args.deck_size
+#define _begin_blocknumber(k)        (k)->decoded_args.begin_blocknumber
+#define _lock_code_hash(k)           (k)->decoded_args.lock_code_hash
+#define _user1_pkhash(k)             (k)->decoded_args.user1_pkhash
+#define _user2_pkhash(k)             (k)->decoded_args.user2_pkhash
+#define _lua_code_hashes_count(k)    (k)->decoded_args.lua_code_hashes_count
+#define _user_type(k, i)             _decoded_round(k, i)->user_type
+#define _operations_count(k, i)      _decoded_round(k, i)->operations_count
+#define _operation(k, r, i)          _decoded_round(k, r)->operation[i]
+#define _challenger(k, io)           (k)->decoded_##io##_challenge.challenger
+#define _snapshot_position(k, io)    (k)->decoded_##io##_challenge.snapshot_position
+#define _snapshot_hashproof(k, io)   (k)->decoded_##io##_challenge.snapshot_hashproof
+#define _snapshot_signature(k, io)   (k)->decoded_##io##_challenge.snapshot_signature
+#define _challenge_count(k, io)      (k)->decoded_##io##_challenge.count
+#define _challenge_operations(k, io) (k)->decoded_##io##_challenge.operations
+#define _challenge_operations_count(k, io) (k)->decoded_##io##_challenge.operations_count
+
+// counts are kept in uint8_t, so longer lists are rejected instead of wrapping around
+int decode_count(mol_num_t count, mol_num_t max, uint8_t *decoded)
 {
-    mol_seg_t hashes = MolReader_Args_get_lua_code_hashes(&k->args);
-	return (uint8_t)MolReader_Hashes_length(&hashes);
+    if (count > max)
+    {
+        return MOL_ERR;
+    }
+    *decoded = (uint8_t)count;
+    return MOL_OK;
 }
 
-uint8_t * _lua_code_hash(Kabletop *k, uint8_t i)
+int decode_args(Kabletop *k, int nft_args)
 {
+    // expects k->args to have passed MolReader_Args_verify, or MolReader_NftArgs_verify with
+    // nft_args set, whose first fields are the same as Args
+    DecodedArgs *args = &k->decoded_args;
+    memset(args, 0, sizeof(DecodedArgs));
+    args->staking_ckb = *(uint64_t *)MolReader_Args_get_user_staking_ckb(&k->args).ptr;
+    args->deck_size = *(uint8_t *)MolReader_Args_get_user_deck_size(&k->args).ptr;
+    args->begin_blocknumber = *(uint64_t *)MolReader_Args_get_begin_blocknumber(&k->args).ptr;
+    args->lock_code_hash = (uint8_t *)MolReader_Args_get_lock_code_hash(&k->args).ptr;
+    args->user1_pkhash = (uint8_t *)MolReader_Args_get_user1_pkhash(&k->args).ptr;
+    args->user2_pkhash = (uint8_t *)MolReader_Args_get_user2_pkhash(&k->args).ptr;
+    // fixed vectors keep their items contiguous right after the item count
     mol_seg_t hashes = MolReader_Args_get_lua_code_hashes(&k->args);
-	if (i < MolReader_Hashes_length(&hashes))
-	{
-		mol_seg_t hash =  MolReader_Hashes_get(&hashes, i).seg;
-		return (uint8_t *)hash.ptr;
-	}
-	return NULL;
+    if (decode_count(MolReader_Hashes_length(&hashes), UINT8_MAX, &args->lua_code_hashes_count) != MOL_OK)
+    {
+        return MOL_ERR;
+    }
+    args->lua_code_hashes = hashes.ptr + MOL_NUM_T_SIZE;
+    mol_seg_t nfts = MolReader_Args_get_user1_nfts(&k->args);
+    if (decode_count(MolReader_nfts_length(&nfts), UINT8_MAX, &args->user1_nfts_count) != MOL_OK)
+    {
+        return MOL_ERR;
+    }
+    args->user1_nfts = nfts.ptr + MOL_NUM_T_SIZE;
+    nfts = MolReader_Args_get_user2_nfts(&k->args);
+    if (decode_count(MolReader_nfts_length(&nfts), UINT8_MAX, &args->user2_nfts_count) != MOL_OK)
+    {
+        return MOL_ERR;
+    }
+    args->user2_nfts = nfts.ptr + MOL_NUM_T_SIZE;
+    if (! nft_args)
+    {
+        return MOL_OK;
+    }
+    hashes = MolReader_NftArgs_get_nft_type_hashes(&k->args);
+    if (decode_count(MolReader_Hashes_length(&hashes), UINT8_MAX, &args->nft_type_hashes_count) != MOL_OK)
+    {
+        return MOL_ERR;
+    }
+    args->nft_type_hashes = hashes.ptr + MOL_NUM_T_SIZE;
+    return MOL_OK;
 }
 
-uint8_t * _user1_nft(Kabletop *k, uint8_t i)
+int decode_merkle_args(Kabletop *k)
 {
-    mol_seg_t nfts = MolReader_Args_get_user1_nfts(&k->args);
-    if (i < MolReader_nfts_length(&nfts))
+    // expects k->args to have passed MolReader_MerkleArgs_verify, no nft is listed
+    DecodedArgs *args = &k->decoded_args;
+    memset(args, 0, sizeof(DecodedArgs));
+    args->staking_ckb = *(uint64_t *)MolReader_MerkleArgs_get_user_staking_ckb(&k->args).ptr;
+    args->deck_size = *(uint8_t *)MolReader_MerkleArgs_get_user_deck_size(&k->args).ptr;
+    args->begin_blocknumber = *(uint64_t *)MolReader_MerkleArgs_get_begin_blocknumber(&k->args).ptr;
+    args->lock_code_hash = (uint8_t *)MolReader_MerkleArgs_get_lock_code_hash(&k->args).ptr;
+    args->user1_pkhash = (uint8_t *)MolReader_MerkleArgs_get_user1_pkhash(&k->args).ptr;
+    args->user2_pkhash = (uint8_t *)MolReader_MerkleArgs_get_user2_pkhash(&k->args).ptr;
+    args->user1_nft_root = (uint8_t *)MolReader_MerkleArgs_get_user1_nft_root(&k->args).ptr;
+    args->user2_nft_root = (uint8_t *)MolReader_MerkleArgs_get_user2_nft_root(&k->args).ptr;
+    mol_seg_t hashes = MolReader_MerkleArgs_get_lua_code_hashes(&k->args);
+    if (decode_count(MolReader_Hashes_length(&hashes), UINT8_MAX, &args->lua_code_hashes_count) != MOL_OK)
     {
-        mol_seg_res_t nft = MolReader_nfts_get(&nfts, i);
-        return (uint8_t *)nft.seg.ptr;
+        return MOL_ERR;
     }
-    return NULL;
+    args->lua_code_hashes = hashes.ptr + MOL_NUM_T_SIZE;
+    return MOL_OK;
 }
 
-uint8_t * _user2_nft(Kabletop *k, uint8_t i)
+int decode_lock_args(Kabletop *k)
 {
-    mol_seg_t nfts = MolReader_Args_get_user2_nfts(&k->args);
-    if (i < MolReader_nfts_length(&nfts))
+    // NftArgs has one more field than the others, and Args and MerkleArgs cannot both verify
+    // since a 32-byte root never has the size of an nfts vector
+    if (MolReader_Args_verify(&k->args, false) == MOL_OK)
     {
-        mol_seg_res_t nft = MolReader_nfts_get(&nfts, i);
-        return (uint8_t *)nft.seg.ptr;
+        return decode_args(k, 0);
     }
-    return NULL;
+    if (MolReader_NftArgs_verify(&k->args, false) == MOL_OK)
+    {
+        return decode_args(k, 1);
+    }
+    if (MolReader_MerkleArgs_verify(&k->args, false) == MOL_OK)
+    {
+        return decode_merkle_args(k);
+    }
+    return MOL_ERR;
 }
 
-uint8_t _operations_count(Kabletop *k, uint8_t i)
+int decode_round(mol_seg_t *round, DecodedRound *decoded)
 {
-    mol_seg_t operations = MolReader_Round_get_operations(&k->rounds[i]);
-    return (uint8_t)MolReader_Operations_length(&operations);
+    // expects round to have passed MolReader_Round_verify
+    decoded->user_type = *(uint8_t *)MolReader_Round_get_user_type(round).ptr;
+    decoded->operations = MolReader_Round_get_operations(round);
+    mol_num_t count = MolReader_Operations_length(&decoded->operations);
+    if (decode_count(count, MAX_OPERATIONS_PER_ROUND, &decoded->operations_count) != MOL_OK)
+    {
+        return MOL_ERR;
+    }
+    for (mol_num_t i = 0; i < count; ++i)
+    {
+        mol_seg_t operation = MolReader_Operations_get(&decoded->operations, i).seg;
+        decoded->operation[i].size = (uint32_t)MolReader_bytes_length(&operation);
+        decoded->operation[i].code = (uint8_t *)MolReader_bytes_raw_bytes(&operation).ptr;
+    }
+    return MOL_OK;
 }
 
-Operation _operation(Kabletop *k, uint8_t r, uint8_t i)
+int decode_challenge(mol_seg_t *challenge, DecodedChallenge *decoded)
 {
-    mol_seg_t operation = MolReader_Round_get_operations(&k->rounds[r]);
-    operation = MolReader_Operations_get(&operation, i).seg;
-    Operation op;
-    op.size = (uint8_t)MolReader_bytes_length(&operation);
-    op.code = (uint8_t *)MolReader_bytes_raw_bytes(&operation).ptr;
-    return op;
+    if (MolReader_Challenge_verify(challenge, false) != MOL_OK)
+    {
+        return MOL_ERR;
+    }
+    decoded->count = *(uint16_t *)MolReader_Challenge_get_count(challenge).ptr;
+    decoded->challenger = *(uint8_t *)MolReader_Challenge_get_challenger(challenge).ptr;
+    decoded->snapshot_position = *(uint16_t *)MolReader_Challenge_get_snapshot_position(challenge).ptr;
+    decoded->snapshot_hashproof = (uint8_t *)MolReader_Challenge_get_snapshot_hashproof(challenge).ptr;
+    decoded->snapshot_signature = (uint8_t *)MolReader_Challenge_get_snapshot_signature(challenge).ptr;
+    decoded->operations = MolReader_Challenge_get_operations(challenge);
+    // pending operations of a challenge are the round to come, so they are bounded like rounds
+    mol_num_t count = MolReader_Operations_length(&decoded->operations);
+    return decode_count(count, MAX_OPERATIONS_PER_ROUND, &decoded->operations_count);
 }
 
-uint8_t _input_challenge_operations_count(Kabletop *k)
+uint8_t * _lua_code_hash(Kabletop *k, uint8_t i)
 {
-	mol_seg_t operations = MolReader_Challenge_get_operations(&k->input_challenge);
-	return (uint8_t)MolReader_Operations_length(&operations);
+	if (i < k->decoded_args.lua_code_hashes_count)
+	{
+		return &k->decoded_args.lua_code_hashes[i * BLAKE2B_BLOCK_SIZE];
+	}
+	return NULL;
 }
 
-uint8_t _output_challenge_operations_count(Kabletop *k)
+uint8_t * _user1_nft(Kabletop *k, uint8_t i)
 {
-	mol_seg_t operations = MolReader_Challenge_get_operations(&k->output_challenge);
-	return (uint8_t)MolReader_Operations_length(&operations);
+    if (i < k->decoded_args.user1_nfts_count)
+    {
+        return &k->decoded_args.user1_nfts[i * BLAKE160_SIZE];
+    }
+    return NULL;
+}
+
+uint8_t * _user2_nft(Kabletop *k, uint8_t i)
+{
+    if (i < k->decoded_args.user2_nfts_count)
+    {
+        return &k->decoded_args.user2_nfts[i * BLAKE160_SIZE];
+    }
+    return NULL;
 }
 
 typedef uint8_t * _USER_NFT_F(Kabletop *, uint8_t);
@@ -0,0 +1,13 @@
+#ifndef CKB_LUA_KABLETOP_NOFLOAT
+#define CKB_LUA_KABLETOP_NOFLOAT
+
+// force-included into every unit of liblua-nofloat.a, where "/" raises an error instead of dividing
+// in soft-float, and so does "//" of floats which lua floors from "/", game code of the integer-only
+// profile divides integers with "//", the error comes from kabletop_float_division in inject.h, also
+// when "/" of two constants is folded while a chunk is compiled
+struct lua_State;
+double kabletop_float_division(struct lua_State *L);
+
+#define luai_numdiv(L,a,b) ((void)(a), (void)(b), kabletop_float_division(L))
+
+#endif
@@ -2,35 +2,10 @@
 #include "inject.h"
 #include "blockchain.h"
 #include "core.h"
+#include "memory.h"
+#include "profile.h"
 #include <stdio.h>
 
-void hex(char *hex, uint8_t *bytes, int size)
-{
-	int pointer = 0;
-	char hex_char[16];
-	for (int i = 0; i < size; ++i)
-	{
-		sprintf(hex_char, "%02x", (int)bytes[i]);
-		memcpy(&hex[pointer], hex_char, strlen(hex_char));
-		pointer += strlen(hex_char);
-	}
-}
-
-void import_user_nft(Kabletop *k, lua_State *L, _USER_NFT_F _user_nft, const char *name)
-{
-    lua_newtable(L);
-	char hash[BLAKE160_SIZE * 2 + 1] = "";
-    for (uint8_t i = 0; i < _user_deck_size(k); ++i)
-    {
-		uint8_t *nft = _user_nft(k, i);
-		if (nft == NULL) break;
-		hex(hash, nft, BLAKE160_SIZE);
-        lua_pushstring(L, hash);
-        lua_rawseti(L, -2, i + 1);
-    }
-    lua_setglobal(L, name);
-}
-
 int plugin_init(lua_State *L, int herr)
 {
     luaL_openlibs(L);
@@ -41,18 +16,42 @@ int plugin_verify(lua_State *L, int herr)
 {
     // molecule buffers
     uint8_t script[MAX_SCRIPT_SIZE];
-    uint8_t witnesses[MAX_ROUND_COUNT][MAX_ROUND_SIZE];
+    uint8_t witnesses[ROUND_PAGE_SIZE][MAX_ROUND_SIZE];
     uint8_t challenge_data[2][MAX_CHALLENGE_DATA_SIZE];
+    uint8_t dictionary[MAX_LUACODE_SIZE];
+    uint8_t secp_data[CKB_SECP256K1_PARTIAL_DATA_SIZE];
 
     Kabletop kabletop;
+    RoundPass pass;
     int ret = CKB_SUCCESS;
     uint64_t capacities[3] = {0, 0, 0};
+    MEMORY_PROFILE_BEGIN(L);
+    MEMORY_PROFILE_BUFFER("script", sizeof(script));
+    MEMORY_PROFILE_BUFFER("witnesses", sizeof(witnesses));
+    MEMORY_PROFILE_BUFFER("challenges", sizeof(challenge_data));
+    MEMORY_PROFILE_BUFFER("dictionary", sizeof(dictionary));
+    MEMORY_PROFILE_BUFFER("secp256k1", sizeof(secp_data));
+    MEMORY_PROFILE_BUFFER("kabletop", sizeof(kabletop));
 
     // recover kabletop params from args
     CHECK_RET(verify_lock_args(&kabletop, script));
+    CHECK_RET(verify_user_decks(&kabletop));
+
+    // decks committed as merkle roots only import revealed cards, the group witness carrying them
+    // is read into the round page buffer before any round page is
+    if (kabletop.decoded_args.user1_nft_root)
+    {
+        CHECK_RET(import_revealed_nfts(&kabletop, L, (uint8_t *)witnesses));
+    }
+    MEMORY_PROFILE_PHASE("args");
+
+    // recover kabletop round layout from witnesses, rounds themselves are checked along the replay
+    CHECK_RET(verify_witnesses(&kabletop, &pass, witnesses, secp_data));
+    MEMORY_PROFILE_PHASE("witnesses");
 
-    // recover kabletop rounds from witnesses
-    CHECK_RET(verify_witnesses(&kabletop, witnesses));
+    // index output cells for mode checks
+    CHECK_RET(index_outputs(&kabletop));
+    MEMORY_PROFILE_PHASE("outputs");
 
     // check challenge or settlement mode
     MODE mode = check_mode(&kabletop, challenge_data);
@@ -70,40 +69,58 @@ int plugin_verify(lua_State *L, int herr)
         }
         default: return KABLETOP_WRONG_MODE;
     }
+    MEMORY_PROFILE_PHASE("mode");
 
     // import all users nft collection
-    import_user_nft(&kabletop, L, _user1_nft, "_user1_nfts");
-    import_user_nft(&kabletop, L, _user2_nft, "_user2_nfts");
+    if (! kabletop.decoded_args.user1_nft_root)
+    {
+        import_user_nft(&kabletop, L, _user1_nft, "_user1_nfts");
+        import_user_nft(&kabletop, L, _user2_nft, "_user2_nfts");
+    }
 
 	// load lua codes from celldep which match the hashes from kabletop_args
-	CHECK_RET(inject_celldep_functions(&kabletop, L, herr));
+	CHECK_RET(inject_celldep_functions(&kabletop, L, herr, dictionary));
+    MEMORY_PROFILE_PHASE("celldeps");
 
-    // check lua operations
-    for (uint8_t i = 0; i < kabletop.round_count; ++i)
+    // check lua operations, round random seed comes from channel hash at first and then
+    // from first 16 bytes of previous round signature, signatures and hash proofs of rounds
+    // are checked in the same pass so that every round page is loaded only once
+    CHECK_RET(begin_round_pass(&kabletop, &pass, mode));
+    Seed seed = kabletop.channel_seed;
+    kabletop.operation_cache.count = 0;
+    kabletop.operation_cache.bytes = 0;
+    kabletop.operation_cache.hits = 0;
+    kabletop.operation_cache.misses = 0;
+    LUA_PROFILE_BEGIN(L);
+    for (uint16_t i = 0; i < kabletop.round_count; ++i)
     {
-        lua_getglobal(L, "_set_random_seed");
-        lua_pushinteger(L, kabletop.seeds[i].randomseed[0]);
-        lua_pushinteger(L, kabletop.seeds[i].randomseed[1]);
-        lua_pcall(L, 2, 0, herr);
-        uint8_t count = _operations_count(&kabletop, i);
-        for (uint8_t n = 0; n < count; ++n)
+        ret = verify_round(&kabletop, &pass, i);
+        if (ret == CKB_SUCCESS)
         {
-            Operation operation = _operation(&kabletop, i, n);
-            if (luaL_loadbuffer(L, (const char *)operation.code, operation.size, "kabletop-running-operation")
-                || lua_pcall(L, 0, 0, herr))
-            {
-				char error[512] = "";
-				sprintf(error, "Invalid lua script: please check operation code [%u-%u].", i, n);
-				ckb_debug(error);
-                return KABLETOP_WRONG_LUA_OPERATION_CODE;
-            }
+            ret = run_kabletop_round(&kabletop, L, herr, i, &seed);
         }
+        if (ret != CKB_SUCCESS)
+        {
+            TRACE_END(ret);
+            return ret;
+        }
+        memcpy(seed.randomseed, _signature(&kabletop, i)->ptr, sizeof(Seed));
     }
+    LUA_PROFILE_END(L);
+    LUA_PROFILE_OPERATION_CACHE(kabletop.operation_cache.hits, kabletop.operation_cache.misses);
+    CHECK_RET(end_round_pass(&kabletop, &pass));
+    MEMORY_PROFILE_PHASE("replay");
 
     // check lua final state
     lua_getglobal(L, "_winner");
     int winner = lua_tointeger(L, -1);
-    CHECK_RET(check_result(&kabletop, winner, capacities, mode));
+    ret = check_result(&kabletop, winner, capacities, mode);
+    TRACE_END(ret);
+    if (ret != CKB_SUCCESS)
+    {
+        return ret;
+    }
+    MEMORY_PROFILE_PHASE("result");
 
     return CKB_SUCCESS;
 }
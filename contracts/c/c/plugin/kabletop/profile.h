@@ -0,0 +1,126 @@
+#ifndef CKB_LUA_KABLETOP_PROFILE
+#define CKB_LUA_KABLETOP_PROFILE
+
+#include "lua.h"
+#include <stdio.h>
+
+// lua profile of the replay, built with -DKABLETOP_LUA_PROFILE, samples the lua call stack every
+// LUA_PROFILE_INTERVAL vm instructions and reports every distinct stack in folded form, outermost
+// frame first, through debug output like:
+//   lua profile: kabletop-running-operation:main:0;celldep:play_card:2;celldep:deal_damage:8 42
+// frames are named by chunk, function name and the line it is defined at, so card scripts of
+// _GAME_CHUNK ("native") and celldep libraries ("celldep") show up as separate functions
+#ifdef KABLETOP_LUA_PROFILE
+
+#ifndef LUA_PROFILE_INTERVAL
+#define LUA_PROFILE_INTERVAL 1000
+#endif
+#define LUA_PROFILE_DEPTH 16
+#define LUA_PROFILE_STACKS 128
+#define LUA_PROFILE_STACK_SIZE 384
+
+typedef struct
+{
+    uint32_t hash;
+    uint32_t samples;
+    char stack[LUA_PROFILE_STACK_SIZE];
+} LuaProfileStack;
+
+typedef struct
+{
+    uint16_t count;
+    uint32_t dropped;
+    LuaProfileStack stacks[LUA_PROFILE_STACKS];
+} LuaProfile;
+
+LuaProfile lua_profile;
+
+uint32_t lua_profile_hash(const char *stack)
+{
+    uint32_t hash = 2166136261u;
+    for (; *stack; ++stack)
+    {
+        hash = (hash ^ (uint8_t)*stack) * 16777619u;
+    }
+    return hash;
+}
+
+void lua_profile_hook(lua_State *L, lua_Debug *ar)
+{
+    // frames are collected innermost first and written out in reverse, deeper frames are cut
+    lua_Debug frames[LUA_PROFILE_DEPTH];
+    int depth = 0;
+    while (depth < LUA_PROFILE_DEPTH && lua_getstack(L, depth, &frames[depth]))
+    {
+        lua_getinfo(L, "Sn", &frames[depth]);
+        depth += 1;
+    }
+    char stack[LUA_PROFILE_STACK_SIZE] = "";
+    size_t size = 0;
+    for (int i = depth - 1; i >= 0 && size < sizeof(stack); --i)
+    {
+        const char *name = frames[i].name ? frames[i].name : (frames[i].linedefined == 0 ? "main" : "?");
+        size += snprintf(&stack[size], sizeof(stack) - size, "%s%s:%s:%d", i == depth - 1 ? "" : ";",
+            *frames[i].what == 'C' ? "[C]" : frames[i].source, name, frames[i].linedefined);
+    }
+    uint32_t hash = lua_profile_hash(stack);
+    for (uint16_t i = 0; i < lua_profile.count; ++i)
+    {
+        if (lua_profile.stacks[i].hash == hash && strcmp(lua_profile.stacks[i].stack, stack) == 0)
+        {
+            lua_profile.stacks[i].samples += 1;
+            return;
+        }
+    }
+    if (lua_profile.count == LUA_PROFILE_STACKS)
+    {
+        lua_profile.dropped += 1;
+        return;
+    }
+    LuaProfileStack *entry = &lua_profile.stacks[lua_profile.count++];
+    entry->hash = hash;
+    entry->samples = 1;
+    memcpy(entry->stack, stack, sizeof(stack));
+}
+
+void lua_profile_begin(lua_State *L)
+{
+    lua_profile.count = 0;
+    lua_profile.dropped = 0;
+    lua_sethook(L, lua_profile_hook, LUA_MASKCOUNT, LUA_PROFILE_INTERVAL);
+}
+
+void lua_profile_end(lua_State *L)
+{
+    lua_sethook(L, NULL, 0, 0);
+    char profile[LUA_PROFILE_STACK_SIZE + 32] = "";
+    for (uint16_t i = 0; i < lua_profile.count; ++i)
+    {
+        sprintf(profile, "lua profile: %s %u", lua_profile.stacks[i].stack, lua_profile.stacks[i].samples);
+        ckb_debug(profile);
+    }
+    if (lua_profile.dropped > 0)
+    {
+        sprintf(profile, "lua profile: [dropped] %u", lua_profile.dropped);
+        ckb_debug(profile);
+    }
+}
+
+// hit rate of the operation cache over the replay, left out of production runs with the rest of the profile
+void lua_profile_operation_cache(uint32_t hits, uint32_t misses)
+{
+    char status[64] = "";
+    sprintf(status, "operation cache: %u hits, %u misses.", hits, misses);
+    ckb_debug(status);
+}
+
+#define LUA_PROFILE_BEGIN(L) lua_profile_begin(L)
+#define LUA_PROFILE_END(L) lua_profile_end(L)
+#define LUA_PROFILE_OPERATION_CACHE(hits, misses) lua_profile_operation_cache(hits, misses)
+#else
+#define LUA_PROFILE_BEGIN(L)
+#define LUA_PROFILE_END(L)
+#define LUA_PROFILE_OPERATION_CACHE(hits, misses)
+#endif
+
+#endif
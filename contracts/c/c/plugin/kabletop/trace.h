@@ -0,0 +1,200 @@
+#ifndef CKB_LUA_KABLETOP_TRACE
+#define CKB_LUA_KABLETOP_TRACE
+
+#include "lua.h"
+#include <stdio.h>
+
+// execution trace of the replay, built with -DKABLETOP_TRACE, is a compact binary log streamed
+// through debug output as hex lines "kabletop trace: <hex>" whenever its buffer fills up and at
+// the end of replay, tests/src/bin/kabletop_trace.rs decodes and diffs them
+//
+// header is "KTRC", version and flags, every record is a tag followed by little-endian fields,
+// and by a u64 cycle stamp when flags has TRACE_FLAG_CYCLES:
+//   TRACE_TAG_ROUND_BEGIN  u16 round, u8 user_type, 16 bytes seed
+//   TRACE_TAG_OPERATION    u16 round, u8 index, u32 fnv1a of operation bytes, u32 size
+//   TRACE_TAG_RANDOM       u8 kind (0 integer, 1 float), 8 bytes value
+//   TRACE_TAG_WINNER       i64 winner
+//   TRACE_TAG_ROUND_END    u16 round
+//   TRACE_TAG_RESULT       i32 error code of the replay and result check
+// cycle stamps need the current_cycles syscall of CKB-VM version 1, so they are only taken
+// with -DKABLETOP_TRACE_CYCLES
+#ifdef KABLETOP_TRACE
+
+#define TRACE_VERSION 1
+#define TRACE_FLAG_CYCLES 0x01
+#define TRACE_BUFFER_SIZE 4096
+#define TRACE_LINE_SIZE 256
+#define TRACE_RECORD_SIZE 48
+
+#define TRACE_TAG_ROUND_BEGIN 0x01
+#define TRACE_TAG_OPERATION 0x02
+#define TRACE_TAG_RANDOM 0x03
+#define TRACE_TAG_WINNER 0x04
+#define TRACE_TAG_ROUND_END 0x05
+#define TRACE_TAG_RESULT 0x06
+
+#ifdef KABLETOP_TRACE_CYCLES
+#define KABLETOP_SYS_CURRENT_CYCLES 2042
+#define TRACE_FLAGS TRACE_FLAG_CYCLES
+#else
+#define TRACE_FLAGS 0
+#endif
+
+typedef struct
+{
+    uint8_t started;
+    int64_t winner;
+    size_t size;
+    uint8_t buffer[TRACE_BUFFER_SIZE];
+} Trace;
+
+Trace trace;
+
+void trace_flush()
+{
+    char line[TRACE_LINE_SIZE * 2 + 32] = "kabletop trace: ";
+    size_t prefix = strlen(line);
+    for (size_t offset = 0; offset < trace.size; offset += TRACE_LINE_SIZE)
+    {
+        size_t size = trace.size - offset < TRACE_LINE_SIZE ? trace.size - offset : TRACE_LINE_SIZE;
+        for (size_t i = 0; i < size; ++i)
+        {
+            sprintf(&line[prefix + i * 2], "%02x", trace.buffer[offset + i]);
+        }
+        line[prefix + size * 2] = '\0';
+        ckb_debug(line);
+    }
+    trace.size = 0;
+}
+
+void trace_bytes(const void *bytes, size_t size)
+{
+    memcpy(&trace.buffer[trace.size], bytes, size);
+    trace.size += size;
+}
+
+void trace_record(uint8_t tag)
+{
+    // records never straddle a flush, header goes out before the first one
+    if (trace.size + TRACE_RECORD_SIZE > TRACE_BUFFER_SIZE)
+    {
+        trace_flush();
+    }
+    if (!trace.started)
+    {
+        uint8_t header[6] = { 'K', 'T', 'R', 'C', TRACE_VERSION, TRACE_FLAGS };
+        trace_bytes(header, sizeof(header));
+        trace.started = 1;
+    }
+    trace_bytes(&tag, 1);
+}
+
+void trace_cycles()
+{
+#ifdef KABLETOP_TRACE_CYCLES
+    uint64_t cycles = syscall(KABLETOP_SYS_CURRENT_CYCLES, 0, 0, 0, 0, 0, 0);
+    trace_bytes(&cycles, sizeof(cycles));
+#endif
+}
+
+void trace_round_begin(uint16_t round, uint8_t user_type, const Seed *seed)
+{
+    trace_record(TRACE_TAG_ROUND_BEGIN);
+    trace_bytes(&round, sizeof(round));
+    trace_bytes(&user_type, sizeof(user_type));
+    trace_bytes(seed->randomseed, sizeof(seed->randomseed));
+    trace_cycles();
+}
+
+void trace_operation(uint16_t round, uint8_t index, uint32_t hash, uint32_t size)
+{
+    trace_record(TRACE_TAG_OPERATION);
+    trace_bytes(&round, sizeof(round));
+    trace_bytes(&index, sizeof(index));
+    trace_bytes(&hash, sizeof(hash));
+    trace_bytes(&size, sizeof(size));
+    trace_cycles();
+}
+
+void trace_winner(lua_State *L)
+{
+    // only changes are recorded, _winner starts from 0
+    lua_getglobal(L, "_winner");
+    int64_t winner = lua_tointeger(L, -1);
+    lua_pop(L, 1);
+    if (winner != trace.winner)
+    {
+        trace.winner = winner;
+        trace_record(TRACE_TAG_WINNER);
+        trace_bytes(&winner, sizeof(winner));
+        trace_cycles();
+    }
+}
+
+void trace_round_end(lua_State *L, uint16_t round)
+{
+    trace_winner(L);
+    trace_record(TRACE_TAG_ROUND_END);
+    trace_bytes(&round, sizeof(round));
+    trace_cycles();
+}
+
+void trace_end(int32_t result)
+{
+    trace_record(TRACE_TAG_RESULT);
+    trace_bytes(&result, sizeof(result));
+    trace_cycles();
+    trace_flush();
+}
+
+int traced_random(lua_State *L)
+{
+    // math.random is wrapped once at injection, the draw is recorded as the script received it
+    lua_pushvalue(L, lua_upvalueindex(1));
+    lua_insert(L, 1);
+    lua_call(L, lua_gettop(L) - 1, 1);
+    uint8_t kind = lua_isinteger(L, -1) ? 0 : 1;
+    uint8_t value[8];
+    if (kind == 0)
+    {
+        int64_t integer = lua_tointeger(L, -1);
+        memcpy(value, &integer, sizeof(value));
+    }
+    else
+    {
+        lua_Number number = lua_tonumber(L, -1);
+        memset(value, 0, sizeof(value));
+        memcpy(value, &number, sizeof(number) < sizeof(value) ? sizeof(number) : sizeof(value));
+    }
+    trace_record(TRACE_TAG_RANDOM);
+    trace_bytes(&kind, sizeof(kind));
+    trace_bytes(value, sizeof(value));
+    trace_cycles();
+    return 1;
+}
+
+void trace_inject(lua_State *L)
+{
+    lua_getglobal(L, "math");
+    lua_getfield(L, -1, "random");
+    lua_pushcclosure(L, traced_random, 1);
+    lua_setfield(L, -2, "random");
+    lua_pop(L, 1);
+}
+
+#define TRACE_INJECT(L) trace_inject(L)
+#define TRACE_ROUND_BEGIN(i, user_type, seed) trace_round_begin(i, user_type, seed)
+#define TRACE_OPERATION(i, n, hash, size) trace_operation(i, n, hash, size)
+#define TRACE_WINNER(L) trace_winner(L)
+#define TRACE_ROUND_END(L, i) trace_round_end(L, i)
+#define TRACE_END(result) trace_end(result)
+#else
+#define TRACE_INJECT(L)
+#define TRACE_ROUND_BEGIN(i, user_type, seed)
+#define TRACE_OPERATION(i, n, hash, size)
+#define TRACE_WINNER(L)
+#define TRACE_ROUND_END(L, i)
+#define TRACE_END(result)
+#endif
+
+#endif
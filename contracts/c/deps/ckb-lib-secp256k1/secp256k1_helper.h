@@ -30,14 +30,25 @@ void secp256k1_default_error_callback_fn(const char* str, void* data) {
 }
 
 /*
- * data should at least be CKB_SECP256K1_DATA_SIZE big
- * so as to hold all loaded data.
+ * Both halves of secp256k1_data hold odd multiples of G (and of 2^128 * G) in
+ * ascending order for window size 15, so a smaller WINDOW_G only needs a prefix
+ * of each half. Recovery then loads 2 * CKB_SECP256K1_PRE_G_SIZE bytes instead
+ * of the whole cell.
  */
-int ckb_secp256k1_custom_verify_only_initialize(secp256k1_context* context,
-                                                void* data) {
+#if WINDOW_G > 15
+#error "secp256k1_data only contains precomputation for window size up to 15"
+#endif
+#if defined(CKB_SECP256K1_EXPECTED_WINDOW) && \
+    WINDOW_G != CKB_SECP256K1_EXPECTED_WINDOW
+#error "secp256k1 is not configured with the requested window size"
+#endif
+#define CKB_SECP256K1_PRE_G_SIZE \
+  (ECMULT_TABLE_SIZE(WINDOW_G) * sizeof(secp256k1_ge_storage))
+#define CKB_SECP256K1_PARTIAL_DATA_SIZE (CKB_SECP256K1_PRE_G_SIZE * 2)
+
+int ckb_secp256k1_find_data(size_t* index_out) {
   size_t index = 0;
-  int running = 1;
-  while (running && index < SIZE_MAX) {
+  while (index < SIZE_MAX) {
     uint64_t len = 32;
     uint8_t hash[32];
 
@@ -48,40 +59,79 @@ int ckb_secp256k1_custom_verify_only_initialize(secp256k1_context* context,
         break;
       case CKB_SUCCESS:
         if (memcmp(ckb_secp256k1_data_hash, hash, 32) == 0) {
-          /* Found a match, load data here */
-          len = CKB_SECP256K1_DATA_SIZE;
-          ret = ckb_load_cell_data(data, &len, 0, index, CKB_SOURCE_CELL_DEP);
-          if (ret != CKB_SUCCESS || len != CKB_SECP256K1_DATA_SIZE) {
-            return CKB_SECP256K1_HELPER_ERROR_LOADING_DATA;
-          }
-          running = 0;
+          *index_out = index;
+          return CKB_SUCCESS;
         }
         break;
       default:
         return CKB_SECP256K1_HELPER_ERROR_LOADING_DATA;
     }
-    if (running) {
-      index++;
-    }
-  }
-  if (index == SIZE_MAX) {
-    return CKB_SECP256K1_HELPER_ERROR_LOADING_DATA;
+    index++;
   }
+  return CKB_SECP256K1_HELPER_ERROR_LOADING_DATA;
+}
 
+void ckb_secp256k1_setup_context(secp256k1_context* context, uint8_t* pre_g,
+                                 uint8_t* pre_g_128) {
   context->illegal_callback = default_illegal_callback;
   context->error_callback = default_error_callback;
 
   secp256k1_ecmult_context_init(&context->ecmult_ctx);
   secp256k1_ecmult_gen_context_init(&context->ecmult_gen_ctx);
 
+  context->ecmult_ctx.pre_g = (secp256k1_ge_storage(*)[])pre_g;
+  context->ecmult_ctx.pre_g_128 = (secp256k1_ge_storage(*)[])pre_g_128;
+}
+
+/*
+ * data should at least be CKB_SECP256K1_DATA_SIZE big
+ * so as to hold all loaded data.
+ */
+int ckb_secp256k1_custom_verify_only_initialize(secp256k1_context* context,
+                                                void* data) {
+  size_t index = 0;
+  int ret = ckb_secp256k1_find_data(&index);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  uint64_t len = CKB_SECP256K1_DATA_SIZE;
+  ret = ckb_load_cell_data(data, &len, 0, index, CKB_SOURCE_CELL_DEP);
+  if (ret != CKB_SUCCESS || len != CKB_SECP256K1_DATA_SIZE) {
+    return CKB_SECP256K1_HELPER_ERROR_LOADING_DATA;
+  }
+
   /* Recasting data to (uint8_t*) for pointer math */
   uint8_t* p = data;
-  secp256k1_ge_storage(*pre_g)[] = (secp256k1_ge_storage(*)[])p;
-  secp256k1_ge_storage(*pre_g_128)[] =
-      (secp256k1_ge_storage(*)[])(&p[CKB_SECP256K1_DATA_PRE_SIZE]);
-  context->ecmult_ctx.pre_g = pre_g;
-  context->ecmult_ctx.pre_g_128 = pre_g_128;
+  ckb_secp256k1_setup_context(context, p, &p[CKB_SECP256K1_DATA_PRE_SIZE]);
+  return 0;
+}
+
+/*
+ * data should at least be CKB_SECP256K1_PARTIAL_DATA_SIZE big, only the
+ * table prefixes that WINDOW_G reaches are loaded with two offset loads.
+ */
+int ckb_secp256k1_custom_verify_only_initialize_partial(
+    secp256k1_context* context, void* data) {
+  size_t index = 0;
+  int ret = ckb_secp256k1_find_data(&index);
+  if (ret != CKB_SUCCESS) {
+    return ret;
+  }
+  uint8_t* p = data;
+  uint64_t len = CKB_SECP256K1_PRE_G_SIZE;
+  ret = ckb_load_cell_data(p, &len, 0, index, CKB_SOURCE_CELL_DEP);
+  if (ret != CKB_SUCCESS || len < CKB_SECP256K1_PRE_G_SIZE) {
+    return CKB_SECP256K1_HELPER_ERROR_LOADING_DATA;
+  }
+  len = CKB_SECP256K1_PRE_G_SIZE;
+  ret = ckb_load_cell_data(&p[CKB_SECP256K1_PRE_G_SIZE], &len,
+                           CKB_SECP256K1_DATA_PRE_SIZE, index,
+                           CKB_SOURCE_CELL_DEP);
+  if (ret != CKB_SUCCESS || len < CKB_SECP256K1_PRE_G_SIZE) {
+    return CKB_SECP256K1_HELPER_ERROR_LOADING_DATA;
+  }
 
+  ckb_secp256k1_setup_context(context, p, &p[CKB_SECP256K1_PRE_G_SIZE]);
   return 0;
 }
 
@@ -13,6 +13,11 @@
 #define RECID_INDEX 64
 /* 32 KB */
 #define MAX_WITNESS_SIZE 32768
+/* 512 KB, witnesses not covered by inputs are streamed through the temp
+ * buffer, no transaction larger than this fits in a block anyway */
+#ifndef MAX_EXTRA_WITNESS_SIZE
+#define MAX_EXTRA_WITNESS_SIZE 524288
+#endif
 #define SCRIPT_SIZE 32768
 #define SIGNATURE_SIZE 65
 
@@ -31,7 +36,8 @@
 #define ERROR_INCORRECT_SINCE_VALUE -24
 #define ERROR_PUBKEY_BLAKE160_HASH -31
 
-#if (MAX_WITNESS_SIZE > TEMP_SIZE) || (SCRIPT_SIZE > TEMP_SIZE)
+#if (MAX_WITNESS_SIZE > TEMP_SIZE) || (SCRIPT_SIZE > TEMP_SIZE) || \
+    (MAX_EXTRA_WITNESS_SIZE < MAX_WITNESS_SIZE)
 #error "Temp buffer is not big enough!"
 #endif
 
@@ -106,7 +112,10 @@ void print_hex(const char *prefix, unsigned char *msg, int size) {
   ckb_debug(print);
 }
 
-int get_secp256k1_pubkey_blake160(
+/* Recover pubkey with an initialized context, so that callers recovering
+ * several signatures only load the secp256k1 data cell once */
+int get_secp256k1_pubkey_blake160_with_context(
+  secp256k1_context *context,
   unsigned char pubkey_hash_out[BLAKE160_SIZE],
   unsigned char lock_bytes[SIGNATURE_SIZE],
   unsigned char message[BLAKE2B_BLOCK_SIZE]) {
@@ -114,28 +123,21 @@ int get_secp256k1_pubkey_blake160(
   unsigned char temp[TEMP_SIZE];
 
   /* Load signature */
-  secp256k1_context context;
-  uint8_t secp_data[CKB_SECP256K1_DATA_SIZE];
-  int ret = ckb_secp256k1_custom_verify_only_initialize(&context, secp_data);
-  if (ret != 0) {
-    return ret;
-  }
-
   secp256k1_ecdsa_recoverable_signature signature;
   if (secp256k1_ecdsa_recoverable_signature_parse_compact(
-          &context, &signature, lock_bytes, lock_bytes[RECID_INDEX]) == 0) {
+          context, &signature, lock_bytes, lock_bytes[RECID_INDEX]) == 0) {
     return ERROR_SECP_PARSE_SIGNATURE;
   }
 
   /* Recover pubkey */
   secp256k1_pubkey pubkey;
-  if (secp256k1_ecdsa_recover(&context, &pubkey, &signature, message) != 1) {
+  if (secp256k1_ecdsa_recover(context, &pubkey, &signature, message) != 1) {
     return ERROR_SECP_RECOVER_PUBKEY;
   }
 
   /* Check pubkey hash */
   size_t pubkey_size = PUBKEY_SIZE;
-  if (secp256k1_ec_pubkey_serialize(&context, temp, &pubkey_size, &pubkey,
+  if (secp256k1_ec_pubkey_serialize(context, temp, &pubkey_size, &pubkey,
                                     SECP256K1_EC_COMPRESSED) != 1) {
     return ERROR_SECP_SERIALIZE_PUBKEY;
   }
@@ -147,7 +149,23 @@ int get_secp256k1_pubkey_blake160(
   return CKB_SUCCESS;
 }
 
-int get_secp256k1_blake160_sighash_all(
+int get_secp256k1_pubkey_blake160(
+  unsigned char pubkey_hash_out[BLAKE160_SIZE],
+  unsigned char lock_bytes[SIGNATURE_SIZE],
+  unsigned char message[BLAKE2B_BLOCK_SIZE]) {
+
+  secp256k1_context context;
+  uint8_t secp_data[CKB_SECP256K1_PARTIAL_DATA_SIZE];
+  int ret = ckb_secp256k1_custom_verify_only_initialize_partial(&context, secp_data);
+  if (ret != 0) {
+    return ret;
+  }
+  return get_secp256k1_pubkey_blake160_with_context(&context, pubkey_hash_out,
+                                                    lock_bytes, message);
+}
+
+int get_secp256k1_blake160_sighash_all_with_context(
+    secp256k1_context *context,
     unsigned char pubkey_hash_out[BLAKE160_SIZE],
     size_t input_index,
     size_t source) {
@@ -219,7 +237,8 @@ int get_secp256k1_blake160_sighash_all(
     blake2b_update(&blake2b_ctx, temp, len);
     i += 1;
   }
-  /* Digest witnesses that not covered by inputs */
+  /* Digest witnesses that not covered by inputs, which may pack many rounds
+   * and are streamed through the temp buffer when larger than it */
   i = ckb_calculate_inputs_len();
   while (1) {
     len = MAX_WITNESS_SIZE;
@@ -230,16 +249,34 @@ int get_secp256k1_blake160_sighash_all(
     if (ret != CKB_SUCCESS) {
       return ERROR_SYSCALL;
     }
-    if (len > MAX_WITNESS_SIZE) {
+    if (len > MAX_EXTRA_WITNESS_SIZE) {
       return ERROR_WITNESS_SIZE;
     }
     blake2b_update(&blake2b_ctx, (char *)&len, sizeof(uint64_t));
-    blake2b_update(&blake2b_ctx, temp, len);
+    uint64_t total = len;
+    uint64_t offset = 0;
+    while (1) {
+      uint64_t chunk = total - offset;
+      if (chunk > MAX_WITNESS_SIZE) {
+        chunk = MAX_WITNESS_SIZE;
+      }
+      blake2b_update(&blake2b_ctx, temp, chunk);
+      offset += chunk;
+      if (offset >= total) {
+        break;
+      }
+      len = MAX_WITNESS_SIZE;
+      ret = ckb_load_witness(temp, &len, offset, i, CKB_SOURCE_INPUT);
+      if (ret != CKB_SUCCESS) {
+        return ERROR_SYSCALL;
+      }
+    }
     i += 1;
   }
   blake2b_final(&blake2b_ctx, message, BLAKE2B_BLOCK_SIZE);
 
-  ret = get_secp256k1_pubkey_blake160(pubkey_hash_out, lock_bytes, message);
+  ret = get_secp256k1_pubkey_blake160_with_context(context, pubkey_hash_out,
+                                                   lock_bytes, message);
   if (ret != CKB_SUCCESS) {
     return ret;
   }
@@ -247,6 +284,20 @@ int get_secp256k1_blake160_sighash_all(
   return 0;
 }
 
+int get_secp256k1_blake160_sighash_all(
+    unsigned char pubkey_hash_out[BLAKE160_SIZE],
+    size_t input_index,
+    size_t source) {
+  secp256k1_context context;
+  uint8_t secp_data[CKB_SECP256K1_PARTIAL_DATA_SIZE];
+  int ret = ckb_secp256k1_custom_verify_only_initialize_partial(&context, secp_data);
+  if (ret != 0) {
+    return ret;
+  }
+  return get_secp256k1_blake160_sighash_all_with_context(
+      &context, pubkey_hash_out, input_index, source);
+}
+
 /*
  * Arguments:
  * pubkey blake160 hash, blake2b hash of pubkey first 20 bytes, used to
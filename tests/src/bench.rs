@@ -0,0 +1,503 @@
+use super::{
+    helper::{sign_tx, MAX_CYCLES, gen_witnesses_and_signatures, pack_witnesses},
+    protocol,
+    tests::{get_keypair, get_nfts, get_round},
+    *,
+};
+use ckb_system_scripts::BUNDLED_CELL;
+use ckb_testtool::{
+    builtin::ALWAYS_SUCCESS,
+    context::Context
+};
+use ckb_tool::{
+    ckb_hash::blake2b_256,
+    ckb_types::{
+        bytes::Bytes,
+        core::{TransactionBuilder, TransactionView, Capacity},
+        packed::{CellDep, CellOutput, CellInput},
+        prelude::*,
+    },
+};
+use serde_json::{json, Value};
+use std::{env, fs};
+
+// synthetic games are benchmarked with `cargo test bench -- --ignored --nocapture`
+//
+// KABLETOP_BENCH_BINARY     comma separated contract binaries under build/<env>, default "kabletop"
+// KABLETOP_BENCH_FILTER     only run configurations whose name contains this string
+// KABLETOP_BENCH_TOLERANCE  allowed growth ratio against baseline, default 0.02
+// KABLETOP_BENCH_UPDATE     overwrite baseline with the fresh report
+//
+// every configuration of the default binary must have a baseline entry, others are compared with it
+// side by side and only warned about, baseline is recorded on the reference build and committed
+//
+// binaries reporting a memory profile (kabletop-memprofile) are also held to stack and lua heap budgets
+const REPORT_PATH: &str = "bench/report.json";
+const BASELINE_PATH: &str = "bench/baseline.json";
+const PEAK_MEMORY_TAG: &str = "bench-peak-memory ";
+const MEMORY_PROFILE_TAG: &str = "memory profile: ";
+
+// budgets checked when the binary reports a memory profile (kabletop-memprofile), the stack
+// holds fixed buffers and secp256k1 tables, lua heap grows with decks and celldep libraries,
+// a stack which ran into the heap is reported capped and always counts as over budget
+const STACK_BUDGET: u64 = 1280 * 1024;
+
+fn lua_heap_budget(config: &BenchConfig) -> u64 {
+    512 * 1024 + config.deck_size as u64 * 2 * 256 + config.celldep_count as u64 * 4096
+}
+
+struct BenchRun {
+    cycles: u64,
+    peak_memory: u64,
+    tx_size: usize,
+    contract_size: usize,
+    // stack and lua heap high-water marks over all phases, and whether any stack mark was capped
+    memory_profile: Option<(u64, u64, bool)>,
+}
+
+#[derive(Clone, Copy)]
+pub struct BenchConfig {
+    rounds: usize,
+    operations: usize,
+    operation_size: usize,
+    deck_size: u8,
+    celldep_count: usize,
+    // 0 means settlement, otherwise the challenge count put into the output challenge
+    challenge_depth: u16,
+    // both decks proved on-chain against nft cells
+    verified_decks: bool,
+    // all rounds packed into one witness
+    packed: bool,
+    // operations play cards instead of adding constants, see game_operation
+    game: bool,
+}
+
+impl BenchConfig {
+    pub fn name(&self) -> String {
+        format!(
+            "{}-r{}-o{}x{}-d{}-l{}-c{}{}{}{}",
+            if self.challenge_depth > 0 { "challenge" } else { "settlement" },
+            self.rounds, self.operations, self.operation_size,
+            self.deck_size, self.celldep_count, self.challenge_depth,
+            if self.verified_decks { "-v" } else { "" },
+            if self.packed { "-p" } else { "" },
+            if self.game { "-g" } else { "" }
+        )
+    }
+}
+
+// sweep one dimension at a time around a base game
+pub fn bench_configs() -> Vec<BenchConfig> {
+    let base = BenchConfig {
+        rounds: 16,
+        operations: 4,
+        operation_size: 64,
+        deck_size: 5,
+        celldep_count: 0,
+        challenge_depth: 0,
+        verified_decks: false,
+        packed: false,
+        game: false,
+    };
+    let mut configs = vec![];
+    for &rounds in &[1usize, 4, 16, 64, 256] {
+        configs.push(BenchConfig { rounds, ..base });
+        configs.push(BenchConfig { rounds, packed: true, ..base });
+    }
+    for &operations in &[1usize, 8, 32, 64] {
+        configs.push(BenchConfig { operations, operation_size: 16, ..base });
+    }
+    for &operation_size in &[16usize, 256, 1024] {
+        configs.push(BenchConfig { operations: 1, operation_size, ..base });
+    }
+    for &deck_size in &[1u8, 40, 255] {
+        configs.push(BenchConfig { deck_size, ..base });
+        configs.push(BenchConfig { deck_size, verified_decks: true, ..base });
+    }
+    for &celldep_count in &[1usize, 4, 16] {
+        configs.push(BenchConfig { celldep_count, ..base });
+    }
+    for &challenge_depth in &[1u16, 2, 8] {
+        configs.push(BenchConfig { challenge_depth, ..base });
+    }
+    for &rounds in &[16usize, 64] {
+        configs.push(BenchConfig { rounds, game: true, ..base });
+    }
+    configs
+}
+
+// a turn of a card game, drawing from the seeded random, integer damage, board tables and formatted
+// logs, so that builds changing number handling like kabletop-nofloat are measured on the work of
+// real turns, numbers only reach strings through tostring or string.format
+fn game_operation(round: usize, index: usize) -> String {
+    match index % 4 {
+        0 => "_hp = _hp or {30, 30} _hand = _hand or {} _hand[#_hand + 1] = math.random(1, 10)".to_string(),
+        1 => format!(
+            "local card = table.remove(_hand) or 1 local target = {} % 2 + 1 _hp[target] = _hp[target] - card * 3 // 2",
+            round
+        ),
+        2 => format!(
+            "_board = _board or {{}} _board[#_board + 1] = {{ atk = {} % 5 + 1, hp = {} % 7 + 1 }} \
+             if #_board > 8 then table.remove(_board, 1) end",
+            index, round
+        ),
+        _ => "local log = {} for k, unit in ipairs(_board or {}) do log[k] = string.format('%d:%d', unit.atk, unit.hp) end \
+              _log = table.concat(log, ',') .. ' hp ' .. tostring(_hp[1])".to_string(),
+    }
+}
+
+// pad lua statement with comment to reach expected operation size
+fn operation(config: &BenchConfig, round: usize, index: usize) -> String {
+    let mut code = if config.game {
+        game_operation(round, index)
+    } else if config.celldep_count > 0 {
+        format!("local v = lib_{}({})", index % config.celldep_count, round)
+    } else {
+        format!("local v = {} + {}", round, index)
+    };
+    if code.len() + 3 < config.operation_size {
+        code += &format!(" --{}", "x".repeat(config.operation_size - code.len() - 3));
+    }
+    code
+}
+
+fn round_operations(config: &BenchConfig, round: usize) -> Vec<String> {
+    let mut operations = (0..config.operations)
+        .map(|j| operation(config, round, j))
+        .collect::<Vec<_>>();
+    // sample lua heap at the end of every round and report the peak in the last one
+    let last = operations.last_mut().unwrap();
+    *last += "\n_bp = math.max(_bp or 0, collectgarbage('count'))";
+    if round + 1 == config.rounds {
+        *last += &format!("\nckb.debug('{}' .. tostring(math.floor(_bp * 1024)))", PEAK_MEMORY_TAG);
+        if config.challenge_depth == 0 {
+            *last += "\n_winner = 1";
+        }
+    }
+    operations
+}
+
+// build the synthetic game of config into context, returns the signed transaction and contract size
+pub fn build_bench_tx(context: &mut Context, binary: &str, config: &BenchConfig) -> (TransactionView, usize) {
+    // deploy contract
+    let contract_bin: Bytes = Loader::default().load_binary(binary);
+    let contract_size = contract_bin.len();
+    let out_point = context.deploy_cell(contract_bin);
+    let secp256k1_data_bin = BUNDLED_CELL.get("specs/cells/secp256k1_data").unwrap();
+    let secp256k1_data_out_point = context.deploy_cell(secp256k1_data_bin.to_vec().into());
+    let secp256k1_data_dep = CellDep::new_builder()
+        .out_point(secp256k1_data_out_point)
+        .build();
+    let always_success_out_point = context.deploy_cell(ALWAYS_SUCCESS.clone());
+    let always_success_script_dep = CellDep::new_builder()
+        .out_point(always_success_out_point.clone())
+        .build();
+    let mut luacode_deps = vec![];
+    let mut luacode_hashes = vec![];
+    for i in 0..config.celldep_count {
+        let luacode = format!("function lib_{}(x) return x * 2 + {} end", i, i);
+        luacode_hashes.push(blake2b_256(luacode.as_bytes()));
+        let luacode_out_point = context.deploy_cell(luacode.into_bytes().into());
+        luacode_deps.push(CellDep::new_builder()
+            .out_point(luacode_out_point)
+            .build());
+    }
+
+    // generate two users' privkey and pubkhash
+    let (user1_privkey, user1_pkhash) = get_keypair();
+    let (user2_privkey, user2_pkhash) = get_keypair();
+
+    // prepare scripts
+    let code_hash: [u8; 32] = blake2b_256(ALWAYS_SUCCESS.to_vec());
+    let lock_args_molecule = (
+        500u64, config.deck_size, 1024u64, code_hash,
+        user1_pkhash, get_nfts(config.deck_size), user2_pkhash, get_nfts(config.deck_size)
+    );
+    let lock_args = protocol::lock_args(lock_args_molecule, luacode_hashes);
+    let nft_type_script = context
+        .build_script(&always_success_out_point, Bytes::from(vec![0x6e, 0x66, 0x74]))
+        .expect("nft type_script");
+    let lock_args = if config.verified_decks {
+        let mut nft_type_hash = [0u8; 32];
+        nft_type_hash.copy_from_slice(nft_type_script.calc_script_hash().as_slice());
+        protocol::to_vec(&protocol::with_nft_type_hashes(lock_args, vec![nft_type_hash]))
+    } else {
+        protocol::to_vec(&lock_args)
+    };
+    let lock_script = context
+        .build_script(&out_point, Bytes::from(lock_args))
+        .expect("lock_script");
+    let lock_script_dep = CellDep::new_builder()
+        .out_point(out_point)
+        .build();
+    let user1_always_success_script = context
+        .build_script(&always_success_out_point, Bytes::from(user1_pkhash.to_vec()))
+        .expect("user1 always_success_script");
+    let user2_always_success_script = context
+        .build_script(&always_success_out_point, Bytes::from(user2_pkhash.to_vec()))
+        .expect("user2 always_success_script");
+
+    // every user owns the deck in reverse order within one nft cell
+    let mut nft_deps = vec![];
+    if config.verified_decks {
+        let mut owned = get_nfts(config.deck_size);
+        owned.reverse();
+        for lock in &[&user1_always_success_script, &user2_always_success_script] {
+            let nft_out_point = context.create_cell(
+                CellOutput::new_builder()
+                    .capacity(1000u64.pack())
+                    .lock((*lock).clone())
+                    .type_(Some(nft_type_script.clone()).pack())
+                    .build(),
+                Bytes::from(owned.concat()),
+            );
+            nft_deps.push(CellDep::new_builder()
+                .out_point(nft_out_point)
+                .build());
+        }
+    }
+
+    // prepare witnesses, users take turns and the last round always belongs to user1
+    let mut witnesses = vec![];
+    for i in 0..config.rounds {
+        let operations = round_operations(config, i);
+        let operations = operations.iter().map(|code| code.as_str()).collect();
+        if (config.rounds - 1 - i) % 2 == 0 {
+            witnesses.push((&user1_privkey, get_round(2u8, operations)));
+        } else {
+            witnesses.push((&user2_privkey, get_round(1u8, operations)));
+        }
+    }
+    let rounds = witnesses
+        .iter()
+        .map(|(_, round)| round.clone())
+        .collect::<Vec<Bytes>>();
+    let (mut witnesses, signatures) = gen_witnesses_and_signatures(&lock_script, 2000u64, witnesses);
+    if config.packed {
+        witnesses = pack_witnesses(witnesses);
+    }
+    let snapshot = rounds
+        .into_iter()
+        .enumerate()
+        .map(|(i, round)| (round, signatures[i]))
+        .collect::<Vec<_>>();
+
+    // settle the game or challenge it with the full snapshot, deeper challenges come from
+    // an earlier challenge of user2 which has to be payed back
+    let mut input_data = vec![];
+    let mut outputs = vec![];
+    let mut outputs_data = vec![];
+    if config.challenge_depth == 0 {
+        outputs.push(CellOutput::new_builder()
+            .capacity(1500.pack())
+            .lock(user1_always_success_script.clone())
+            .build());
+        outputs.push(CellOutput::new_builder()
+            .capacity(500.pack())
+            .lock(user2_always_success_script.clone())
+            .build());
+        outputs_data = vec![Bytes::new(), Bytes::new()];
+    } else {
+        if config.challenge_depth > 1 {
+            let position = std::cmp::max(1, config.rounds / 2);
+            let challenge = protocol::challenge(2, config.challenge_depth - 1, snapshot[..position].to_vec(), vec![]);
+            input_data = protocol::to_vec(&challenge);
+        }
+        let challenge = protocol::challenge(1, config.challenge_depth, snapshot, vec!["local v = 0"]);
+        outputs.push(CellOutput::new_builder()
+            .capacity(2000u64.pack())
+            .lock(lock_script.clone())
+            .build());
+        outputs_data.push(Bytes::from(protocol::to_vec(&challenge)));
+        if !input_data.is_empty() {
+            outputs.push(CellOutput::new_builder()
+                .capacity(Capacity::bytes(input_data.len()).unwrap().pack())
+                .lock(user2_always_success_script.clone())
+                .build());
+            outputs_data.push(Bytes::new());
+        }
+    }
+
+    // prepare cells
+    let input_out_point = context.create_cell(
+        CellOutput::new_builder()
+            .capacity(2000u64.pack())
+            .lock(lock_script.clone())
+            .build(),
+        Bytes::from(input_data),
+    );
+    let input = CellInput::new_builder()
+        .previous_output(input_out_point)
+        .build();
+
+    // build transaction
+    let tx = TransactionBuilder::default()
+        .input(input)
+        .outputs(outputs)
+        .outputs_data(outputs_data.pack())
+        .cell_dep(lock_script_dep)
+        .cell_dep(secp256k1_data_dep)
+        .cell_dep(always_success_script_dep)
+        .cell_deps(luacode_deps)
+        .cell_deps(nft_deps)
+        .build();
+    let tx = context.complete_tx(tx);
+    (sign_tx(tx, &user1_privkey, witnesses), contract_size)
+}
+
+fn run_bench(binary: &str, config: &BenchConfig) -> BenchRun {
+    let mut context = Context::default();
+    context.set_capture_debug(true);
+    let (tx, contract_size) = build_bench_tx(&mut context, binary, config);
+
+    // run
+    let cycles = context
+        .verify_tx(&tx, MAX_CYCLES * 20)
+        .expect(&format!("pass bench {}", config.name()));
+    let peak_memory = context
+        .captured_messages()
+        .iter()
+        .filter_map(|message| {
+            let at = message.message.find(PEAK_MEMORY_TAG)?;
+            message.message[at + PEAK_MEMORY_TAG.len()..].trim().parse::<u64>().ok()
+        })
+        .max()
+        .unwrap_or(0);
+    BenchRun {
+        cycles,
+        peak_memory,
+        tx_size: tx.data().as_slice().len(),
+        contract_size,
+        memory_profile: parse_memory_profile(&context),
+    }
+}
+
+// lines look like "memory profile: <phase> stack <bytes> lua <bytes> lua peak <bytes> [capped]"
+fn parse_memory_profile(context: &Context) -> Option<(u64, u64, bool)> {
+    let phases = context
+        .captured_messages()
+        .iter()
+        .filter_map(|message| {
+            let at = message.message.find(MEMORY_PROFILE_TAG)?;
+            let fields = message.message[at + MEMORY_PROFILE_TAG.len()..]
+                .split_whitespace()
+                .collect::<Vec<_>>();
+            match fields.as_slice() {
+                [_, "stack", stack, "lua", _, "lua", "peak", lua_peak, capped @ ..] => Some((
+                    stack.parse::<u64>().ok()?,
+                    lua_peak.parse::<u64>().ok()?,
+                    capped == ["capped"],
+                )),
+                _ => None,
+            }
+        })
+        .collect::<Vec<_>>();
+    if phases.is_empty() {
+        return None;
+    }
+    Some(phases.iter().fold((0, 0, false), |(stack, lua, capped), &(s, l, c)| (stack.max(s), lua.max(l), capped || c)))
+}
+
+fn baseline_entry<'a>(baseline: &'a Value, name: &str) -> Option<&'a Value> {
+    baseline["results"]
+        .as_array()?
+        .iter()
+        .find(|result| result["name"] == name)
+}
+
+#[test]
+#[ignore]
+fn bench_settlement_and_challenge() {
+    let filter = env::var("KABLETOP_BENCH_FILTER").unwrap_or_default();
+    let tolerance = env::var("KABLETOP_BENCH_TOLERANCE")
+        .ok()
+        .and_then(|value| value.parse::<f64>().ok())
+        .unwrap_or(0.02);
+    let baseline = fs::read_to_string(BASELINE_PATH)
+        .ok()
+        .and_then(|json| serde_json::from_str::<Value>(&json).ok())
+        .unwrap_or(json!({ "results": [] }));
+
+    // results of binaries other than "kabletop" are named with binary prefix
+    let binaries = env::var("KABLETOP_BENCH_BINARY").unwrap_or("kabletop".into());
+    let mut results = vec![];
+    let mut regressions = vec![];
+    let mut unbaselined = vec![];
+    let mut over_budget = vec![];
+    for binary in binaries.split(',') {
+        for config in bench_configs().iter().filter(|config| config.name().contains(&filter)) {
+            let name = if binary == "kabletop" {
+                config.name()
+            } else {
+                format!("{}:{}", binary, config.name())
+            };
+            let BenchRun { cycles, peak_memory, tx_size, contract_size, memory_profile } = run_bench(binary, config);
+            let mut line = format!(
+                "{:<56} cycles: {:>12}  peak memory: {:>9}  tx size: {:>7}  contract size: {:>8}",
+                name, cycles, peak_memory, tx_size, contract_size
+            );
+            let (stack_peak, lua_heap_peak, stack_capped) = memory_profile.unwrap_or((0, 0, false));
+            if memory_profile.is_some() {
+                line += &format!("  stack: {:>8}{}  lua heap: {:>8}", stack_peak, if stack_capped { "+" } else { "" }, lua_heap_peak);
+                if stack_capped || stack_peak > STACK_BUDGET || lua_heap_peak > lua_heap_budget(config) {
+                    line += "  OVER BUDGET";
+                    over_budget.push(name.clone());
+                }
+            }
+            if let Some(base) = baseline_entry(&baseline, &name) {
+                let base_cycles = base["cycles"].as_u64().unwrap_or(0);
+                let base_memory = base["peak_memory"].as_u64().unwrap_or(0);
+                line += &format!("  ({:+.2}% cycles)", (cycles as f64 / base_cycles as f64 - 1.0) * 100.0);
+                if cycles as f64 > base_cycles as f64 * (1.0 + tolerance)
+                    || peak_memory as f64 > base_memory as f64 * (1.0 + tolerance) {
+                    line += "  REGRESSION";
+                    regressions.push(name.clone());
+                }
+            } else {
+                line += "  NO BASELINE";
+                unbaselined.push(name.clone());
+            }
+            println!("{}", line);
+            results.push(json!({
+                "name": name,
+                "binary": binary,
+                "rounds": config.rounds,
+                "operations": config.operations,
+                "operation_size": config.operation_size,
+                "deck_size": config.deck_size,
+                "celldep_count": config.celldep_count,
+                "challenge_depth": config.challenge_depth,
+                "verified_decks": config.verified_decks,
+                "packed": config.packed,
+                "cycles": cycles,
+                "peak_memory": peak_memory,
+                "tx_size": tx_size,
+                "contract_size": contract_size,
+                "stack_peak": stack_peak,
+                "stack_capped": stack_capped,
+                "lua_heap_peak": lua_heap_peak,
+            }));
+        }
+    }
+
+    let report = serde_json::to_string_pretty(&json!({ "results": results })).unwrap();
+    fs::create_dir_all("bench").expect("bench dir");
+    fs::write(REPORT_PATH, &report).expect("write report");
+    assert!(over_budget.is_empty(), "memory over budget: {:?}", over_budget);
+    if env::var("KABLETOP_BENCH_UPDATE").is_ok() {
+        fs::write(BASELINE_PATH, &report).expect("write baseline");
+        return;
+    }
+    if !unbaselined.is_empty() {
+        eprintln!(
+            "WARNING: no baseline for {:?}, record {} with KABLETOP_BENCH_UPDATE=1 on the reference build",
+            unbaselined, BASELINE_PATH
+        );
+    }
+    let missing = unbaselined
+        .iter()
+        .filter(|name| !name.contains(':'))
+        .collect::<Vec<_>>();
+    assert!(missing.is_empty(), "default binary has no baseline for: {:?}", missing);
+    assert!(regressions.is_empty(), "cycles or memory regressed: {:?}", regressions);
+}
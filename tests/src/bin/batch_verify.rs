@@ -0,0 +1,62 @@
+// Verify archived kabletop transactions on all cores
+//
+// usage: cargo run --release --bin batch_verify -- [-j threads] <mock_tx.json>...
+//
+// every input file is a mock transaction in the format of ckb-standalone-debugger, workers
+// take the next file from a shared index as soon as they finish the previous one, so that
+// long games never leave other cores idle, and each worker keeps its own testtool context
+use std::{env, thread, time::Instant};
+use tests::mock_tx::verify_files;
+
+fn main() {
+    let mut threads = thread::available_parallelism()
+        .map(|n| n.get())
+        .unwrap_or(1);
+    let mut files = vec![];
+    let mut args = env::args().skip(1);
+    while let Some(arg) = args.next() {
+        if arg == "-j" {
+            threads = args
+                .next()
+                .and_then(|n| n.parse().ok())
+                .expect("-j expects a thread count");
+        } else {
+            files.push(arg);
+        }
+    }
+    if files.is_empty() {
+        eprintln!("usage: batch_verify [-j threads] <mock_tx.json>...");
+        std::process::exit(1);
+    }
+
+    let start = Instant::now();
+    let results = verify_files(files.clone(), threads);
+    let elapsed = start.elapsed();
+
+    let mut failed = 0;
+    let mut total_cycles = 0u64;
+    for (file, result) in files.iter().zip(results.iter()) {
+        match result {
+            Ok(cycles) => {
+                total_cycles += cycles;
+                println!("{}\tok\t{}", file, cycles);
+            }
+            Err(err) => {
+                failed += 1;
+                println!("{}\tfail\t{}", file, err);
+            }
+        }
+    }
+    println!(
+        "verified {} transactions ({} failed) with {} threads in {:.2}s, {:.1} tx/s, total cycles: {}",
+        files.len(),
+        failed,
+        threads,
+        elapsed.as_secs_f64(),
+        files.len() as f64 / elapsed.as_secs_f64(),
+        total_cycles
+    );
+    if failed > 0 {
+        std::process::exit(1);
+    }
+}
@@ -0,0 +1,289 @@
+// Decode and compare replay traces of the kabletop contract
+//
+// usage: cargo run --bin kabletop_trace -- <trace> [other trace]
+//
+// a trace is either the raw binary starting with "KTRC" or any text log holding the
+// "kabletop trace: <hex>" debug lines of a contract built with -DKABLETOP_TRACE, such as the
+// output of ckb-debugger, see contracts/c/c/plugin/kabletop/trace.h for the record layout
+//
+// one trace is printed record by record, two traces are walked side by side and the first
+// diverging record is reported with the round and operation it belongs to
+use std::{env, fmt, fs};
+
+const TRACE_TAG: &str = "kabletop trace: ";
+const TRACE_MAGIC: &[u8] = b"KTRC";
+const TRACE_VERSION: u8 = 1;
+const TRACE_FLAG_CYCLES: u8 = 0x01;
+
+#[derive(Clone, PartialEq)]
+enum Event {
+    RoundBegin {
+        round: u16,
+        user_type: u8,
+        seed: [u8; 16],
+    },
+    Operation {
+        round: u16,
+        index: u8,
+        hash: u32,
+        size: u32,
+    },
+    Random(RandomValue),
+    Winner(i64),
+    RoundEnd {
+        round: u16,
+    },
+    Result(i32),
+}
+
+#[derive(Clone, PartialEq)]
+enum RandomValue {
+    Integer(i64),
+    Float(f64),
+}
+
+struct Record {
+    event: Event,
+    cycles: Option<u64>,
+}
+
+impl fmt::Display for Event {
+    fn fmt(&self, f: &mut fmt::Formatter) -> fmt::Result {
+        match self {
+            Event::RoundBegin {
+                round,
+                user_type,
+                seed,
+            } => {
+                write!(
+                    f,
+                    "round {} begin, user {}, seed {}",
+                    round,
+                    user_type,
+                    hex::encode(seed)
+                )
+            }
+            Event::Operation {
+                round,
+                index,
+                hash,
+                size,
+            } => {
+                write!(
+                    f,
+                    "operation [{}-{}] fnv1a {:08x}, {} bytes",
+                    round, index, hash, size
+                )
+            }
+            Event::Random(RandomValue::Integer(value)) => write!(f, "random {}", value),
+            Event::Random(RandomValue::Float(value)) => write!(f, "random {:?}", value),
+            Event::Winner(winner) => write!(f, "winner {}", winner),
+            Event::RoundEnd { round } => write!(f, "round {} end", round),
+            Event::Result(code) => write!(f, "result {}", code),
+        }
+    }
+}
+
+struct Reader<'a> {
+    bytes: &'a [u8],
+    offset: usize,
+}
+
+impl<'a> Reader<'a> {
+    fn take(&mut self, size: usize) -> Result<&'a [u8], String> {
+        if self.offset + size > self.bytes.len() {
+            return Err(format!("truncated trace at byte {}", self.offset));
+        }
+        let bytes = &self.bytes[self.offset..self.offset + size];
+        self.offset += size;
+        Ok(bytes)
+    }
+
+    fn array<const N: usize>(&mut self) -> Result<[u8; N], String> {
+        let mut array = [0u8; N];
+        array.copy_from_slice(self.take(N)?);
+        Ok(array)
+    }
+
+    fn u8(&mut self) -> Result<u8, String> {
+        Ok(self.take(1)?[0])
+    }
+
+    fn u16(&mut self) -> Result<u16, String> {
+        Ok(u16::from_le_bytes(self.array()?))
+    }
+
+    fn u32(&mut self) -> Result<u32, String> {
+        Ok(u32::from_le_bytes(self.array()?))
+    }
+
+    fn u64(&mut self) -> Result<u64, String> {
+        Ok(u64::from_le_bytes(self.array()?))
+    }
+}
+
+// raw binary traces are used as they are, otherwise hex payloads of the trace lines are
+// concatenated in the order they were printed
+fn load_trace(path: &str) -> Result<Vec<u8>, String> {
+    let bytes = fs::read(path).map_err(|err| format!("{}: {}", path, err))?;
+    if bytes.starts_with(TRACE_MAGIC) {
+        return Ok(bytes);
+    }
+    let text = String::from_utf8_lossy(&bytes);
+    let mut trace = vec![];
+    for line in text.lines() {
+        if let Some(at) = line.find(TRACE_TAG) {
+            let payload = line[at + TRACE_TAG.len()..].trim();
+            let payload = payload.trim_end_matches('"');
+            trace.extend(hex::decode(payload).map_err(|err| format!("{}: {}", path, err))?);
+        }
+    }
+    if trace.is_empty() {
+        return Err(format!("{}: no kabletop trace found", path));
+    }
+    Ok(trace)
+}
+
+fn decode(bytes: &[u8]) -> Result<Vec<Record>, String> {
+    let mut reader = Reader { bytes, offset: 0 };
+    if reader.take(TRACE_MAGIC.len())? != TRACE_MAGIC {
+        return Err("missing KTRC header".to_string());
+    }
+    let version = reader.u8()?;
+    if version != TRACE_VERSION {
+        return Err(format!("unsupported trace version {}", version));
+    }
+    let with_cycles = reader.u8()? & TRACE_FLAG_CYCLES != 0;
+    let mut records = vec![];
+    while reader.offset < bytes.len() {
+        let event = match reader.u8()? {
+            0x01 => Event::RoundBegin {
+                round: reader.u16()?,
+                user_type: reader.u8()?,
+                seed: reader.array()?,
+            },
+            0x02 => Event::Operation {
+                round: reader.u16()?,
+                index: reader.u8()?,
+                hash: reader.u32()?,
+                size: reader.u32()?,
+            },
+            0x03 => {
+                let kind = reader.u8()?;
+                let value = reader.array::<8>()?;
+                match kind {
+                    0 => Event::Random(RandomValue::Integer(i64::from_le_bytes(value))),
+                    _ => Event::Random(RandomValue::Float(f64::from_le_bytes(value))),
+                }
+            }
+            0x04 => Event::Winner(reader.u64()? as i64),
+            0x05 => Event::RoundEnd {
+                round: reader.u16()?,
+            },
+            0x06 => Event::Result(reader.u32()? as i32),
+            tag => {
+                return Err(format!(
+                    "unknown record tag {:#04x} at byte {}",
+                    tag,
+                    reader.offset - 1
+                ))
+            }
+        };
+        let cycles = if with_cycles {
+            Some(reader.u64()?)
+        } else {
+            None
+        };
+        records.push(Record { event, cycles });
+    }
+    Ok(records)
+}
+
+fn print_record(n: usize, record: &Record) {
+    match record.cycles {
+        Some(cycles) => println!("{:>6}  {:>12}  {}", n, cycles, record.event),
+        None => println!("{:>6}  {}", n, record.event),
+    }
+}
+
+// round and operation the record at n happens in, found from the records before it
+fn context(records: &[Record], n: usize) -> String {
+    let mut round = None;
+    let mut operation = None;
+    for record in records.iter().take(n + 1) {
+        match record.event {
+            Event::RoundBegin { round: r, .. } => {
+                round = Some(r);
+                operation = None;
+            }
+            Event::Operation {
+                round: r, index, ..
+            } => {
+                round = Some(r);
+                operation = Some(index);
+            }
+            _ => {}
+        }
+    }
+    match (round, operation) {
+        (Some(round), Some(index)) => format!("operation [{}-{}]", round, index),
+        (Some(round), None) => format!("round {}", round),
+        _ => "start of replay".to_string(),
+    }
+}
+
+fn diff(left: &[Record], right: &[Record]) -> bool {
+    let same = left
+        .iter()
+        .zip(right.iter())
+        .take_while(|(left, right)| left.event == right.event)
+        .count();
+    if same == left.len() && same == right.len() {
+        println!("traces match, {} records", same);
+        if let (Some(left), Some(right)) = (left.last(), right.last()) {
+            if let (Some(l), Some(r)) = (left.cycles, right.cycles) {
+                println!("cycles at end: {} vs {}", l, r);
+            }
+        }
+        return true;
+    }
+    let at = if same < left.len() {
+        context(left, same)
+    } else {
+        context(right, same)
+    };
+    println!("traces diverge at record {}, in {}", same, at);
+    for (name, records) in [("left", left), ("right", right)] {
+        match records.get(same) {
+            Some(record) => println!("  {:<5} {}", name, record.event),
+            None => println!("  {:<5} <end of trace>", name),
+        }
+    }
+    false
+}
+
+fn main() {
+    let files = env::args().skip(1).collect::<Vec<_>>();
+    if files.is_empty() || files.len() > 2 {
+        eprintln!("usage: kabletop_trace <trace> [other trace]");
+        std::process::exit(1);
+    }
+    let traces = files
+        .iter()
+        .map(|file| load_trace(file).and_then(|bytes| decode(&bytes)))
+        .collect::<Result<Vec<_>, String>>()
+        .unwrap_or_else(|err| {
+            eprintln!("{}", err);
+            std::process::exit(1);
+        });
+
+    if traces.len() == 1 {
+        for (n, record) in traces[0].iter().enumerate() {
+            print_record(n, record);
+        }
+        return;
+    }
+    if !diff(&traces[0], &traces[1]) {
+        std::process::exit(1);
+    }
+}
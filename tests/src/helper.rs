@@ -8,6 +8,7 @@ use ckb_tool::ckb_types::{
     H256,
 };
 use std::convert::TryInto;
+use super::protocol;
 
 #[allow(dead_code)]
 pub const CODE_HASH_SECP256K1_BLAKE160: [u8; 32] = [
@@ -70,15 +71,41 @@ pub fn gen_witnesses_and_signatures(
     (witnesses, all_signatures)
 }
 
+// pack round witnesses into a single one which leaves lock empty and carries SignedRounds
+// in input_type, channel hash stays in output_type
+#[allow(dead_code)]
+pub fn pack_witnesses(witnesses: Vec<WitnessArgs>) -> Vec<WitnessArgs> {
+    let snapshot = witnesses
+        .iter()
+        .map(|witness| {
+            let round = witness.input_type().to_opt().expect("round").raw_data();
+            let signature = witness.lock().to_opt().expect("signature").raw_data();
+            (round, signature.as_ref().try_into().expect("signature size"))
+        })
+        .collect::<Vec<(Bytes, [u8; 65])>>();
+    let rounds = Bytes::from(protocol::to_vec(&protocol::signed_rounds(snapshot)));
+    vec![WitnessArgs::new_builder()
+        .input_type(Some(rounds).pack())
+        .output_type(witnesses[0].output_type())
+        .build()]
+}
+
 #[allow(dead_code)]
 pub fn sign_tx(tx: TransactionView, key: &Privkey, extra_witnesses: Vec<WitnessArgs>) -> TransactionView {
+    sign_tx_with_witness(tx, key, WitnessArgs::default(), extra_witnesses)
+}
+
+// sign with a group witness which carries extra data, such as nft reveals in output_type
+#[allow(dead_code)]
+pub fn sign_tx_with_witness(
+    tx: TransactionView, key: &Privkey, witness: WitnessArgs, extra_witnesses: Vec<WitnessArgs>
+) -> TransactionView {
     let tx_hash = tx.hash();
     let mut signed_witnesses: Vec<packed::Bytes> = Vec::new();
     let mut blake2b = new_blake2b();
     let mut message = [0u8; 32];
     blake2b.update(&tx_hash.raw_data());
     // digest the first witness
-    let witness = WitnessArgs::default();
     let zero_lock: Bytes = {
         let mut buf = Vec::new();
         buf.resize(SIGNATURE_SIZE, 0);
@@ -116,3 +143,53 @@ pub fn sign_tx(tx: TransactionView, key: &Privkey, extra_witnesses: Vec<WitnessA
         .set_witnesses(signed_witnesses)
         .build()
 }
+
+#[allow(dead_code)]
+pub fn sign_batch_tx(tx: TransactionView, groups: Vec<(&Privkey, Bytes)>, extra_witnesses: Vec<WitnessArgs>) -> TransactionView {
+    let tx_hash = tx.hash();
+    let mut signed_witnesses: Vec<packed::Bytes> = Vec::new();
+    let zero_lock: Bytes = {
+        let mut buf = Vec::new();
+        buf.resize(SIGNATURE_SIZE, 0);
+        buf.into()
+    };
+    // every channel group signs its own witness which carries the round layout in input_type
+    for (key, layout) in groups {
+        let mut blake2b = new_blake2b();
+        let mut message = [0u8; 32];
+        blake2b.update(&tx_hash.raw_data());
+        let witness = WitnessArgs::new_builder()
+            .input_type(Some(layout).pack())
+            .build();
+        let witness_for_digest = witness
+            .clone()
+            .as_builder()
+            .lock(Some(zero_lock.clone()).pack())
+            .build();
+        let witness_len = witness_for_digest.as_bytes().len() as u64;
+        blake2b.update(&witness_len.to_le_bytes());
+        blake2b.update(&witness_for_digest.as_bytes());
+        for witness in &extra_witnesses {
+            let witness_len = witness.as_bytes().len() as u64;
+            blake2b.update(&witness_len.to_le_bytes());
+            blake2b.update(&witness.as_bytes());
+        }
+        blake2b.finalize(&mut message);
+        let message = H256::from(message);
+        let sig = key.sign_recoverable(&message).expect("sign");
+        signed_witnesses.push(
+            witness
+                .as_builder()
+                .lock(Some(Bytes::from(sig.serialize())).pack())
+                .build()
+                .as_bytes()
+                .pack(),
+        );
+    }
+    for witness in &extra_witnesses {
+        signed_witnesses.push(witness.as_bytes().pack());
+    }
+    tx.as_advanced_builder()
+        .set_witnesses(signed_witnesses)
+        .build()
+}
@@ -0,0 +1,178 @@
+use super::{
+    helper::gen_witnesses_and_signatures,
+    mock_tx, protocol,
+    tests::{build_batch_tx, get_keypair, get_nfts, get_round},
+};
+use ckb_testtool::context::Context;
+use ckb_tool::ckb_hash::blake2b_256;
+use ckb_tool::ckb_types::{bytes::Bytes, packed::Script, prelude::*};
+use std::{env, fs, process::Command};
+
+// the native verifier is built apart from the contract, so these tests are run with
+// `make -C contracts/c host && cargo test host -- --ignored`
+const HOST_BINARY: &str = "../contracts/c/build/kabletop-host";
+const CHANNEL_BINARY: &str = "../contracts/c/build/kabletop-channel";
+
+// runs the lock group of input at script_index through kabletop-host, which prints
+// "<file>: <error code>" like kabletop_verify returns it
+pub fn host_verify(name: &str, tx_json: &str, script_index: usize) -> i32 {
+    let mut path = env::temp_dir();
+    path.push(format!("kabletop-{}-{}.json", name, std::process::id()));
+    fs::write(&path, tx_json).expect("write mock tx");
+    let output = Command::new(HOST_BINARY)
+        .arg(&path)
+        .arg(script_index.to_string())
+        .output()
+        .expect("run kabletop-host, build it with make -C contracts/c host");
+    fs::remove_file(&path).ok();
+    let stdout = String::from_utf8_lossy(&output.stdout);
+    let line = stdout
+        .lines()
+        .last()
+        .expect("kabletop-host prints its result");
+    line.rsplit(": ")
+        .next()
+        .and_then(|code| code.trim().parse::<i32>().ok())
+        .expect("error code")
+}
+
+#[test]
+#[ignore]
+fn test_host_batch_to_settlement() {
+    // both channels of the batch have more than one input ahead of their rounds, native and
+    // on-chain verifiers must agree on each of them
+    let mut context = Context::default();
+    let tx = build_batch_tx(&mut context, true, false);
+    context
+        .verify_tx(&tx, super::helper::MAX_CYCLES)
+        .expect("pass test_host_batch_to_settlement");
+    let tx_json = mock_tx::to_json(&context, &tx);
+    for script_index in 0..tx.inputs().len() {
+        assert_eq!(host_verify("batch", &tx_json, script_index), 0);
+    }
+}
+
+#[test]
+#[ignore]
+fn test_host_shared_payout_batch_to_settlement() {
+    // the second channel claims the payout of the first one, which both verifiers reject with
+    // KABLETOP_WRONG_ROUND_LAYOUT
+    let mut context = Context::default();
+    let tx = build_batch_tx(&mut context, true, true);
+    assert!(context.verify_tx(&tx, super::helper::MAX_CYCLES).is_err());
+    let tx_json = mock_tx::to_json(&context, &tx);
+    assert_eq!(host_verify("shared-payout", &tx_json, 1), 21);
+}
+
+// replays rounds through kabletop-channel and returns what it prints, see c/host/channel.c
+fn channel_replay(name: &str, lines: Vec<String>) -> Vec<String> {
+    let mut path = env::temp_dir();
+    path.push(format!("kabletop-{}-{}.txt", name, std::process::id()));
+    fs::write(&path, lines.join("\n")).expect("write rounds");
+    let output = Command::new(CHANNEL_BINARY)
+        .arg(&path)
+        .output()
+        .expect("run kabletop-channel, build it with make -C contracts/c host");
+    fs::remove_file(&path).ok();
+    String::from_utf8_lossy(&output.stdout)
+        .lines()
+        .filter(|line| {
+            line.starts_with("round ") || line.starts_with("winner: ") || line.starts_with("open: ")
+        })
+        .map(|line| line.to_string())
+        .collect()
+}
+
+fn signed_channel_rounds(tamper: Option<usize>) -> Vec<String> {
+    // the same game as test_success_origin_to_settlement, signed the way the lock checks it
+    let (user1_privkey, user1_pkhash) = get_keypair();
+    let (user2_privkey, user2_pkhash) = get_keypair();
+    let lock_args_molecule = (
+        500u64,
+        5u8,
+        1024u64,
+        [0u8; 32],
+        user1_pkhash,
+        get_nfts(5),
+        user2_pkhash,
+        get_nfts(5),
+    );
+    let lock_args = protocol::to_vec(&protocol::lock_args(lock_args_molecule, vec![]));
+    let lock_script = Script::new_builder()
+        .code_hash(blake2b_256(b"kabletop").pack())
+        .args(Bytes::from(lock_args.clone()).pack())
+        .build();
+    let rounds = vec![
+        (
+            &user2_privkey,
+            get_round(
+                1u8,
+                vec!["ckb.debug('user1 draw one card, and spell it adding HP.')"],
+            ),
+        ),
+        (
+            &user1_privkey,
+            get_round(
+                2u8,
+                vec!["ckb.debug('user2 draw one card, and spell it to damage user1.')"],
+            ),
+        ),
+        (
+            &user2_privkey,
+            get_round(
+                1u8,
+                vec!["ckb.debug('user1 draw one card, and use it to kill user2.')"],
+            ),
+        ),
+        (&user1_privkey, get_round(2u8, vec!["_winner = 1"])),
+    ];
+    let (_, mut signatures) = gen_witnesses_and_signatures(&lock_script, 2000u64, rounds.clone());
+    if let Some(i) = tamper {
+        // a signature of the previous round never chains into round i
+        signatures[i] = signatures[i - 1];
+    }
+    let mut lines = vec![
+        format!("args {}", hex::encode(&lock_args)),
+        format!(
+            "lock_hash {}",
+            hex::encode(lock_script.calc_script_hash().as_slice())
+        ),
+        format!("channel_hash {}", hex::encode(blake2b_256([1]))),
+    ];
+    for ((_, round), signature) in rounds.iter().zip(signatures.iter()) {
+        lines.push(format!(
+            "round {} {}",
+            hex::encode(round),
+            hex::encode(&signature[..])
+        ));
+    }
+    lines
+}
+
+#[test]
+#[ignore]
+fn test_host_channel_rounds() {
+    // every round of a correctly signed sequence is accepted one at a time and the game ends
+    // with the same winner as on-chain
+    let output = channel_replay("channel", signed_channel_rounds(None));
+    assert_eq!(
+        output,
+        vec![
+            "round 0: 0",
+            "round 1: 0",
+            "round 2: 0",
+            "round 3: 0",
+            "winner: 1"
+        ]
+    );
+}
+
+#[test]
+#[ignore]
+fn test_host_channel_wrong_signature() {
+    // a round signed over another message stops the channel right at that round
+    let output = channel_replay("channel-tampered", signed_channel_rounds(Some(2)));
+    assert_eq!(output.len(), 3);
+    assert_eq!(output[..2], ["round 0: 0", "round 1: 0"]);
+    assert_ne!(output[2], "round 2: 0");
+}
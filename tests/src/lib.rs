@@ -6,8 +6,17 @@ use std::str::FromStr;
 
 #[cfg(test)]
 mod tests;
+#[cfg(test)]
+mod variants;
+#[cfg(test)]
+mod bench;
+#[cfg(test)]
+mod profile;
+#[cfg(test)]
+mod host;
 mod helper;
 mod protocol;
+pub mod mock_tx;
 
 const TEST_ENV_VAR: &str = "CAPSULE_TEST_ENV";
 
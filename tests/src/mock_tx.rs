@@ -0,0 +1,283 @@
+// Mock transactions in the format of ckb-standalone-debugger
+//
+// parsed and verified by the batch_verify tool, and dumped by tests which hand transactions
+// over to the native verifier or to batch_verify
+use ckb_testtool::context::Context;
+use ckb_tool::ckb_types::{
+    bytes::Bytes,
+    core::{TransactionBuilder, TransactionView},
+    packed::{self, Byte, CellDep, CellInput, CellOutput, OutPoint, Script},
+    prelude::*,
+};
+use serde_json::{json, Value};
+use std::{
+    fs,
+    sync::{
+        atomic::{AtomicUsize, Ordering},
+        Arc, Mutex,
+    },
+    thread,
+};
+
+pub const MAX_CYCLES: u64 = 3_500_000_000;
+
+fn hex_bytes(value: &Value) -> Result<Bytes, String> {
+    let text = value.as_str().ok_or("expect hex string")?;
+    let text = text.trim_start_matches("0x");
+    hex::decode(text)
+        .map(Bytes::from)
+        .map_err(|err| format!("invalid hex {}: {}", text, err))
+}
+
+fn hex_u64(value: &Value) -> Result<u64, String> {
+    let text = value.as_str().ok_or("expect hex number")?;
+    u64::from_str_radix(text.trim_start_matches("0x"), 16).map_err(|err| err.to_string())
+}
+
+fn hash(value: &Value) -> Result<[u8; 32], String> {
+    let bytes = hex_bytes(value)?;
+    if bytes.len() != 32 {
+        return Err(format!("invalid hash length {}", bytes.len()));
+    }
+    let mut hash = [0u8; 32];
+    hash.copy_from_slice(&bytes);
+    Ok(hash)
+}
+
+fn out_point(value: &Value) -> Result<OutPoint, String> {
+    Ok(OutPoint::new_builder()
+        .tx_hash(hash(&value["tx_hash"])?.pack())
+        .index((hex_u64(&value["index"])? as u32).pack())
+        .build())
+}
+
+fn script(value: &Value) -> Result<Script, String> {
+    let hash_type = match value["hash_type"].as_str() {
+        Some("data") => 0u8,
+        Some("type") => 1u8,
+        Some("data1") => 2u8,
+        _ => return Err("invalid hash_type".into()),
+    };
+    Ok(Script::new_builder()
+        .code_hash(hash(&value["code_hash"])?.pack())
+        .hash_type(Byte::new(hash_type))
+        .args(hex_bytes(&value["args"])?.pack())
+        .build())
+}
+
+fn cell_output(value: &Value) -> Result<CellOutput, String> {
+    let type_ = match &value["type"] {
+        Value::Null => None,
+        type_ => Some(script(type_)?),
+    };
+    Ok(CellOutput::new_builder()
+        .capacity(hex_u64(&value["capacity"])?.pack())
+        .lock(script(&value["lock"])?)
+        .type_(type_.pack())
+        .build())
+}
+
+fn cell_dep(value: &Value) -> Result<CellDep, String> {
+    let dep_type = match value["dep_type"].as_str() {
+        Some("code") => 0u8,
+        Some("dep_group") => 1u8,
+        _ => return Err("invalid dep_type".into()),
+    };
+    Ok(CellDep::new_builder()
+        .out_point(out_point(&value["out_point"])?)
+        .dep_type(Byte::new(dep_type))
+        .build())
+}
+
+fn array(value: &Value) -> Vec<Value> {
+    value.as_array().cloned().unwrap_or_default()
+}
+
+// fill context with cells from mock_info and return the cycles of verifying transaction
+pub fn verify(context: &mut Context, mock_tx: &Value) -> Result<u64, String> {
+    let mock_info = &mock_tx["mock_info"];
+    for input in array(&mock_info["inputs"]) {
+        context.create_cell_with_out_point(
+            out_point(&input["input"]["previous_output"])?,
+            cell_output(&input["output"])?,
+            hex_bytes(&input["data"])?,
+        );
+    }
+    for dep in array(&mock_info["cell_deps"]) {
+        context.create_cell_with_out_point(
+            out_point(&dep["cell_dep"]["out_point"])?,
+            cell_output(&dep["output"])?,
+            hex_bytes(&dep["data"])?,
+        );
+    }
+
+    let tx = &mock_tx["tx"];
+    let mut builder =
+        TransactionBuilder::default().version((hex_u64(&tx["version"])? as u32).pack());
+    for dep in array(&tx["cell_deps"]) {
+        builder = builder.cell_dep(cell_dep(&dep)?);
+    }
+    for header in array(&tx["header_deps"]) {
+        builder = builder.header_dep(hash(&header)?.pack());
+    }
+    for input in array(&tx["inputs"]) {
+        builder = builder.input(
+            CellInput::new_builder()
+                .previous_output(out_point(&input["previous_output"])?)
+                .since(hex_u64(&input["since"])?.pack())
+                .build(),
+        );
+    }
+    for output in array(&tx["outputs"]) {
+        builder = builder.output(cell_output(&output)?);
+    }
+    for data in array(&tx["outputs_data"]) {
+        builder = builder.output_data(hex_bytes(&data)?.pack());
+    }
+    let witnesses = array(&tx["witnesses"])
+        .iter()
+        .map(|witness| hex_bytes(witness).map(|bytes| bytes.pack()))
+        .collect::<Result<Vec<packed::Bytes>, String>>()?;
+    let tx = builder.set_witnesses(witnesses).build();
+
+    context
+        .verify_tx(&tx, MAX_CYCLES)
+        .map_err(|err| err.to_string())
+}
+
+// verify mock transactions of files on a pool of threads, workers take the next file from a
+// shared index as soon as they finish the previous one, so that long games never leave other
+// threads idle, and each worker keeps its own testtool context, results keep the file order
+pub fn verify_files(files: Vec<String>, threads: usize) -> Vec<Result<u64, String>> {
+    let files = Arc::new(files);
+    let next = Arc::new(AtomicUsize::new(0));
+    let results = Arc::new(Mutex::new(vec![None; files.len()]));
+    let workers = (0..threads.max(1).min(files.len()))
+        .map(|_| {
+            let files = files.clone();
+            let next = next.clone();
+            let results = results.clone();
+            thread::spawn(move || {
+                let mut context = Context::default();
+                loop {
+                    let i = next.fetch_add(1, Ordering::Relaxed);
+                    if i >= files.len() {
+                        break;
+                    }
+                    let result = fs::read_to_string(&files[i])
+                        .map_err(|err| err.to_string())
+                        .and_then(|json| {
+                            serde_json::from_str::<Value>(&json).map_err(|err| err.to_string())
+                        })
+                        .and_then(|mock_tx| verify(&mut context, &mock_tx));
+                    results.lock().unwrap()[i] = Some(result);
+                }
+            })
+        })
+        .collect::<Vec<_>>();
+    for worker in workers {
+        worker.join().expect("worker");
+    }
+    let results = results.lock().unwrap();
+    results
+        .iter()
+        .map(|result| result.clone().expect("verified by a worker"))
+        .collect()
+}
+
+fn to_hex(bytes: &[u8]) -> String {
+    format!("0x{}", hex::encode(bytes))
+}
+
+fn to_hex_u64(value: u64) -> String {
+    format!("{:#x}", value)
+}
+
+fn out_point_json(out_point: &OutPoint) -> Value {
+    let index: u32 = out_point.index().unpack();
+    json!({
+        "tx_hash": to_hex(out_point.tx_hash().as_slice()),
+        "index": to_hex_u64(index as u64),
+    })
+}
+
+fn script_json(script: &Script) -> Value {
+    let hash_type = match script.hash_type().as_slice()[0] {
+        0 => "data",
+        1 => "type",
+        _ => "data1",
+    };
+    json!({
+        "code_hash": to_hex(script.code_hash().as_slice()),
+        "hash_type": hash_type,
+        "args": to_hex(&script.args().raw_data()),
+    })
+}
+
+fn cell_output_json(output: &CellOutput) -> Value {
+    json!({
+        "capacity": to_hex_u64(output.capacity().unpack()),
+        "lock": script_json(&output.lock()),
+        "type": output.type_().to_opt().map(|type_| script_json(&type_)),
+    })
+}
+
+// dump a transaction built in a testtool context the way ckb-standalone-debugger does
+pub fn to_json(context: &Context, tx: &TransactionView) -> String {
+    let cell = |out_point: &OutPoint| -> (CellOutput, Bytes) {
+        context.get_cell(out_point).expect("live cell")
+    };
+    let inputs = tx
+        .inputs()
+        .into_iter()
+        .map(|input| {
+            let (output, data) = cell(&input.previous_output());
+            json!({
+                "input": {
+                    "since": to_hex_u64(input.since().unpack()),
+                    "previous_output": out_point_json(&input.previous_output()),
+                },
+                "output": cell_output_json(&output),
+                "data": to_hex(&data),
+            })
+        })
+        .collect::<Vec<_>>();
+    let cell_dep_json = |dep: &CellDep| {
+        json!({
+            "out_point": out_point_json(&dep.out_point()),
+            "dep_type": (if dep.dep_type().as_slice()[0] == 0 { "code" } else { "dep_group" }),
+        })
+    };
+    let cell_deps = tx
+        .cell_deps()
+        .into_iter()
+        .map(|dep| {
+            let (output, data) = cell(&dep.out_point());
+            json!({
+                "cell_dep": cell_dep_json(&dep),
+                "output": cell_output_json(&output),
+                "data": to_hex(&data),
+            })
+        })
+        .collect::<Vec<_>>();
+    let mock_tx = json!({
+        "mock_info": {
+            "inputs": inputs,
+            "cell_deps": cell_deps,
+            "header_deps": [],
+        },
+        "tx": {
+            "version": to_hex_u64(tx.version() as u64),
+            "cell_deps": tx.cell_deps().into_iter().map(|dep| cell_dep_json(&dep)).collect::<Vec<_>>(),
+            "header_deps": [],
+            "inputs": tx.inputs().into_iter().map(|input| json!({
+                "since": to_hex_u64(input.since().unpack()),
+                "previous_output": out_point_json(&input.previous_output()),
+            })).collect::<Vec<_>>(),
+            "outputs": tx.outputs().into_iter().map(|output| cell_output_json(&output)).collect::<Vec<_>>(),
+            "outputs_data": tx.outputs_data().into_iter().map(|data| to_hex(&data.raw_data())).collect::<Vec<_>>(),
+            "witnesses": tx.witnesses().into_iter().map(|witness| to_hex(&witness.raw_data())).collect::<Vec<_>>(),
+        },
+    });
+    mock_tx.to_string()
+}
@@ -0,0 +1,194 @@
+use super::{
+    bench::{bench_configs, build_bench_tx},
+    helper::MAX_CYCLES,
+    *,
+};
+use ckb_testtool::context::Context;
+use ckb_tool::ckb_types::{
+    core::TransactionView,
+    packed::{CellDep, CellInput, CellOutput, OutPoint, Script},
+    prelude::*,
+};
+use serde_json::{json, Value};
+use std::{env, fs, process::Command};
+
+// synthetic games of the bench are profiled with `cargo test profile -- --ignored --nocapture`
+//
+// KABLETOP_PROFILE_BINARY    unstripped contract under build/<env>, default "kabletop-profile"
+// KABLETOP_PROFILE_FILTER    only profile configurations whose name contains this string,
+//                            default the base game of the bench
+// KABLETOP_PROFILE_DEBUGGER  ckb-debugger executable, default "ckb-debugger"
+//
+// every configuration leaves under profile/:
+//   <name>.json        mock transaction in the format of ckb-standalone-debugger
+//   <name>.lua.folded  lua stacks sampled by the contract, see plugin/kabletop/profile.h
+//   <name>.folded      cycles of C symbols from ckb-debugger --pprof, skipped if it is not installed
+// folded stacks render with flamegraph.pl or inferno-flamegraph
+const PROFILE_DIR: &str = "profile";
+const LUA_PROFILE_TAG: &str = "lua profile: ";
+const OPERATION_CACHE_TAG: &str = "operation cache: ";
+const DEFAULT_FILTER: &str = "settlement-r16-o4x64-d5-l0-c0";
+
+fn hex(bytes: &[u8]) -> String {
+    format!("0x{}", ::hex::encode(bytes))
+}
+
+fn hex_u64(value: u64) -> String {
+    format!("{:#x}", value)
+}
+
+fn script_json(script: &Script) -> Value {
+    let hash_type: u8 = script.hash_type().into();
+    let hash_type = match hash_type {
+        0 => "data",
+        1 => "type",
+        _ => "data1",
+    };
+    json!({
+        "code_hash": hex(script.code_hash().as_slice()),
+        "hash_type": hash_type,
+        "args": hex(&script.args().raw_data()),
+    })
+}
+
+fn cell_output_json(output: &CellOutput) -> Value {
+    let capacity: u64 = output.capacity().unpack();
+    json!({
+        "capacity": hex_u64(capacity),
+        "lock": script_json(&output.lock()),
+        "type": output.type_().to_opt().map(|type_| script_json(&type_)).unwrap_or(Value::Null),
+    })
+}
+
+fn out_point_json(out_point: &OutPoint) -> Value {
+    let index: u32 = out_point.index().unpack();
+    json!({
+        "tx_hash": hex(out_point.tx_hash().as_slice()),
+        "index": hex_u64(index as u64),
+    })
+}
+
+fn cell_input_json(input: &CellInput) -> Value {
+    let since: u64 = input.since().unpack();
+    json!({
+        "previous_output": out_point_json(&input.previous_output()),
+        "since": hex_u64(since),
+    })
+}
+
+fn cell_dep_json(dep: &CellDep) -> Value {
+    let dep_type: u8 = dep.dep_type().into();
+    json!({
+        "out_point": out_point_json(&dep.out_point()),
+        "dep_type": if dep_type == 0 { "code" } else { "dep_group" },
+    })
+}
+
+// the same format batch_verify reads, cells come from the context which built the transaction
+fn mock_tx(context: &Context, tx: &TransactionView) -> Value {
+    let cell = |out_point: &OutPoint| context.cells.get(out_point).cloned().expect("cell of mock tx");
+    let inputs = tx
+        .inputs()
+        .into_iter()
+        .map(|input| {
+            let (output, data) = cell(&input.previous_output());
+            json!({
+                "input": cell_input_json(&input),
+                "output": cell_output_json(&output),
+                "data": hex(&data),
+            })
+        })
+        .collect::<Vec<_>>();
+    let cell_deps = tx
+        .cell_deps()
+        .into_iter()
+        .map(|dep| {
+            let (output, data) = cell(&dep.out_point());
+            json!({
+                "cell_dep": cell_dep_json(&dep),
+                "output": cell_output_json(&output),
+                "data": hex(&data),
+            })
+        })
+        .collect::<Vec<_>>();
+    json!({
+        "mock_info": {
+            "inputs": inputs,
+            "cell_deps": cell_deps,
+            "header_deps": [],
+        },
+        "tx": {
+            "version": hex_u64(tx.version() as u64),
+            "cell_deps": tx.cell_deps().into_iter().map(|dep| cell_dep_json(&dep)).collect::<Vec<_>>(),
+            "header_deps": [],
+            "inputs": tx.inputs().into_iter().map(|input| cell_input_json(&input)).collect::<Vec<_>>(),
+            "outputs": tx.outputs().into_iter().map(|output| cell_output_json(&output)).collect::<Vec<_>>(),
+            "outputs_data": tx.outputs_data().into_iter().map(|data| hex(&data.raw_data())).collect::<Vec<_>>(),
+            "witnesses": tx.witnesses().into_iter().map(|witness| hex(&witness.raw_data())).collect::<Vec<_>>(),
+        },
+    })
+}
+
+// lines look like "lua profile: <frame>;<frame>;... <samples>"
+fn lua_folded_stacks(context: &Context) -> Vec<String> {
+    context
+        .captured_messages()
+        .iter()
+        .filter_map(|message| {
+            let at = message.message.find(LUA_PROFILE_TAG)?;
+            let line = message.message[at + LUA_PROFILE_TAG.len()..].trim();
+            let split = line.rfind(' ')?;
+            line[split + 1..].parse::<u64>().ok()?;
+            Some(line.to_string())
+        })
+        .collect()
+}
+
+#[test]
+#[ignore]
+fn profile_settlement_and_challenge() {
+    let binary = env::var("KABLETOP_PROFILE_BINARY").unwrap_or("kabletop-profile".to_string());
+    let filter = env::var("KABLETOP_PROFILE_FILTER").unwrap_or(DEFAULT_FILTER.to_string());
+    let debugger = env::var("KABLETOP_PROFILE_DEBUGGER").unwrap_or("ckb-debugger".to_string());
+    let mut binary_path = Loader::default().0;
+    binary_path.push(&binary);
+    fs::create_dir_all(PROFILE_DIR).expect("create profile dir");
+
+    for config in bench_configs().iter().filter(|config| config.name().contains(&filter)) {
+        let name = config.name();
+        let mut context = Context::default();
+        context.set_capture_debug(true);
+        let (tx, _) = build_bench_tx(&mut context, &binary, config);
+        let cycles = context
+            .verify_tx(&tx, MAX_CYCLES * 20)
+            .expect(&format!("pass profile {}", name));
+
+        let tx_path = format!("{}/{}.json", PROFILE_DIR, name);
+        let json = serde_json::to_string_pretty(&mock_tx(&context, &tx)).unwrap();
+        fs::write(&tx_path, json).expect("write mock tx");
+        let lua_stacks = lua_folded_stacks(&context);
+        let lua_path = format!("{}/{}.lua.folded", PROFILE_DIR, name);
+        fs::write(&lua_path, lua_stacks.join("\n") + "\n").expect("write lua folded stacks");
+        println!("{}: cycles {}, {} lua stacks in {}", name, cycles, lua_stacks.len(), lua_path);
+        if let Some(cache) = context.captured_messages().iter().find_map(|message| {
+            let at = message.message.find(OPERATION_CACHE_TAG)?;
+            Some(message.message[at..].trim().to_string())
+        }) {
+            println!("{}: {}", name, cache);
+        }
+
+        // the kabletop lock is the script of input 0, symbols come from the unstripped binary
+        let c_path = format!("{}/{}.folded", PROFILE_DIR, name);
+        let status = Command::new(&debugger)
+            .args(&["--tx-file", &tx_path, "--script-group-type", "lock", "--cell-type", "input", "--cell-index", "0"])
+            .arg("--bin")
+            .arg(&binary_path)
+            .args(&["--pprof", &c_path])
+            .status();
+        match status {
+            Ok(status) if status.success() => println!("{}: C symbol cycles in {}", name, c_path),
+            Ok(status) => panic!("{} failed on {}: {}", debugger, tx_path, status),
+            Err(err) => println!("{}: skip C symbol cycles, {} is not available: {}", name, debugger, err),
+        }
+    }
+}
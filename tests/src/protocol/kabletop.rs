@@ -167,6 +167,181 @@ impl molecule::prelude::Builder for Uint8TBuilder {
     }
 }
 #[derive(Clone)]
+pub struct Uint16T(molecule::bytes::Bytes);
+impl ::core::fmt::LowerHex for Uint16T {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        use molecule::hex_string;
+        if f.alternate() {
+            write!(f, "0x")?;
+        }
+        write!(f, "{}", hex_string(self.as_slice()))
+    }
+}
+impl ::core::fmt::Debug for Uint16T {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{}({:#x})", Self::NAME, self)
+    }
+}
+impl ::core::fmt::Display for Uint16T {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        use molecule::hex_string;
+        let raw_data = hex_string(&self.raw_data());
+        write!(f, "{}(0x{})", Self::NAME, raw_data)
+    }
+}
+impl ::core::default::Default for Uint16T {
+    fn default() -> Self {
+        let v: Vec<u8> = vec![0, 0];
+        Uint16T::new_unchecked(v.into())
+    }
+}
+impl Uint16T {
+    pub const TOTAL_SIZE: usize = 2;
+    pub const ITEM_SIZE: usize = 1;
+    pub const ITEM_COUNT: usize = 2;
+    pub fn nth0(&self) -> Byte {
+        Byte::new_unchecked(self.0.slice(0..1))
+    }
+    pub fn nth1(&self) -> Byte {
+        Byte::new_unchecked(self.0.slice(1..2))
+    }
+    pub fn raw_data(&self) -> molecule::bytes::Bytes {
+        self.as_bytes()
+    }
+    pub fn as_reader<'r>(&'r self) -> Uint16TReader<'r> {
+        Uint16TReader::new_unchecked(self.as_slice())
+    }
+}
+impl molecule::prelude::Entity for Uint16T {
+    type Builder = Uint16TBuilder;
+    const NAME: &'static str = "Uint16T";
+    fn new_unchecked(data: molecule::bytes::Bytes) -> Self {
+        Uint16T(data)
+    }
+    fn as_bytes(&self) -> molecule::bytes::Bytes {
+        self.0.clone()
+    }
+    fn as_slice(&self) -> &[u8] {
+        &self.0[..]
+    }
+    fn from_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
+        Uint16TReader::from_slice(slice).map(|reader| reader.to_entity())
+    }
+    fn from_compatible_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
+        Uint16TReader::from_compatible_slice(slice).map(|reader| reader.to_entity())
+    }
+    fn new_builder() -> Self::Builder {
+        ::core::default::Default::default()
+    }
+    fn as_builder(self) -> Self::Builder {
+        Self::new_builder().set([self.nth0(), self.nth1()])
+    }
+}
+#[derive(Clone, Copy)]
+pub struct Uint16TReader<'r>(&'r [u8]);
+impl<'r> ::core::fmt::LowerHex for Uint16TReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        use molecule::hex_string;
+        if f.alternate() {
+            write!(f, "0x")?;
+        }
+        write!(f, "{}", hex_string(self.as_slice()))
+    }
+}
+impl<'r> ::core::fmt::Debug for Uint16TReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{}({:#x})", Self::NAME, self)
+    }
+}
+impl<'r> ::core::fmt::Display for Uint16TReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        use molecule::hex_string;
+        let raw_data = hex_string(&self.raw_data());
+        write!(f, "{}(0x{})", Self::NAME, raw_data)
+    }
+}
+impl<'r> Uint16TReader<'r> {
+    pub const TOTAL_SIZE: usize = 2;
+    pub const ITEM_SIZE: usize = 1;
+    pub const ITEM_COUNT: usize = 2;
+    pub fn nth0(&self) -> ByteReader<'r> {
+        ByteReader::new_unchecked(&self.as_slice()[0..1])
+    }
+    pub fn nth1(&self) -> ByteReader<'r> {
+        ByteReader::new_unchecked(&self.as_slice()[1..2])
+    }
+    pub fn raw_data(&self) -> &'r [u8] {
+        self.as_slice()
+    }
+}
+impl<'r> molecule::prelude::Reader<'r> for Uint16TReader<'r> {
+    type Entity = Uint16T;
+    const NAME: &'static str = "Uint16TReader";
+    fn to_entity(&self) -> Self::Entity {
+        Self::Entity::new_unchecked(self.as_slice().to_owned().into())
+    }
+    fn new_unchecked(slice: &'r [u8]) -> Self {
+        Uint16TReader(slice)
+    }
+    fn as_slice(&self) -> &'r [u8] {
+        self.0
+    }
+    fn verify(slice: &[u8], _compatible: bool) -> molecule::error::VerificationResult<()> {
+        use molecule::verification_error as ve;
+        let slice_len = slice.len();
+        if slice_len != Self::TOTAL_SIZE {
+            return ve!(Self, TotalSizeNotMatch, Self::TOTAL_SIZE, slice_len);
+        }
+        Ok(())
+    }
+}
+pub struct Uint16TBuilder(pub(crate) [Byte; 2]);
+impl ::core::fmt::Debug for Uint16TBuilder {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{}({:?})", Self::NAME, &self.0[..])
+    }
+}
+impl ::core::default::Default for Uint16TBuilder {
+    fn default() -> Self {
+        Uint16TBuilder([Byte::default(), Byte::default()])
+    }
+}
+impl Uint16TBuilder {
+    pub const TOTAL_SIZE: usize = 2;
+    pub const ITEM_SIZE: usize = 1;
+    pub const ITEM_COUNT: usize = 2;
+    pub fn set(mut self, v: [Byte; 2]) -> Self {
+        self.0 = v;
+        self
+    }
+    pub fn nth0(mut self, v: Byte) -> Self {
+        self.0[0] = v;
+        self
+    }
+    pub fn nth1(mut self, v: Byte) -> Self {
+        self.0[1] = v;
+        self
+    }
+}
+impl molecule::prelude::Builder for Uint16TBuilder {
+    type Entity = Uint16T;
+    const NAME: &'static str = "Uint16TBuilder";
+    fn expected_length(&self) -> usize {
+        Self::TOTAL_SIZE
+    }
+    fn write<W: ::molecule::io::Write>(&self, writer: &mut W) -> ::molecule::io::Result<()> {
+        writer.write_all(self.0[0].as_slice())?;
+        writer.write_all(self.0[1].as_slice())?;
+        Ok(())
+    }
+    fn build(&self) -> Self::Entity {
+        let mut inner = Vec::with_capacity(self.expected_length());
+        self.write(&mut inner)
+            .unwrap_or_else(|_| panic!("{} build should be ok", Self::NAME));
+        Uint16T::new_unchecked(inner.into())
+    }
+}
+#[derive(Clone)]
 pub struct Uint64T(molecule::bytes::Bytes);
 impl ::core::fmt::LowerHex for Uint64T {
     fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
@@ -3784,8 +3959,8 @@ impl molecule::prelude::Builder for RoundBuilder {
     }
 }
 #[derive(Clone)]
-pub struct Args(molecule::bytes::Bytes);
-impl ::core::fmt::LowerHex for Args {
+pub struct SignedRound(molecule::bytes::Bytes);
+impl ::core::fmt::LowerHex for SignedRound {
     fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
         use molecule::hex_string;
         if f.alternate() {
@@ -3794,23 +3969,16 @@ impl ::core::fmt::LowerHex for Args {
         write!(f, "{}", hex_string(self.as_slice()))
     }
 }
-impl ::core::fmt::Debug for Args {
+impl ::core::fmt::Debug for SignedRound {
     fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
         write!(f, "{}({:#x})", Self::NAME, self)
     }
 }
-impl ::core::fmt::Display for Args {
+impl ::core::fmt::Display for SignedRound {
     fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
         write!(f, "{} {{ ", Self::NAME)?;
-        write!(f, "{}: {}", "user_staking_ckb", self.user_staking_ckb())?;
-        write!(f, ", {}: {}", "user_deck_size", self.user_deck_size())?;
-        write!(f, ", {}: {}", "begin_blocknumber", self.begin_blocknumber())?;
-        write!(f, ", {}: {}", "lock_code_hash", self.lock_code_hash())?;
-        write!(f, ", {}: {}", "lua_code_hashes", self.lua_code_hashes())?;
-        write!(f, ", {}: {}", "user1_pkhash", self.user1_pkhash())?;
-        write!(f, ", {}: {}", "user1_nfts", self.user1_nfts())?;
-        write!(f, ", {}: {}", "user2_pkhash", self.user2_pkhash())?;
-        write!(f, ", {}: {}", "user2_nfts", self.user2_nfts())?;
+        write!(f, "{}: {}", "round", self.round())?;
+        write!(f, ", {}: {}", "signature", self.signature())?;
         let extra_count = self.count_extra_fields();
         if extra_count != 0 {
             write!(f, ", .. ({} fields)", extra_count)?;
@@ -3818,21 +3986,19 @@ impl ::core::fmt::Display for Args {
         write!(f, " }}")
     }
 }
-impl ::core::default::Default for Args {
+impl ::core::default::Default for SignedRound {
     fn default() -> Self {
         let v: Vec<u8> = vec![
-            141, 0, 0, 0, 40, 0, 0, 0, 48, 0, 0, 0, 49, 0, 0, 0, 57, 0, 0, 0, 89, 0, 0, 0, 93, 0,
-            0, 0, 113, 0, 0, 0, 117, 0, 0, 0, 137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            94, 0, 0, 0, 12, 0, 0, 0, 29, 0, 0, 0, 17, 0, 0, 0, 12, 0, 0, 0, 13, 0, 0, 0, 0, 4, 0,
             0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
             0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-            0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0,
         ];
-        Args::new_unchecked(v.into())
+        SignedRound::new_unchecked(v.into())
     }
 }
-impl Args {
-    pub const FIELD_COUNT: usize = 9;
+impl SignedRound {
+    pub const FIELD_COUNT: usize = 2;
     pub fn total_size(&self) -> usize {
         molecule::unpack_number(self.as_slice()) as usize
     }
@@ -3849,73 +4015,31 @@ impl Args {
     pub fn has_extra_fields(&self) -> bool {
         Self::FIELD_COUNT != self.field_count()
     }
-    pub fn user_staking_ckb(&self) -> Uint64T {
+    pub fn round(&self) -> Round {
         let slice = self.as_slice();
         let start = molecule::unpack_number(&slice[4..]) as usize;
         let end = molecule::unpack_number(&slice[8..]) as usize;
-        Uint64T::new_unchecked(self.0.slice(start..end))
+        Round::new_unchecked(self.0.slice(start..end))
     }
-    pub fn user_deck_size(&self) -> Uint8T {
+    pub fn signature(&self) -> Signature {
         let slice = self.as_slice();
         let start = molecule::unpack_number(&slice[8..]) as usize;
-        let end = molecule::unpack_number(&slice[12..]) as usize;
-        Uint8T::new_unchecked(self.0.slice(start..end))
-    }
-    pub fn begin_blocknumber(&self) -> Uint64T {
-        let slice = self.as_slice();
-        let start = molecule::unpack_number(&slice[12..]) as usize;
-        let end = molecule::unpack_number(&slice[16..]) as usize;
-        Uint64T::new_unchecked(self.0.slice(start..end))
-    }
-    pub fn lock_code_hash(&self) -> Blake256 {
-        let slice = self.as_slice();
-        let start = molecule::unpack_number(&slice[16..]) as usize;
-        let end = molecule::unpack_number(&slice[20..]) as usize;
-        Blake256::new_unchecked(self.0.slice(start..end))
-    }
-    pub fn lua_code_hashes(&self) -> Hashes {
-        let slice = self.as_slice();
-        let start = molecule::unpack_number(&slice[20..]) as usize;
-        let end = molecule::unpack_number(&slice[24..]) as usize;
-        Hashes::new_unchecked(self.0.slice(start..end))
-    }
-    pub fn user1_pkhash(&self) -> Blake160 {
-        let slice = self.as_slice();
-        let start = molecule::unpack_number(&slice[24..]) as usize;
-        let end = molecule::unpack_number(&slice[28..]) as usize;
-        Blake160::new_unchecked(self.0.slice(start..end))
-    }
-    pub fn user1_nfts(&self) -> Nfts {
-        let slice = self.as_slice();
-        let start = molecule::unpack_number(&slice[28..]) as usize;
-        let end = molecule::unpack_number(&slice[32..]) as usize;
-        Nfts::new_unchecked(self.0.slice(start..end))
-    }
-    pub fn user2_pkhash(&self) -> Blake160 {
-        let slice = self.as_slice();
-        let start = molecule::unpack_number(&slice[32..]) as usize;
-        let end = molecule::unpack_number(&slice[36..]) as usize;
-        Blake160::new_unchecked(self.0.slice(start..end))
-    }
-    pub fn user2_nfts(&self) -> Nfts {
-        let slice = self.as_slice();
-        let start = molecule::unpack_number(&slice[36..]) as usize;
         if self.has_extra_fields() {
-            let end = molecule::unpack_number(&slice[40..]) as usize;
-            Nfts::new_unchecked(self.0.slice(start..end))
+            let end = molecule::unpack_number(&slice[12..]) as usize;
+            Signature::new_unchecked(self.0.slice(start..end))
         } else {
-            Nfts::new_unchecked(self.0.slice(start..))
+            Signature::new_unchecked(self.0.slice(start..))
         }
     }
-    pub fn as_reader<'r>(&'r self) -> ArgsReader<'r> {
-        ArgsReader::new_unchecked(self.as_slice())
+    pub fn as_reader<'r>(&'r self) -> SignedRoundReader<'r> {
+        SignedRoundReader::new_unchecked(self.as_slice())
     }
 }
-impl molecule::prelude::Entity for Args {
-    type Builder = ArgsBuilder;
-    const NAME: &'static str = "Args";
+impl molecule::prelude::Entity for SignedRound {
+    type Builder = SignedRoundBuilder;
+    const NAME: &'static str = "SignedRound";
     fn new_unchecked(data: molecule::bytes::Bytes) -> Self {
-        Args(data)
+        SignedRound(data)
     }
     fn as_bytes(&self) -> molecule::bytes::Bytes {
         self.0.clone()
@@ -3924,30 +4048,23 @@ impl molecule::prelude::Entity for Args {
         &self.0[..]
     }
     fn from_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
-        ArgsReader::from_slice(slice).map(|reader| reader.to_entity())
+        SignedRoundReader::from_slice(slice).map(|reader| reader.to_entity())
     }
     fn from_compatible_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
-        ArgsReader::from_compatible_slice(slice).map(|reader| reader.to_entity())
+        SignedRoundReader::from_compatible_slice(slice).map(|reader| reader.to_entity())
     }
     fn new_builder() -> Self::Builder {
         ::core::default::Default::default()
     }
     fn as_builder(self) -> Self::Builder {
         Self::new_builder()
-            .user_staking_ckb(self.user_staking_ckb())
-            .user_deck_size(self.user_deck_size())
-            .begin_blocknumber(self.begin_blocknumber())
-            .lock_code_hash(self.lock_code_hash())
-            .lua_code_hashes(self.lua_code_hashes())
-            .user1_pkhash(self.user1_pkhash())
-            .user1_nfts(self.user1_nfts())
-            .user2_pkhash(self.user2_pkhash())
-            .user2_nfts(self.user2_nfts())
+            .round(self.round())
+            .signature(self.signature())
     }
 }
 #[derive(Clone, Copy)]
-pub struct ArgsReader<'r>(&'r [u8]);
-impl<'r> ::core::fmt::LowerHex for ArgsReader<'r> {
+pub struct SignedRoundReader<'r>(&'r [u8]);
+impl<'r> ::core::fmt::LowerHex for SignedRoundReader<'r> {
     fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
         use molecule::hex_string;
         if f.alternate() {
@@ -3956,23 +4073,16 @@ impl<'r> ::core::fmt::LowerHex for ArgsReader<'r> {
         write!(f, "{}", hex_string(self.as_slice()))
     }
 }
-impl<'r> ::core::fmt::Debug for ArgsReader<'r> {
+impl<'r> ::core::fmt::Debug for SignedRoundReader<'r> {
     fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
         write!(f, "{}({:#x})", Self::NAME, self)
     }
 }
-impl<'r> ::core::fmt::Display for ArgsReader<'r> {
+impl<'r> ::core::fmt::Display for SignedRoundReader<'r> {
     fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
         write!(f, "{} {{ ", Self::NAME)?;
-        write!(f, "{}: {}", "user_staking_ckb", self.user_staking_ckb())?;
-        write!(f, ", {}: {}", "user_deck_size", self.user_deck_size())?;
-        write!(f, ", {}: {}", "begin_blocknumber", self.begin_blocknumber())?;
-        write!(f, ", {}: {}", "lock_code_hash", self.lock_code_hash())?;
-        write!(f, ", {}: {}", "lua_code_hashes", self.lua_code_hashes())?;
-        write!(f, ", {}: {}", "user1_pkhash", self.user1_pkhash())?;
-        write!(f, ", {}: {}", "user1_nfts", self.user1_nfts())?;
-        write!(f, ", {}: {}", "user2_pkhash", self.user2_pkhash())?;
-        write!(f, ", {}: {}", "user2_nfts", self.user2_nfts())?;
+        write!(f, "{}: {}", "round", self.round())?;
+        write!(f, ", {}: {}", "signature", self.signature())?;
         let extra_count = self.count_extra_fields();
         if extra_count != 0 {
             write!(f, ", .. ({} fields)", extra_count)?;
@@ -3980,8 +4090,8 @@ impl<'r> ::core::fmt::Display for ArgsReader<'r> {
         write!(f, " }}")
     }
 }
-impl<'r> ArgsReader<'r> {
-    pub const FIELD_COUNT: usize = 9;
+impl<'r> SignedRoundReader<'r> {
+    pub const FIELD_COUNT: usize = 2;
     pub fn total_size(&self) -> usize {
         molecule::unpack_number(self.as_slice()) as usize
     }
@@ -3998,73 +4108,3616 @@ impl<'r> ArgsReader<'r> {
     pub fn has_extra_fields(&self) -> bool {
         Self::FIELD_COUNT != self.field_count()
     }
-    pub fn user_staking_ckb(&self) -> Uint64TReader<'r> {
+    pub fn round(&self) -> RoundReader<'r> {
         let slice = self.as_slice();
         let start = molecule::unpack_number(&slice[4..]) as usize;
         let end = molecule::unpack_number(&slice[8..]) as usize;
-        Uint64TReader::new_unchecked(&self.as_slice()[start..end])
+        RoundReader::new_unchecked(&self.as_slice()[start..end])
     }
-    pub fn user_deck_size(&self) -> Uint8TReader<'r> {
+    pub fn signature(&self) -> SignatureReader<'r> {
         let slice = self.as_slice();
         let start = molecule::unpack_number(&slice[8..]) as usize;
-        let end = molecule::unpack_number(&slice[12..]) as usize;
-        Uint8TReader::new_unchecked(&self.as_slice()[start..end])
+        if self.has_extra_fields() {
+            let end = molecule::unpack_number(&slice[12..]) as usize;
+            SignatureReader::new_unchecked(&self.as_slice()[start..end])
+        } else {
+            SignatureReader::new_unchecked(&self.as_slice()[start..])
+        }
     }
-    pub fn begin_blocknumber(&self) -> Uint64TReader<'r> {
-        let slice = self.as_slice();
-        let start = molecule::unpack_number(&slice[12..]) as usize;
-        let end = molecule::unpack_number(&slice[16..]) as usize;
-        Uint64TReader::new_unchecked(&self.as_slice()[start..end])
+}
+impl<'r> molecule::prelude::Reader<'r> for SignedRoundReader<'r> {
+    type Entity = SignedRound;
+    const NAME: &'static str = "SignedRoundReader";
+    fn to_entity(&self) -> Self::Entity {
+        Self::Entity::new_unchecked(self.as_slice().to_owned().into())
     }
-    pub fn lock_code_hash(&self) -> Blake256Reader<'r> {
-        let slice = self.as_slice();
+    fn new_unchecked(slice: &'r [u8]) -> Self {
+        SignedRoundReader(slice)
+    }
+    fn as_slice(&self) -> &'r [u8] {
+        self.0
+    }
+    fn verify(slice: &[u8], compatible: bool) -> molecule::error::VerificationResult<()> {
+        use molecule::verification_error as ve;
+        let slice_len = slice.len();
+        if slice_len < molecule::NUMBER_SIZE {
+            return ve!(Self, HeaderIsBroken, molecule::NUMBER_SIZE, slice_len);
+        }
+        let total_size = molecule::unpack_number(slice) as usize;
+        if slice_len != total_size {
+            return ve!(Self, TotalSizeNotMatch, total_size, slice_len);
+        }
+        if slice_len == molecule::NUMBER_SIZE && Self::FIELD_COUNT == 0 {
+            return Ok(());
+        }
+        if slice_len < molecule::NUMBER_SIZE * 2 {
+            return ve!(Self, HeaderIsBroken, molecule::NUMBER_SIZE * 2, slice_len);
+        }
+        let offset_first = molecule::unpack_number(&slice[molecule::NUMBER_SIZE..]) as usize;
+        if offset_first % molecule::NUMBER_SIZE != 0 || offset_first < molecule::NUMBER_SIZE * 2 {
+            return ve!(Self, OffsetsNotMatch);
+        }
+        if slice_len < offset_first {
+            return ve!(Self, HeaderIsBroken, offset_first, slice_len);
+        }
+        let field_count = offset_first / molecule::NUMBER_SIZE - 1;
+        if field_count < Self::FIELD_COUNT {
+            return ve!(Self, FieldCountNotMatch, Self::FIELD_COUNT, field_count);
+        } else if !compatible && field_count > Self::FIELD_COUNT {
+            return ve!(Self, FieldCountNotMatch, Self::FIELD_COUNT, field_count);
+        };
+        let mut offsets: Vec<usize> = slice[molecule::NUMBER_SIZE..offset_first]
+            .chunks_exact(molecule::NUMBER_SIZE)
+            .map(|x| molecule::unpack_number(x) as usize)
+            .collect();
+        offsets.push(total_size);
+        if offsets.windows(2).any(|i| i[0] > i[1]) {
+            return ve!(Self, OffsetsNotMatch);
+        }
+        RoundReader::verify(&slice[offsets[0]..offsets[1]], compatible)?;
+        SignatureReader::verify(&slice[offsets[1]..offsets[2]], compatible)?;
+        Ok(())
+    }
+}
+#[derive(Debug, Default)]
+pub struct SignedRoundBuilder {
+    pub(crate) round: Round,
+    pub(crate) signature: Signature,
+}
+impl SignedRoundBuilder {
+    pub const FIELD_COUNT: usize = 2;
+    pub fn round(mut self, v: Round) -> Self {
+        self.round = v;
+        self
+    }
+    pub fn signature(mut self, v: Signature) -> Self {
+        self.signature = v;
+        self
+    }
+}
+impl molecule::prelude::Builder for SignedRoundBuilder {
+    type Entity = SignedRound;
+    const NAME: &'static str = "SignedRoundBuilder";
+    fn expected_length(&self) -> usize {
+        molecule::NUMBER_SIZE * (Self::FIELD_COUNT + 1)
+            + self.round.as_slice().len()
+            + self.signature.as_slice().len()
+    }
+    fn write<W: ::molecule::io::Write>(&self, writer: &mut W) -> ::molecule::io::Result<()> {
+        let mut total_size = molecule::NUMBER_SIZE * (Self::FIELD_COUNT + 1);
+        let mut offsets = Vec::with_capacity(Self::FIELD_COUNT);
+        offsets.push(total_size);
+        total_size += self.round.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.signature.as_slice().len();
+        writer.write_all(&molecule::pack_number(total_size as molecule::Number))?;
+        for offset in offsets.into_iter() {
+            writer.write_all(&molecule::pack_number(offset as molecule::Number))?;
+        }
+        writer.write_all(self.round.as_slice())?;
+        writer.write_all(self.signature.as_slice())?;
+        Ok(())
+    }
+    fn build(&self) -> Self::Entity {
+        let mut inner = Vec::with_capacity(self.expected_length());
+        self.write(&mut inner)
+            .unwrap_or_else(|_| panic!("{} build should be ok", Self::NAME));
+        SignedRound::new_unchecked(inner.into())
+    }
+}
+#[derive(Clone)]
+pub struct SignedRounds(molecule::bytes::Bytes);
+impl ::core::fmt::LowerHex for SignedRounds {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        use molecule::hex_string;
+        if f.alternate() {
+            write!(f, "0x")?;
+        }
+        write!(f, "{}", hex_string(self.as_slice()))
+    }
+}
+impl ::core::fmt::Debug for SignedRounds {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{}({:#x})", Self::NAME, self)
+    }
+}
+impl ::core::fmt::Display for SignedRounds {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{} [", Self::NAME)?;
+        for i in 0..self.len() {
+            if i == 0 {
+                write!(f, "{}", self.get_unchecked(i))?;
+            } else {
+                write!(f, ", {}", self.get_unchecked(i))?;
+            }
+        }
+        write!(f, "]")
+    }
+}
+impl ::core::default::Default for SignedRounds {
+    fn default() -> Self {
+        let v: Vec<u8> = vec![4, 0, 0, 0];
+        SignedRounds::new_unchecked(v.into())
+    }
+}
+impl SignedRounds {
+    pub fn total_size(&self) -> usize {
+        molecule::unpack_number(self.as_slice()) as usize
+    }
+    pub fn item_count(&self) -> usize {
+        if self.total_size() == molecule::NUMBER_SIZE {
+            0
+        } else {
+            (molecule::unpack_number(&self.as_slice()[molecule::NUMBER_SIZE..]) as usize / 4) - 1
+        }
+    }
+    pub fn len(&self) -> usize {
+        self.item_count()
+    }
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+    pub fn get(&self, idx: usize) -> Option<SignedRound> {
+        if idx >= self.len() {
+            None
+        } else {
+            Some(self.get_unchecked(idx))
+        }
+    }
+    pub fn get_unchecked(&self, idx: usize) -> SignedRound {
+        let slice = self.as_slice();
+        let start_idx = molecule::NUMBER_SIZE * (1 + idx);
+        let start = molecule::unpack_number(&slice[start_idx..]) as usize;
+        if idx == self.len() - 1 {
+            SignedRound::new_unchecked(self.0.slice(start..))
+        } else {
+            let end_idx = start_idx + molecule::NUMBER_SIZE;
+            let end = molecule::unpack_number(&slice[end_idx..]) as usize;
+            SignedRound::new_unchecked(self.0.slice(start..end))
+        }
+    }
+    pub fn as_reader<'r>(&'r self) -> SignedRoundsReader<'r> {
+        SignedRoundsReader::new_unchecked(self.as_slice())
+    }
+}
+impl molecule::prelude::Entity for SignedRounds {
+    type Builder = SignedRoundsBuilder;
+    const NAME: &'static str = "SignedRounds";
+    fn new_unchecked(data: molecule::bytes::Bytes) -> Self {
+        SignedRounds(data)
+    }
+    fn as_bytes(&self) -> molecule::bytes::Bytes {
+        self.0.clone()
+    }
+    fn as_slice(&self) -> &[u8] {
+        &self.0[..]
+    }
+    fn from_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
+        SignedRoundsReader::from_slice(slice).map(|reader| reader.to_entity())
+    }
+    fn from_compatible_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
+        SignedRoundsReader::from_compatible_slice(slice).map(|reader| reader.to_entity())
+    }
+    fn new_builder() -> Self::Builder {
+        ::core::default::Default::default()
+    }
+    fn as_builder(self) -> Self::Builder {
+        Self::new_builder().extend(self.into_iter())
+    }
+}
+#[derive(Clone, Copy)]
+pub struct SignedRoundsReader<'r>(&'r [u8]);
+impl<'r> ::core::fmt::LowerHex for SignedRoundsReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        use molecule::hex_string;
+        if f.alternate() {
+            write!(f, "0x")?;
+        }
+        write!(f, "{}", hex_string(self.as_slice()))
+    }
+}
+impl<'r> ::core::fmt::Debug for SignedRoundsReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{}({:#x})", Self::NAME, self)
+    }
+}
+impl<'r> ::core::fmt::Display for SignedRoundsReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{} [", Self::NAME)?;
+        for i in 0..self.len() {
+            if i == 0 {
+                write!(f, "{}", self.get_unchecked(i))?;
+            } else {
+                write!(f, ", {}", self.get_unchecked(i))?;
+            }
+        }
+        write!(f, "]")
+    }
+}
+impl<'r> SignedRoundsReader<'r> {
+    pub fn total_size(&self) -> usize {
+        molecule::unpack_number(self.as_slice()) as usize
+    }
+    pub fn item_count(&self) -> usize {
+        if self.total_size() == molecule::NUMBER_SIZE {
+            0
+        } else {
+            (molecule::unpack_number(&self.as_slice()[molecule::NUMBER_SIZE..]) as usize / 4) - 1
+        }
+    }
+    pub fn len(&self) -> usize {
+        self.item_count()
+    }
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+    pub fn get(&self, idx: usize) -> Option<SignedRoundReader<'r>> {
+        if idx >= self.len() {
+            None
+        } else {
+            Some(self.get_unchecked(idx))
+        }
+    }
+    pub fn get_unchecked(&self, idx: usize) -> SignedRoundReader<'r> {
+        let slice = self.as_slice();
+        let start_idx = molecule::NUMBER_SIZE * (1 + idx);
+        let start = molecule::unpack_number(&slice[start_idx..]) as usize;
+        if idx == self.len() - 1 {
+            SignedRoundReader::new_unchecked(&self.as_slice()[start..])
+        } else {
+            let end_idx = start_idx + molecule::NUMBER_SIZE;
+            let end = molecule::unpack_number(&slice[end_idx..]) as usize;
+            SignedRoundReader::new_unchecked(&self.as_slice()[start..end])
+        }
+    }
+}
+impl<'r> molecule::prelude::Reader<'r> for SignedRoundsReader<'r> {
+    type Entity = SignedRounds;
+    const NAME: &'static str = "SignedRoundsReader";
+    fn to_entity(&self) -> Self::Entity {
+        Self::Entity::new_unchecked(self.as_slice().to_owned().into())
+    }
+    fn new_unchecked(slice: &'r [u8]) -> Self {
+        SignedRoundsReader(slice)
+    }
+    fn as_slice(&self) -> &'r [u8] {
+        self.0
+    }
+    fn verify(slice: &[u8], compatible: bool) -> molecule::error::VerificationResult<()> {
+        use molecule::verification_error as ve;
+        let slice_len = slice.len();
+        if slice_len < molecule::NUMBER_SIZE {
+            return ve!(Self, HeaderIsBroken, molecule::NUMBER_SIZE, slice_len);
+        }
+        let total_size = molecule::unpack_number(slice) as usize;
+        if slice_len != total_size {
+            return ve!(Self, TotalSizeNotMatch, total_size, slice_len);
+        }
+        if slice_len == molecule::NUMBER_SIZE {
+            return Ok(());
+        }
+        if slice_len < molecule::NUMBER_SIZE * 2 {
+            return ve!(
+                Self,
+                TotalSizeNotMatch,
+                molecule::NUMBER_SIZE * 2,
+                slice_len
+            );
+        }
+        let offset_first = molecule::unpack_number(&slice[molecule::NUMBER_SIZE..]) as usize;
+        if offset_first % molecule::NUMBER_SIZE != 0 || offset_first < molecule::NUMBER_SIZE * 2 {
+            return ve!(Self, OffsetsNotMatch);
+        }
+        if slice_len < offset_first {
+            return ve!(Self, HeaderIsBroken, offset_first, slice_len);
+        }
+        let mut offsets: Vec<usize> = slice[molecule::NUMBER_SIZE..offset_first]
+            .chunks_exact(molecule::NUMBER_SIZE)
+            .map(|x| molecule::unpack_number(x) as usize)
+            .collect();
+        offsets.push(total_size);
+        if offsets.windows(2).any(|i| i[0] > i[1]) {
+            return ve!(Self, OffsetsNotMatch);
+        }
+        for pair in offsets.windows(2) {
+            let start = pair[0];
+            let end = pair[1];
+            SignedRoundReader::verify(&slice[start..end], compatible)?;
+        }
+        Ok(())
+    }
+}
+#[derive(Debug, Default)]
+pub struct SignedRoundsBuilder(pub(crate) Vec<SignedRound>);
+impl SignedRoundsBuilder {
+    pub fn set(mut self, v: Vec<SignedRound>) -> Self {
+        self.0 = v;
+        self
+    }
+    pub fn push(mut self, v: SignedRound) -> Self {
+        self.0.push(v);
+        self
+    }
+    pub fn extend<T: ::core::iter::IntoIterator<Item = SignedRound>>(mut self, iter: T) -> Self {
+        for elem in iter {
+            self.0.push(elem);
+        }
+        self
+    }
+}
+impl molecule::prelude::Builder for SignedRoundsBuilder {
+    type Entity = SignedRounds;
+    const NAME: &'static str = "SignedRoundsBuilder";
+    fn expected_length(&self) -> usize {
+        molecule::NUMBER_SIZE * (self.0.len() + 1)
+            + self
+                .0
+                .iter()
+                .map(|inner| inner.as_slice().len())
+                .sum::<usize>()
+    }
+    fn write<W: ::molecule::io::Write>(&self, writer: &mut W) -> ::molecule::io::Result<()> {
+        let item_count = self.0.len();
+        if item_count == 0 {
+            writer.write_all(&molecule::pack_number(
+                molecule::NUMBER_SIZE as molecule::Number,
+            ))?;
+        } else {
+            let (total_size, offsets) = self.0.iter().fold(
+                (
+                    molecule::NUMBER_SIZE * (item_count + 1),
+                    Vec::with_capacity(item_count),
+                ),
+                |(start, mut offsets), inner| {
+                    offsets.push(start);
+                    (start + inner.as_slice().len(), offsets)
+                },
+            );
+            writer.write_all(&molecule::pack_number(total_size as molecule::Number))?;
+            for offset in offsets.into_iter() {
+                writer.write_all(&molecule::pack_number(offset as molecule::Number))?;
+            }
+            for inner in self.0.iter() {
+                writer.write_all(inner.as_slice())?;
+            }
+        }
+        Ok(())
+    }
+    fn build(&self) -> Self::Entity {
+        let mut inner = Vec::with_capacity(self.expected_length());
+        self.write(&mut inner)
+            .unwrap_or_else(|_| panic!("{} build should be ok", Self::NAME));
+        SignedRounds::new_unchecked(inner.into())
+    }
+}
+pub struct SignedRoundsIterator(SignedRounds, usize, usize);
+impl ::core::iter::Iterator for SignedRoundsIterator {
+    type Item = SignedRound;
+    fn next(&mut self) -> Option<Self::Item> {
+        if self.1 >= self.2 {
+            None
+        } else {
+            let ret = self.0.get_unchecked(self.1);
+            self.1 += 1;
+            Some(ret)
+        }
+    }
+}
+impl ::core::iter::ExactSizeIterator for SignedRoundsIterator {
+    fn len(&self) -> usize {
+        self.2 - self.1
+    }
+}
+impl ::core::iter::IntoIterator for SignedRounds {
+    type Item = SignedRound;
+    type IntoIter = SignedRoundsIterator;
+    fn into_iter(self) -> Self::IntoIter {
+        let len = self.len();
+        SignedRoundsIterator(self, 0, len)
+    }
+}
+impl<'r> SignedRoundsReader<'r> {
+    pub fn iter<'t>(&'t self) -> SignedRoundsReaderIterator<'t, 'r> {
+        SignedRoundsReaderIterator(&self, 0, self.len())
+    }
+}
+pub struct SignedRoundsReaderIterator<'t, 'r>(&'t SignedRoundsReader<'r>, usize, usize);
+impl<'t: 'r, 'r> ::core::iter::Iterator for SignedRoundsReaderIterator<'t, 'r> {
+    type Item = SignedRoundReader<'t>;
+    fn next(&mut self) -> Option<Self::Item> {
+        if self.1 >= self.2 {
+            None
+        } else {
+            let ret = self.0.get_unchecked(self.1);
+            self.1 += 1;
+            Some(ret)
+        }
+    }
+}
+impl<'t: 'r, 'r> ::core::iter::ExactSizeIterator for SignedRoundsReaderIterator<'t, 'r> {
+    fn len(&self) -> usize {
+        self.2 - self.1
+    }
+}
+#[derive(Clone)]
+pub struct Args(molecule::bytes::Bytes);
+impl ::core::fmt::LowerHex for Args {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        use molecule::hex_string;
+        if f.alternate() {
+            write!(f, "0x")?;
+        }
+        write!(f, "{}", hex_string(self.as_slice()))
+    }
+}
+impl ::core::fmt::Debug for Args {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{}({:#x})", Self::NAME, self)
+    }
+}
+impl ::core::fmt::Display for Args {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{} {{ ", Self::NAME)?;
+        write!(f, "{}: {}", "user_staking_ckb", self.user_staking_ckb())?;
+        write!(f, ", {}: {}", "user_deck_size", self.user_deck_size())?;
+        write!(f, ", {}: {}", "begin_blocknumber", self.begin_blocknumber())?;
+        write!(f, ", {}: {}", "lock_code_hash", self.lock_code_hash())?;
+        write!(f, ", {}: {}", "lua_code_hashes", self.lua_code_hashes())?;
+        write!(f, ", {}: {}", "user1_pkhash", self.user1_pkhash())?;
+        write!(f, ", {}: {}", "user1_nfts", self.user1_nfts())?;
+        write!(f, ", {}: {}", "user2_pkhash", self.user2_pkhash())?;
+        write!(f, ", {}: {}", "user2_nfts", self.user2_nfts())?;
+        let extra_count = self.count_extra_fields();
+        if extra_count != 0 {
+            write!(f, ", .. ({} fields)", extra_count)?;
+        }
+        write!(f, " }}")
+    }
+}
+impl ::core::default::Default for Args {
+    fn default() -> Self {
+        let v: Vec<u8> = vec![
+            141, 0, 0, 0, 40, 0, 0, 0, 48, 0, 0, 0, 49, 0, 0, 0, 57, 0, 0, 0, 89, 0, 0, 0, 93, 0,
+            0, 0, 113, 0, 0, 0, 117, 0, 0, 0, 137, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0,
+        ];
+        Args::new_unchecked(v.into())
+    }
+}
+impl Args {
+    pub const FIELD_COUNT: usize = 9;
+    pub fn total_size(&self) -> usize {
+        molecule::unpack_number(self.as_slice()) as usize
+    }
+    pub fn field_count(&self) -> usize {
+        if self.total_size() == molecule::NUMBER_SIZE {
+            0
+        } else {
+            (molecule::unpack_number(&self.as_slice()[molecule::NUMBER_SIZE..]) as usize / 4) - 1
+        }
+    }
+    pub fn count_extra_fields(&self) -> usize {
+        self.field_count() - Self::FIELD_COUNT
+    }
+    pub fn has_extra_fields(&self) -> bool {
+        Self::FIELD_COUNT != self.field_count()
+    }
+    pub fn user_staking_ckb(&self) -> Uint64T {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[4..]) as usize;
+        let end = molecule::unpack_number(&slice[8..]) as usize;
+        Uint64T::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn user_deck_size(&self) -> Uint8T {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[8..]) as usize;
+        let end = molecule::unpack_number(&slice[12..]) as usize;
+        Uint8T::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn begin_blocknumber(&self) -> Uint64T {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[12..]) as usize;
+        let end = molecule::unpack_number(&slice[16..]) as usize;
+        Uint64T::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn lock_code_hash(&self) -> Blake256 {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[16..]) as usize;
+        let end = molecule::unpack_number(&slice[20..]) as usize;
+        Blake256::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn lua_code_hashes(&self) -> Hashes {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[20..]) as usize;
+        let end = molecule::unpack_number(&slice[24..]) as usize;
+        Hashes::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn user1_pkhash(&self) -> Blake160 {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[24..]) as usize;
+        let end = molecule::unpack_number(&slice[28..]) as usize;
+        Blake160::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn user1_nfts(&self) -> Nfts {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[28..]) as usize;
+        let end = molecule::unpack_number(&slice[32..]) as usize;
+        Nfts::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn user2_pkhash(&self) -> Blake160 {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[32..]) as usize;
+        let end = molecule::unpack_number(&slice[36..]) as usize;
+        Blake160::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn user2_nfts(&self) -> Nfts {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[36..]) as usize;
+        if self.has_extra_fields() {
+            let end = molecule::unpack_number(&slice[40..]) as usize;
+            Nfts::new_unchecked(self.0.slice(start..end))
+        } else {
+            Nfts::new_unchecked(self.0.slice(start..))
+        }
+    }
+    pub fn as_reader<'r>(&'r self) -> ArgsReader<'r> {
+        ArgsReader::new_unchecked(self.as_slice())
+    }
+}
+impl molecule::prelude::Entity for Args {
+    type Builder = ArgsBuilder;
+    const NAME: &'static str = "Args";
+    fn new_unchecked(data: molecule::bytes::Bytes) -> Self {
+        Args(data)
+    }
+    fn as_bytes(&self) -> molecule::bytes::Bytes {
+        self.0.clone()
+    }
+    fn as_slice(&self) -> &[u8] {
+        &self.0[..]
+    }
+    fn from_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
+        ArgsReader::from_slice(slice).map(|reader| reader.to_entity())
+    }
+    fn from_compatible_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
+        ArgsReader::from_compatible_slice(slice).map(|reader| reader.to_entity())
+    }
+    fn new_builder() -> Self::Builder {
+        ::core::default::Default::default()
+    }
+    fn as_builder(self) -> Self::Builder {
+        Self::new_builder()
+            .user_staking_ckb(self.user_staking_ckb())
+            .user_deck_size(self.user_deck_size())
+            .begin_blocknumber(self.begin_blocknumber())
+            .lock_code_hash(self.lock_code_hash())
+            .lua_code_hashes(self.lua_code_hashes())
+            .user1_pkhash(self.user1_pkhash())
+            .user1_nfts(self.user1_nfts())
+            .user2_pkhash(self.user2_pkhash())
+            .user2_nfts(self.user2_nfts())
+    }
+}
+#[derive(Clone, Copy)]
+pub struct ArgsReader<'r>(&'r [u8]);
+impl<'r> ::core::fmt::LowerHex for ArgsReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        use molecule::hex_string;
+        if f.alternate() {
+            write!(f, "0x")?;
+        }
+        write!(f, "{}", hex_string(self.as_slice()))
+    }
+}
+impl<'r> ::core::fmt::Debug for ArgsReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{}({:#x})", Self::NAME, self)
+    }
+}
+impl<'r> ::core::fmt::Display for ArgsReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{} {{ ", Self::NAME)?;
+        write!(f, "{}: {}", "user_staking_ckb", self.user_staking_ckb())?;
+        write!(f, ", {}: {}", "user_deck_size", self.user_deck_size())?;
+        write!(f, ", {}: {}", "begin_blocknumber", self.begin_blocknumber())?;
+        write!(f, ", {}: {}", "lock_code_hash", self.lock_code_hash())?;
+        write!(f, ", {}: {}", "lua_code_hashes", self.lua_code_hashes())?;
+        write!(f, ", {}: {}", "user1_pkhash", self.user1_pkhash())?;
+        write!(f, ", {}: {}", "user1_nfts", self.user1_nfts())?;
+        write!(f, ", {}: {}", "user2_pkhash", self.user2_pkhash())?;
+        write!(f, ", {}: {}", "user2_nfts", self.user2_nfts())?;
+        let extra_count = self.count_extra_fields();
+        if extra_count != 0 {
+            write!(f, ", .. ({} fields)", extra_count)?;
+        }
+        write!(f, " }}")
+    }
+}
+impl<'r> ArgsReader<'r> {
+    pub const FIELD_COUNT: usize = 9;
+    pub fn total_size(&self) -> usize {
+        molecule::unpack_number(self.as_slice()) as usize
+    }
+    pub fn field_count(&self) -> usize {
+        if self.total_size() == molecule::NUMBER_SIZE {
+            0
+        } else {
+            (molecule::unpack_number(&self.as_slice()[molecule::NUMBER_SIZE..]) as usize / 4) - 1
+        }
+    }
+    pub fn count_extra_fields(&self) -> usize {
+        self.field_count() - Self::FIELD_COUNT
+    }
+    pub fn has_extra_fields(&self) -> bool {
+        Self::FIELD_COUNT != self.field_count()
+    }
+    pub fn user_staking_ckb(&self) -> Uint64TReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[4..]) as usize;
+        let end = molecule::unpack_number(&slice[8..]) as usize;
+        Uint64TReader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn user_deck_size(&self) -> Uint8TReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[8..]) as usize;
+        let end = molecule::unpack_number(&slice[12..]) as usize;
+        Uint8TReader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn begin_blocknumber(&self) -> Uint64TReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[12..]) as usize;
+        let end = molecule::unpack_number(&slice[16..]) as usize;
+        Uint64TReader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn lock_code_hash(&self) -> Blake256Reader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[16..]) as usize;
+        let end = molecule::unpack_number(&slice[20..]) as usize;
+        Blake256Reader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn lua_code_hashes(&self) -> HashesReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[20..]) as usize;
+        let end = molecule::unpack_number(&slice[24..]) as usize;
+        HashesReader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn user1_pkhash(&self) -> Blake160Reader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[24..]) as usize;
+        let end = molecule::unpack_number(&slice[28..]) as usize;
+        Blake160Reader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn user1_nfts(&self) -> NftsReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[28..]) as usize;
+        let end = molecule::unpack_number(&slice[32..]) as usize;
+        NftsReader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn user2_pkhash(&self) -> Blake160Reader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[32..]) as usize;
+        let end = molecule::unpack_number(&slice[36..]) as usize;
+        Blake160Reader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn user2_nfts(&self) -> NftsReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[36..]) as usize;
+        if self.has_extra_fields() {
+            let end = molecule::unpack_number(&slice[40..]) as usize;
+            NftsReader::new_unchecked(&self.as_slice()[start..end])
+        } else {
+            NftsReader::new_unchecked(&self.as_slice()[start..])
+        }
+    }
+}
+impl<'r> molecule::prelude::Reader<'r> for ArgsReader<'r> {
+    type Entity = Args;
+    const NAME: &'static str = "ArgsReader";
+    fn to_entity(&self) -> Self::Entity {
+        Self::Entity::new_unchecked(self.as_slice().to_owned().into())
+    }
+    fn new_unchecked(slice: &'r [u8]) -> Self {
+        ArgsReader(slice)
+    }
+    fn as_slice(&self) -> &'r [u8] {
+        self.0
+    }
+    fn verify(slice: &[u8], compatible: bool) -> molecule::error::VerificationResult<()> {
+        use molecule::verification_error as ve;
+        let slice_len = slice.len();
+        if slice_len < molecule::NUMBER_SIZE {
+            return ve!(Self, HeaderIsBroken, molecule::NUMBER_SIZE, slice_len);
+        }
+        let total_size = molecule::unpack_number(slice) as usize;
+        if slice_len != total_size {
+            return ve!(Self, TotalSizeNotMatch, total_size, slice_len);
+        }
+        if slice_len == molecule::NUMBER_SIZE && Self::FIELD_COUNT == 0 {
+            return Ok(());
+        }
+        if slice_len < molecule::NUMBER_SIZE * 2 {
+            return ve!(Self, HeaderIsBroken, molecule::NUMBER_SIZE * 2, slice_len);
+        }
+        let offset_first = molecule::unpack_number(&slice[molecule::NUMBER_SIZE..]) as usize;
+        if offset_first % molecule::NUMBER_SIZE != 0 || offset_first < molecule::NUMBER_SIZE * 2 {
+            return ve!(Self, OffsetsNotMatch);
+        }
+        if slice_len < offset_first {
+            return ve!(Self, HeaderIsBroken, offset_first, slice_len);
+        }
+        let field_count = offset_first / molecule::NUMBER_SIZE - 1;
+        if field_count < Self::FIELD_COUNT {
+            return ve!(Self, FieldCountNotMatch, Self::FIELD_COUNT, field_count);
+        } else if !compatible && field_count > Self::FIELD_COUNT {
+            return ve!(Self, FieldCountNotMatch, Self::FIELD_COUNT, field_count);
+        };
+        let mut offsets: Vec<usize> = slice[molecule::NUMBER_SIZE..offset_first]
+            .chunks_exact(molecule::NUMBER_SIZE)
+            .map(|x| molecule::unpack_number(x) as usize)
+            .collect();
+        offsets.push(total_size);
+        if offsets.windows(2).any(|i| i[0] > i[1]) {
+            return ve!(Self, OffsetsNotMatch);
+        }
+        Uint64TReader::verify(&slice[offsets[0]..offsets[1]], compatible)?;
+        Uint8TReader::verify(&slice[offsets[1]..offsets[2]], compatible)?;
+        Uint64TReader::verify(&slice[offsets[2]..offsets[3]], compatible)?;
+        Blake256Reader::verify(&slice[offsets[3]..offsets[4]], compatible)?;
+        HashesReader::verify(&slice[offsets[4]..offsets[5]], compatible)?;
+        Blake160Reader::verify(&slice[offsets[5]..offsets[6]], compatible)?;
+        NftsReader::verify(&slice[offsets[6]..offsets[7]], compatible)?;
+        Blake160Reader::verify(&slice[offsets[7]..offsets[8]], compatible)?;
+        NftsReader::verify(&slice[offsets[8]..offsets[9]], compatible)?;
+        Ok(())
+    }
+}
+#[derive(Debug, Default)]
+pub struct ArgsBuilder {
+    pub(crate) user_staking_ckb: Uint64T,
+    pub(crate) user_deck_size: Uint8T,
+    pub(crate) begin_blocknumber: Uint64T,
+    pub(crate) lock_code_hash: Blake256,
+    pub(crate) lua_code_hashes: Hashes,
+    pub(crate) user1_pkhash: Blake160,
+    pub(crate) user1_nfts: Nfts,
+    pub(crate) user2_pkhash: Blake160,
+    pub(crate) user2_nfts: Nfts,
+}
+impl ArgsBuilder {
+    pub const FIELD_COUNT: usize = 9;
+    pub fn user_staking_ckb(mut self, v: Uint64T) -> Self {
+        self.user_staking_ckb = v;
+        self
+    }
+    pub fn user_deck_size(mut self, v: Uint8T) -> Self {
+        self.user_deck_size = v;
+        self
+    }
+    pub fn begin_blocknumber(mut self, v: Uint64T) -> Self {
+        self.begin_blocknumber = v;
+        self
+    }
+    pub fn lock_code_hash(mut self, v: Blake256) -> Self {
+        self.lock_code_hash = v;
+        self
+    }
+    pub fn lua_code_hashes(mut self, v: Hashes) -> Self {
+        self.lua_code_hashes = v;
+        self
+    }
+    pub fn user1_pkhash(mut self, v: Blake160) -> Self {
+        self.user1_pkhash = v;
+        self
+    }
+    pub fn user1_nfts(mut self, v: Nfts) -> Self {
+        self.user1_nfts = v;
+        self
+    }
+    pub fn user2_pkhash(mut self, v: Blake160) -> Self {
+        self.user2_pkhash = v;
+        self
+    }
+    pub fn user2_nfts(mut self, v: Nfts) -> Self {
+        self.user2_nfts = v;
+        self
+    }
+}
+impl molecule::prelude::Builder for ArgsBuilder {
+    type Entity = Args;
+    const NAME: &'static str = "ArgsBuilder";
+    fn expected_length(&self) -> usize {
+        molecule::NUMBER_SIZE * (Self::FIELD_COUNT + 1)
+            + self.user_staking_ckb.as_slice().len()
+            + self.user_deck_size.as_slice().len()
+            + self.begin_blocknumber.as_slice().len()
+            + self.lock_code_hash.as_slice().len()
+            + self.lua_code_hashes.as_slice().len()
+            + self.user1_pkhash.as_slice().len()
+            + self.user1_nfts.as_slice().len()
+            + self.user2_pkhash.as_slice().len()
+            + self.user2_nfts.as_slice().len()
+    }
+    fn write<W: ::molecule::io::Write>(&self, writer: &mut W) -> ::molecule::io::Result<()> {
+        let mut total_size = molecule::NUMBER_SIZE * (Self::FIELD_COUNT + 1);
+        let mut offsets = Vec::with_capacity(Self::FIELD_COUNT);
+        offsets.push(total_size);
+        total_size += self.user_staking_ckb.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.user_deck_size.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.begin_blocknumber.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.lock_code_hash.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.lua_code_hashes.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.user1_pkhash.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.user1_nfts.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.user2_pkhash.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.user2_nfts.as_slice().len();
+        writer.write_all(&molecule::pack_number(total_size as molecule::Number))?;
+        for offset in offsets.into_iter() {
+            writer.write_all(&molecule::pack_number(offset as molecule::Number))?;
+        }
+        writer.write_all(self.user_staking_ckb.as_slice())?;
+        writer.write_all(self.user_deck_size.as_slice())?;
+        writer.write_all(self.begin_blocknumber.as_slice())?;
+        writer.write_all(self.lock_code_hash.as_slice())?;
+        writer.write_all(self.lua_code_hashes.as_slice())?;
+        writer.write_all(self.user1_pkhash.as_slice())?;
+        writer.write_all(self.user1_nfts.as_slice())?;
+        writer.write_all(self.user2_pkhash.as_slice())?;
+        writer.write_all(self.user2_nfts.as_slice())?;
+        Ok(())
+    }
+    fn build(&self) -> Self::Entity {
+        let mut inner = Vec::with_capacity(self.expected_length());
+        self.write(&mut inner)
+            .unwrap_or_else(|_| panic!("{} build should be ok", Self::NAME));
+        Args::new_unchecked(inner.into())
+    }
+}
+#[derive(Clone)]
+pub struct NftArgs(molecule::bytes::Bytes);
+impl ::core::fmt::LowerHex for NftArgs {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        use molecule::hex_string;
+        if f.alternate() {
+            write!(f, "0x")?;
+        }
+        write!(f, "{}", hex_string(self.as_slice()))
+    }
+}
+impl ::core::fmt::Debug for NftArgs {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{}({:#x})", Self::NAME, self)
+    }
+}
+impl ::core::fmt::Display for NftArgs {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{} {{ ", Self::NAME)?;
+        write!(f, "{}: {}", "user_staking_ckb", self.user_staking_ckb())?;
+        write!(f, ", {}: {}", "user_deck_size", self.user_deck_size())?;
+        write!(f, ", {}: {}", "begin_blocknumber", self.begin_blocknumber())?;
+        write!(f, ", {}: {}", "lock_code_hash", self.lock_code_hash())?;
+        write!(f, ", {}: {}", "lua_code_hashes", self.lua_code_hashes())?;
+        write!(f, ", {}: {}", "user1_pkhash", self.user1_pkhash())?;
+        write!(f, ", {}: {}", "user1_nfts", self.user1_nfts())?;
+        write!(f, ", {}: {}", "user2_pkhash", self.user2_pkhash())?;
+        write!(f, ", {}: {}", "user2_nfts", self.user2_nfts())?;
+        write!(f, ", {}: {}", "nft_type_hashes", self.nft_type_hashes())?;
+        let extra_count = self.count_extra_fields();
+        if extra_count != 0 {
+            write!(f, ", .. ({} fields)", extra_count)?;
+        }
+        write!(f, " }}")
+    }
+}
+impl ::core::default::Default for NftArgs {
+    fn default() -> Self {
+        let v: Vec<u8> = vec![
+            149, 0, 0, 0, 44, 0, 0, 0, 52, 0, 0, 0, 53, 0, 0, 0, 61, 0, 0, 0, 93, 0, 0, 0, 97, 0,
+            0, 0, 117, 0, 0, 0, 121, 0, 0, 0, 141, 0, 0, 0, 145, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        ];
+        NftArgs::new_unchecked(v.into())
+    }
+}
+impl NftArgs {
+    pub const FIELD_COUNT: usize = 10;
+    pub fn total_size(&self) -> usize {
+        molecule::unpack_number(self.as_slice()) as usize
+    }
+    pub fn field_count(&self) -> usize {
+        if self.total_size() == molecule::NUMBER_SIZE {
+            0
+        } else {
+            (molecule::unpack_number(&self.as_slice()[molecule::NUMBER_SIZE..]) as usize / 4) - 1
+        }
+    }
+    pub fn count_extra_fields(&self) -> usize {
+        self.field_count() - Self::FIELD_COUNT
+    }
+    pub fn has_extra_fields(&self) -> bool {
+        Self::FIELD_COUNT != self.field_count()
+    }
+    pub fn user_staking_ckb(&self) -> Uint64T {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[4..]) as usize;
+        let end = molecule::unpack_number(&slice[8..]) as usize;
+        Uint64T::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn user_deck_size(&self) -> Uint8T {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[8..]) as usize;
+        let end = molecule::unpack_number(&slice[12..]) as usize;
+        Uint8T::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn begin_blocknumber(&self) -> Uint64T {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[12..]) as usize;
+        let end = molecule::unpack_number(&slice[16..]) as usize;
+        Uint64T::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn lock_code_hash(&self) -> Blake256 {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[16..]) as usize;
+        let end = molecule::unpack_number(&slice[20..]) as usize;
+        Blake256::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn lua_code_hashes(&self) -> Hashes {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[20..]) as usize;
+        let end = molecule::unpack_number(&slice[24..]) as usize;
+        Hashes::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn user1_pkhash(&self) -> Blake160 {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[24..]) as usize;
+        let end = molecule::unpack_number(&slice[28..]) as usize;
+        Blake160::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn user1_nfts(&self) -> Nfts {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[28..]) as usize;
+        let end = molecule::unpack_number(&slice[32..]) as usize;
+        Nfts::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn user2_pkhash(&self) -> Blake160 {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[32..]) as usize;
+        let end = molecule::unpack_number(&slice[36..]) as usize;
+        Blake160::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn user2_nfts(&self) -> Nfts {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[36..]) as usize;
+        let end = molecule::unpack_number(&slice[40..]) as usize;
+        Nfts::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn nft_type_hashes(&self) -> Hashes {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[40..]) as usize;
+        if self.has_extra_fields() {
+            let end = molecule::unpack_number(&slice[44..]) as usize;
+            Hashes::new_unchecked(self.0.slice(start..end))
+        } else {
+            Hashes::new_unchecked(self.0.slice(start..))
+        }
+    }
+    pub fn as_reader<'r>(&'r self) -> NftArgsReader<'r> {
+        NftArgsReader::new_unchecked(self.as_slice())
+    }
+}
+impl molecule::prelude::Entity for NftArgs {
+    type Builder = NftArgsBuilder;
+    const NAME: &'static str = "NftArgs";
+    fn new_unchecked(data: molecule::bytes::Bytes) -> Self {
+        NftArgs(data)
+    }
+    fn as_bytes(&self) -> molecule::bytes::Bytes {
+        self.0.clone()
+    }
+    fn as_slice(&self) -> &[u8] {
+        &self.0[..]
+    }
+    fn from_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
+        NftArgsReader::from_slice(slice).map(|reader| reader.to_entity())
+    }
+    fn from_compatible_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
+        NftArgsReader::from_compatible_slice(slice).map(|reader| reader.to_entity())
+    }
+    fn new_builder() -> Self::Builder {
+        ::core::default::Default::default()
+    }
+    fn as_builder(self) -> Self::Builder {
+        Self::new_builder()
+            .user_staking_ckb(self.user_staking_ckb())
+            .user_deck_size(self.user_deck_size())
+            .begin_blocknumber(self.begin_blocknumber())
+            .lock_code_hash(self.lock_code_hash())
+            .lua_code_hashes(self.lua_code_hashes())
+            .user1_pkhash(self.user1_pkhash())
+            .user1_nfts(self.user1_nfts())
+            .user2_pkhash(self.user2_pkhash())
+            .user2_nfts(self.user2_nfts())
+            .nft_type_hashes(self.nft_type_hashes())
+    }
+}
+#[derive(Clone, Copy)]
+pub struct NftArgsReader<'r>(&'r [u8]);
+impl<'r> ::core::fmt::LowerHex for NftArgsReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        use molecule::hex_string;
+        if f.alternate() {
+            write!(f, "0x")?;
+        }
+        write!(f, "{}", hex_string(self.as_slice()))
+    }
+}
+impl<'r> ::core::fmt::Debug for NftArgsReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{}({:#x})", Self::NAME, self)
+    }
+}
+impl<'r> ::core::fmt::Display for NftArgsReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{} {{ ", Self::NAME)?;
+        write!(f, "{}: {}", "user_staking_ckb", self.user_staking_ckb())?;
+        write!(f, ", {}: {}", "user_deck_size", self.user_deck_size())?;
+        write!(f, ", {}: {}", "begin_blocknumber", self.begin_blocknumber())?;
+        write!(f, ", {}: {}", "lock_code_hash", self.lock_code_hash())?;
+        write!(f, ", {}: {}", "lua_code_hashes", self.lua_code_hashes())?;
+        write!(f, ", {}: {}", "user1_pkhash", self.user1_pkhash())?;
+        write!(f, ", {}: {}", "user1_nfts", self.user1_nfts())?;
+        write!(f, ", {}: {}", "user2_pkhash", self.user2_pkhash())?;
+        write!(f, ", {}: {}", "user2_nfts", self.user2_nfts())?;
+        write!(f, ", {}: {}", "nft_type_hashes", self.nft_type_hashes())?;
+        let extra_count = self.count_extra_fields();
+        if extra_count != 0 {
+            write!(f, ", .. ({} fields)", extra_count)?;
+        }
+        write!(f, " }}")
+    }
+}
+impl<'r> NftArgsReader<'r> {
+    pub const FIELD_COUNT: usize = 10;
+    pub fn total_size(&self) -> usize {
+        molecule::unpack_number(self.as_slice()) as usize
+    }
+    pub fn field_count(&self) -> usize {
+        if self.total_size() == molecule::NUMBER_SIZE {
+            0
+        } else {
+            (molecule::unpack_number(&self.as_slice()[molecule::NUMBER_SIZE..]) as usize / 4) - 1
+        }
+    }
+    pub fn count_extra_fields(&self) -> usize {
+        self.field_count() - Self::FIELD_COUNT
+    }
+    pub fn has_extra_fields(&self) -> bool {
+        Self::FIELD_COUNT != self.field_count()
+    }
+    pub fn user_staking_ckb(&self) -> Uint64TReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[4..]) as usize;
+        let end = molecule::unpack_number(&slice[8..]) as usize;
+        Uint64TReader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn user_deck_size(&self) -> Uint8TReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[8..]) as usize;
+        let end = molecule::unpack_number(&slice[12..]) as usize;
+        Uint8TReader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn begin_blocknumber(&self) -> Uint64TReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[12..]) as usize;
+        let end = molecule::unpack_number(&slice[16..]) as usize;
+        Uint64TReader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn lock_code_hash(&self) -> Blake256Reader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[16..]) as usize;
+        let end = molecule::unpack_number(&slice[20..]) as usize;
+        Blake256Reader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn lua_code_hashes(&self) -> HashesReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[20..]) as usize;
+        let end = molecule::unpack_number(&slice[24..]) as usize;
+        HashesReader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn user1_pkhash(&self) -> Blake160Reader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[24..]) as usize;
+        let end = molecule::unpack_number(&slice[28..]) as usize;
+        Blake160Reader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn user1_nfts(&self) -> NftsReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[28..]) as usize;
+        let end = molecule::unpack_number(&slice[32..]) as usize;
+        NftsReader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn user2_pkhash(&self) -> Blake160Reader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[32..]) as usize;
+        let end = molecule::unpack_number(&slice[36..]) as usize;
+        Blake160Reader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn user2_nfts(&self) -> NftsReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[36..]) as usize;
+        let end = molecule::unpack_number(&slice[40..]) as usize;
+        NftsReader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn nft_type_hashes(&self) -> HashesReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[40..]) as usize;
+        if self.has_extra_fields() {
+            let end = molecule::unpack_number(&slice[44..]) as usize;
+            HashesReader::new_unchecked(&self.as_slice()[start..end])
+        } else {
+            HashesReader::new_unchecked(&self.as_slice()[start..])
+        }
+    }
+}
+impl<'r> molecule::prelude::Reader<'r> for NftArgsReader<'r> {
+    type Entity = NftArgs;
+    const NAME: &'static str = "NftArgsReader";
+    fn to_entity(&self) -> Self::Entity {
+        Self::Entity::new_unchecked(self.as_slice().to_owned().into())
+    }
+    fn new_unchecked(slice: &'r [u8]) -> Self {
+        NftArgsReader(slice)
+    }
+    fn as_slice(&self) -> &'r [u8] {
+        self.0
+    }
+    fn verify(slice: &[u8], compatible: bool) -> molecule::error::VerificationResult<()> {
+        use molecule::verification_error as ve;
+        let slice_len = slice.len();
+        if slice_len < molecule::NUMBER_SIZE {
+            return ve!(Self, HeaderIsBroken, molecule::NUMBER_SIZE, slice_len);
+        }
+        let total_size = molecule::unpack_number(slice) as usize;
+        if slice_len != total_size {
+            return ve!(Self, TotalSizeNotMatch, total_size, slice_len);
+        }
+        if slice_len == molecule::NUMBER_SIZE && Self::FIELD_COUNT == 0 {
+            return Ok(());
+        }
+        if slice_len < molecule::NUMBER_SIZE * 2 {
+            return ve!(Self, HeaderIsBroken, molecule::NUMBER_SIZE * 2, slice_len);
+        }
+        let offset_first = molecule::unpack_number(&slice[molecule::NUMBER_SIZE..]) as usize;
+        if offset_first % molecule::NUMBER_SIZE != 0 || offset_first < molecule::NUMBER_SIZE * 2 {
+            return ve!(Self, OffsetsNotMatch);
+        }
+        if slice_len < offset_first {
+            return ve!(Self, HeaderIsBroken, offset_first, slice_len);
+        }
+        let field_count = offset_first / molecule::NUMBER_SIZE - 1;
+        if field_count < Self::FIELD_COUNT {
+            return ve!(Self, FieldCountNotMatch, Self::FIELD_COUNT, field_count);
+        } else if !compatible && field_count > Self::FIELD_COUNT {
+            return ve!(Self, FieldCountNotMatch, Self::FIELD_COUNT, field_count);
+        };
+        let mut offsets: Vec<usize> = slice[molecule::NUMBER_SIZE..offset_first]
+            .chunks_exact(molecule::NUMBER_SIZE)
+            .map(|x| molecule::unpack_number(x) as usize)
+            .collect();
+        offsets.push(total_size);
+        if offsets.windows(2).any(|i| i[0] > i[1]) {
+            return ve!(Self, OffsetsNotMatch);
+        }
+        Uint64TReader::verify(&slice[offsets[0]..offsets[1]], compatible)?;
+        Uint8TReader::verify(&slice[offsets[1]..offsets[2]], compatible)?;
+        Uint64TReader::verify(&slice[offsets[2]..offsets[3]], compatible)?;
+        Blake256Reader::verify(&slice[offsets[3]..offsets[4]], compatible)?;
+        HashesReader::verify(&slice[offsets[4]..offsets[5]], compatible)?;
+        Blake160Reader::verify(&slice[offsets[5]..offsets[6]], compatible)?;
+        NftsReader::verify(&slice[offsets[6]..offsets[7]], compatible)?;
+        Blake160Reader::verify(&slice[offsets[7]..offsets[8]], compatible)?;
+        NftsReader::verify(&slice[offsets[8]..offsets[9]], compatible)?;
+        HashesReader::verify(&slice[offsets[9]..offsets[10]], compatible)?;
+        Ok(())
+    }
+}
+#[derive(Debug, Default)]
+pub struct NftArgsBuilder {
+    pub(crate) user_staking_ckb: Uint64T,
+    pub(crate) user_deck_size: Uint8T,
+    pub(crate) begin_blocknumber: Uint64T,
+    pub(crate) lock_code_hash: Blake256,
+    pub(crate) lua_code_hashes: Hashes,
+    pub(crate) user1_pkhash: Blake160,
+    pub(crate) user1_nfts: Nfts,
+    pub(crate) user2_pkhash: Blake160,
+    pub(crate) user2_nfts: Nfts,
+    pub(crate) nft_type_hashes: Hashes,
+}
+impl NftArgsBuilder {
+    pub const FIELD_COUNT: usize = 10;
+    pub fn user_staking_ckb(mut self, v: Uint64T) -> Self {
+        self.user_staking_ckb = v;
+        self
+    }
+    pub fn user_deck_size(mut self, v: Uint8T) -> Self {
+        self.user_deck_size = v;
+        self
+    }
+    pub fn begin_blocknumber(mut self, v: Uint64T) -> Self {
+        self.begin_blocknumber = v;
+        self
+    }
+    pub fn lock_code_hash(mut self, v: Blake256) -> Self {
+        self.lock_code_hash = v;
+        self
+    }
+    pub fn lua_code_hashes(mut self, v: Hashes) -> Self {
+        self.lua_code_hashes = v;
+        self
+    }
+    pub fn user1_pkhash(mut self, v: Blake160) -> Self {
+        self.user1_pkhash = v;
+        self
+    }
+    pub fn user1_nfts(mut self, v: Nfts) -> Self {
+        self.user1_nfts = v;
+        self
+    }
+    pub fn user2_pkhash(mut self, v: Blake160) -> Self {
+        self.user2_pkhash = v;
+        self
+    }
+    pub fn user2_nfts(mut self, v: Nfts) -> Self {
+        self.user2_nfts = v;
+        self
+    }
+    pub fn nft_type_hashes(mut self, v: Hashes) -> Self {
+        self.nft_type_hashes = v;
+        self
+    }
+}
+impl molecule::prelude::Builder for NftArgsBuilder {
+    type Entity = NftArgs;
+    const NAME: &'static str = "NftArgsBuilder";
+    fn expected_length(&self) -> usize {
+        molecule::NUMBER_SIZE * (Self::FIELD_COUNT + 1)
+            + self.user_staking_ckb.as_slice().len()
+            + self.user_deck_size.as_slice().len()
+            + self.begin_blocknumber.as_slice().len()
+            + self.lock_code_hash.as_slice().len()
+            + self.lua_code_hashes.as_slice().len()
+            + self.user1_pkhash.as_slice().len()
+            + self.user1_nfts.as_slice().len()
+            + self.user2_pkhash.as_slice().len()
+            + self.user2_nfts.as_slice().len()
+            + self.nft_type_hashes.as_slice().len()
+    }
+    fn write<W: ::molecule::io::Write>(&self, writer: &mut W) -> ::molecule::io::Result<()> {
+        let mut total_size = molecule::NUMBER_SIZE * (Self::FIELD_COUNT + 1);
+        let mut offsets = Vec::with_capacity(Self::FIELD_COUNT);
+        offsets.push(total_size);
+        total_size += self.user_staking_ckb.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.user_deck_size.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.begin_blocknumber.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.lock_code_hash.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.lua_code_hashes.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.user1_pkhash.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.user1_nfts.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.user2_pkhash.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.user2_nfts.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.nft_type_hashes.as_slice().len();
+        writer.write_all(&molecule::pack_number(total_size as molecule::Number))?;
+        for offset in offsets.into_iter() {
+            writer.write_all(&molecule::pack_number(offset as molecule::Number))?;
+        }
+        writer.write_all(self.user_staking_ckb.as_slice())?;
+        writer.write_all(self.user_deck_size.as_slice())?;
+        writer.write_all(self.begin_blocknumber.as_slice())?;
+        writer.write_all(self.lock_code_hash.as_slice())?;
+        writer.write_all(self.lua_code_hashes.as_slice())?;
+        writer.write_all(self.user1_pkhash.as_slice())?;
+        writer.write_all(self.user1_nfts.as_slice())?;
+        writer.write_all(self.user2_pkhash.as_slice())?;
+        writer.write_all(self.user2_nfts.as_slice())?;
+        writer.write_all(self.nft_type_hashes.as_slice())?;
+        Ok(())
+    }
+    fn build(&self) -> Self::Entity {
+        let mut inner = Vec::with_capacity(self.expected_length());
+        self.write(&mut inner)
+            .unwrap_or_else(|_| panic!("{} build should be ok", Self::NAME));
+        NftArgs::new_unchecked(inner.into())
+    }
+}
+#[derive(Clone)]
+pub struct MerkleArgs(molecule::bytes::Bytes);
+impl ::core::fmt::LowerHex for MerkleArgs {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        use molecule::hex_string;
+        if f.alternate() {
+            write!(f, "0x")?;
+        }
+        write!(f, "{}", hex_string(self.as_slice()))
+    }
+}
+impl ::core::fmt::Debug for MerkleArgs {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{}({:#x})", Self::NAME, self)
+    }
+}
+impl ::core::fmt::Display for MerkleArgs {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{} {{ ", Self::NAME)?;
+        write!(f, "{}: {}", "user_staking_ckb", self.user_staking_ckb())?;
+        write!(f, ", {}: {}", "user_deck_size", self.user_deck_size())?;
+        write!(f, ", {}: {}", "begin_blocknumber", self.begin_blocknumber())?;
+        write!(f, ", {}: {}", "lock_code_hash", self.lock_code_hash())?;
+        write!(f, ", {}: {}", "lua_code_hashes", self.lua_code_hashes())?;
+        write!(f, ", {}: {}", "user1_pkhash", self.user1_pkhash())?;
+        write!(f, ", {}: {}", "user1_nft_root", self.user1_nft_root())?;
+        write!(f, ", {}: {}", "user2_pkhash", self.user2_pkhash())?;
+        write!(f, ", {}: {}", "user2_nft_root", self.user2_nft_root())?;
+        let extra_count = self.count_extra_fields();
+        if extra_count != 0 {
+            write!(f, ", .. ({} fields)", extra_count)?;
+        }
+        write!(f, " }}")
+    }
+}
+impl ::core::default::Default for MerkleArgs {
+    fn default() -> Self {
+        let v: Vec<u8> = vec![
+            197, 0, 0, 0, 40, 0, 0, 0, 48, 0, 0, 0, 49, 0, 0, 0, 57, 0, 0, 0, 89, 0, 0, 0, 93, 0,
+            0, 0, 113, 0, 0, 0, 145, 0, 0, 0, 165, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        ];
+        MerkleArgs::new_unchecked(v.into())
+    }
+}
+impl MerkleArgs {
+    pub const FIELD_COUNT: usize = 9;
+    pub fn total_size(&self) -> usize {
+        molecule::unpack_number(self.as_slice()) as usize
+    }
+    pub fn field_count(&self) -> usize {
+        if self.total_size() == molecule::NUMBER_SIZE {
+            0
+        } else {
+            (molecule::unpack_number(&self.as_slice()[molecule::NUMBER_SIZE..]) as usize / 4) - 1
+        }
+    }
+    pub fn count_extra_fields(&self) -> usize {
+        self.field_count() - Self::FIELD_COUNT
+    }
+    pub fn has_extra_fields(&self) -> bool {
+        Self::FIELD_COUNT != self.field_count()
+    }
+    pub fn user_staking_ckb(&self) -> Uint64T {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[4..]) as usize;
+        let end = molecule::unpack_number(&slice[8..]) as usize;
+        Uint64T::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn user_deck_size(&self) -> Uint8T {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[8..]) as usize;
+        let end = molecule::unpack_number(&slice[12..]) as usize;
+        Uint8T::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn begin_blocknumber(&self) -> Uint64T {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[12..]) as usize;
+        let end = molecule::unpack_number(&slice[16..]) as usize;
+        Uint64T::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn lock_code_hash(&self) -> Blake256 {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[16..]) as usize;
+        let end = molecule::unpack_number(&slice[20..]) as usize;
+        Blake256::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn lua_code_hashes(&self) -> Hashes {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[20..]) as usize;
+        let end = molecule::unpack_number(&slice[24..]) as usize;
+        Hashes::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn user1_pkhash(&self) -> Blake160 {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[24..]) as usize;
+        let end = molecule::unpack_number(&slice[28..]) as usize;
+        Blake160::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn user1_nft_root(&self) -> Blake256 {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[28..]) as usize;
+        let end = molecule::unpack_number(&slice[32..]) as usize;
+        Blake256::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn user2_pkhash(&self) -> Blake160 {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[32..]) as usize;
+        let end = molecule::unpack_number(&slice[36..]) as usize;
+        Blake160::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn user2_nft_root(&self) -> Blake256 {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[36..]) as usize;
+        if self.has_extra_fields() {
+            let end = molecule::unpack_number(&slice[40..]) as usize;
+            Blake256::new_unchecked(self.0.slice(start..end))
+        } else {
+            Blake256::new_unchecked(self.0.slice(start..))
+        }
+    }
+    pub fn as_reader<'r>(&'r self) -> MerkleArgsReader<'r> {
+        MerkleArgsReader::new_unchecked(self.as_slice())
+    }
+}
+impl molecule::prelude::Entity for MerkleArgs {
+    type Builder = MerkleArgsBuilder;
+    const NAME: &'static str = "MerkleArgs";
+    fn new_unchecked(data: molecule::bytes::Bytes) -> Self {
+        MerkleArgs(data)
+    }
+    fn as_bytes(&self) -> molecule::bytes::Bytes {
+        self.0.clone()
+    }
+    fn as_slice(&self) -> &[u8] {
+        &self.0[..]
+    }
+    fn from_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
+        MerkleArgsReader::from_slice(slice).map(|reader| reader.to_entity())
+    }
+    fn from_compatible_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
+        MerkleArgsReader::from_compatible_slice(slice).map(|reader| reader.to_entity())
+    }
+    fn new_builder() -> Self::Builder {
+        ::core::default::Default::default()
+    }
+    fn as_builder(self) -> Self::Builder {
+        Self::new_builder()
+            .user_staking_ckb(self.user_staking_ckb())
+            .user_deck_size(self.user_deck_size())
+            .begin_blocknumber(self.begin_blocknumber())
+            .lock_code_hash(self.lock_code_hash())
+            .lua_code_hashes(self.lua_code_hashes())
+            .user1_pkhash(self.user1_pkhash())
+            .user1_nft_root(self.user1_nft_root())
+            .user2_pkhash(self.user2_pkhash())
+            .user2_nft_root(self.user2_nft_root())
+    }
+}
+#[derive(Clone, Copy)]
+pub struct MerkleArgsReader<'r>(&'r [u8]);
+impl<'r> ::core::fmt::LowerHex for MerkleArgsReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        use molecule::hex_string;
+        if f.alternate() {
+            write!(f, "0x")?;
+        }
+        write!(f, "{}", hex_string(self.as_slice()))
+    }
+}
+impl<'r> ::core::fmt::Debug for MerkleArgsReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{}({:#x})", Self::NAME, self)
+    }
+}
+impl<'r> ::core::fmt::Display for MerkleArgsReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{} {{ ", Self::NAME)?;
+        write!(f, "{}: {}", "user_staking_ckb", self.user_staking_ckb())?;
+        write!(f, ", {}: {}", "user_deck_size", self.user_deck_size())?;
+        write!(f, ", {}: {}", "begin_blocknumber", self.begin_blocknumber())?;
+        write!(f, ", {}: {}", "lock_code_hash", self.lock_code_hash())?;
+        write!(f, ", {}: {}", "lua_code_hashes", self.lua_code_hashes())?;
+        write!(f, ", {}: {}", "user1_pkhash", self.user1_pkhash())?;
+        write!(f, ", {}: {}", "user1_nft_root", self.user1_nft_root())?;
+        write!(f, ", {}: {}", "user2_pkhash", self.user2_pkhash())?;
+        write!(f, ", {}: {}", "user2_nft_root", self.user2_nft_root())?;
+        let extra_count = self.count_extra_fields();
+        if extra_count != 0 {
+            write!(f, ", .. ({} fields)", extra_count)?;
+        }
+        write!(f, " }}")
+    }
+}
+impl<'r> MerkleArgsReader<'r> {
+    pub const FIELD_COUNT: usize = 9;
+    pub fn total_size(&self) -> usize {
+        molecule::unpack_number(self.as_slice()) as usize
+    }
+    pub fn field_count(&self) -> usize {
+        if self.total_size() == molecule::NUMBER_SIZE {
+            0
+        } else {
+            (molecule::unpack_number(&self.as_slice()[molecule::NUMBER_SIZE..]) as usize / 4) - 1
+        }
+    }
+    pub fn count_extra_fields(&self) -> usize {
+        self.field_count() - Self::FIELD_COUNT
+    }
+    pub fn has_extra_fields(&self) -> bool {
+        Self::FIELD_COUNT != self.field_count()
+    }
+    pub fn user_staking_ckb(&self) -> Uint64TReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[4..]) as usize;
+        let end = molecule::unpack_number(&slice[8..]) as usize;
+        Uint64TReader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn user_deck_size(&self) -> Uint8TReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[8..]) as usize;
+        let end = molecule::unpack_number(&slice[12..]) as usize;
+        Uint8TReader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn begin_blocknumber(&self) -> Uint64TReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[12..]) as usize;
+        let end = molecule::unpack_number(&slice[16..]) as usize;
+        Uint64TReader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn lock_code_hash(&self) -> Blake256Reader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[16..]) as usize;
+        let end = molecule::unpack_number(&slice[20..]) as usize;
+        Blake256Reader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn lua_code_hashes(&self) -> HashesReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[20..]) as usize;
+        let end = molecule::unpack_number(&slice[24..]) as usize;
+        HashesReader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn user1_pkhash(&self) -> Blake160Reader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[24..]) as usize;
+        let end = molecule::unpack_number(&slice[28..]) as usize;
+        Blake160Reader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn user1_nft_root(&self) -> Blake256Reader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[28..]) as usize;
+        let end = molecule::unpack_number(&slice[32..]) as usize;
+        Blake256Reader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn user2_pkhash(&self) -> Blake160Reader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[32..]) as usize;
+        let end = molecule::unpack_number(&slice[36..]) as usize;
+        Blake160Reader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn user2_nft_root(&self) -> Blake256Reader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[36..]) as usize;
+        if self.has_extra_fields() {
+            let end = molecule::unpack_number(&slice[40..]) as usize;
+            Blake256Reader::new_unchecked(&self.as_slice()[start..end])
+        } else {
+            Blake256Reader::new_unchecked(&self.as_slice()[start..])
+        }
+    }
+}
+impl<'r> molecule::prelude::Reader<'r> for MerkleArgsReader<'r> {
+    type Entity = MerkleArgs;
+    const NAME: &'static str = "MerkleArgsReader";
+    fn to_entity(&self) -> Self::Entity {
+        Self::Entity::new_unchecked(self.as_slice().to_owned().into())
+    }
+    fn new_unchecked(slice: &'r [u8]) -> Self {
+        MerkleArgsReader(slice)
+    }
+    fn as_slice(&self) -> &'r [u8] {
+        self.0
+    }
+    fn verify(slice: &[u8], compatible: bool) -> molecule::error::VerificationResult<()> {
+        use molecule::verification_error as ve;
+        let slice_len = slice.len();
+        if slice_len < molecule::NUMBER_SIZE {
+            return ve!(Self, HeaderIsBroken, molecule::NUMBER_SIZE, slice_len);
+        }
+        let total_size = molecule::unpack_number(slice) as usize;
+        if slice_len != total_size {
+            return ve!(Self, TotalSizeNotMatch, total_size, slice_len);
+        }
+        if slice_len == molecule::NUMBER_SIZE && Self::FIELD_COUNT == 0 {
+            return Ok(());
+        }
+        if slice_len < molecule::NUMBER_SIZE * 2 {
+            return ve!(Self, HeaderIsBroken, molecule::NUMBER_SIZE * 2, slice_len);
+        }
+        let offset_first = molecule::unpack_number(&slice[molecule::NUMBER_SIZE..]) as usize;
+        if offset_first % molecule::NUMBER_SIZE != 0 || offset_first < molecule::NUMBER_SIZE * 2 {
+            return ve!(Self, OffsetsNotMatch);
+        }
+        if slice_len < offset_first {
+            return ve!(Self, HeaderIsBroken, offset_first, slice_len);
+        }
+        let field_count = offset_first / molecule::NUMBER_SIZE - 1;
+        if field_count < Self::FIELD_COUNT {
+            return ve!(Self, FieldCountNotMatch, Self::FIELD_COUNT, field_count);
+        } else if !compatible && field_count > Self::FIELD_COUNT {
+            return ve!(Self, FieldCountNotMatch, Self::FIELD_COUNT, field_count);
+        };
+        let mut offsets: Vec<usize> = slice[molecule::NUMBER_SIZE..offset_first]
+            .chunks_exact(molecule::NUMBER_SIZE)
+            .map(|x| molecule::unpack_number(x) as usize)
+            .collect();
+        offsets.push(total_size);
+        if offsets.windows(2).any(|i| i[0] > i[1]) {
+            return ve!(Self, OffsetsNotMatch);
+        }
+        Uint64TReader::verify(&slice[offsets[0]..offsets[1]], compatible)?;
+        Uint8TReader::verify(&slice[offsets[1]..offsets[2]], compatible)?;
+        Uint64TReader::verify(&slice[offsets[2]..offsets[3]], compatible)?;
+        Blake256Reader::verify(&slice[offsets[3]..offsets[4]], compatible)?;
+        HashesReader::verify(&slice[offsets[4]..offsets[5]], compatible)?;
+        Blake160Reader::verify(&slice[offsets[5]..offsets[6]], compatible)?;
+        Blake256Reader::verify(&slice[offsets[6]..offsets[7]], compatible)?;
+        Blake160Reader::verify(&slice[offsets[7]..offsets[8]], compatible)?;
+        Blake256Reader::verify(&slice[offsets[8]..offsets[9]], compatible)?;
+        Ok(())
+    }
+}
+#[derive(Debug, Default)]
+pub struct MerkleArgsBuilder {
+    pub(crate) user_staking_ckb: Uint64T,
+    pub(crate) user_deck_size: Uint8T,
+    pub(crate) begin_blocknumber: Uint64T,
+    pub(crate) lock_code_hash: Blake256,
+    pub(crate) lua_code_hashes: Hashes,
+    pub(crate) user1_pkhash: Blake160,
+    pub(crate) user1_nft_root: Blake256,
+    pub(crate) user2_pkhash: Blake160,
+    pub(crate) user2_nft_root: Blake256,
+}
+impl MerkleArgsBuilder {
+    pub const FIELD_COUNT: usize = 9;
+    pub fn user_staking_ckb(mut self, v: Uint64T) -> Self {
+        self.user_staking_ckb = v;
+        self
+    }
+    pub fn user_deck_size(mut self, v: Uint8T) -> Self {
+        self.user_deck_size = v;
+        self
+    }
+    pub fn begin_blocknumber(mut self, v: Uint64T) -> Self {
+        self.begin_blocknumber = v;
+        self
+    }
+    pub fn lock_code_hash(mut self, v: Blake256) -> Self {
+        self.lock_code_hash = v;
+        self
+    }
+    pub fn lua_code_hashes(mut self, v: Hashes) -> Self {
+        self.lua_code_hashes = v;
+        self
+    }
+    pub fn user1_pkhash(mut self, v: Blake160) -> Self {
+        self.user1_pkhash = v;
+        self
+    }
+    pub fn user1_nft_root(mut self, v: Blake256) -> Self {
+        self.user1_nft_root = v;
+        self
+    }
+    pub fn user2_pkhash(mut self, v: Blake160) -> Self {
+        self.user2_pkhash = v;
+        self
+    }
+    pub fn user2_nft_root(mut self, v: Blake256) -> Self {
+        self.user2_nft_root = v;
+        self
+    }
+}
+impl molecule::prelude::Builder for MerkleArgsBuilder {
+    type Entity = MerkleArgs;
+    const NAME: &'static str = "MerkleArgsBuilder";
+    fn expected_length(&self) -> usize {
+        molecule::NUMBER_SIZE * (Self::FIELD_COUNT + 1)
+            + self.user_staking_ckb.as_slice().len()
+            + self.user_deck_size.as_slice().len()
+            + self.begin_blocknumber.as_slice().len()
+            + self.lock_code_hash.as_slice().len()
+            + self.lua_code_hashes.as_slice().len()
+            + self.user1_pkhash.as_slice().len()
+            + self.user1_nft_root.as_slice().len()
+            + self.user2_pkhash.as_slice().len()
+            + self.user2_nft_root.as_slice().len()
+    }
+    fn write<W: ::molecule::io::Write>(&self, writer: &mut W) -> ::molecule::io::Result<()> {
+        let mut total_size = molecule::NUMBER_SIZE * (Self::FIELD_COUNT + 1);
+        let mut offsets = Vec::with_capacity(Self::FIELD_COUNT);
+        offsets.push(total_size);
+        total_size += self.user_staking_ckb.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.user_deck_size.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.begin_blocknumber.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.lock_code_hash.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.lua_code_hashes.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.user1_pkhash.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.user1_nft_root.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.user2_pkhash.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.user2_nft_root.as_slice().len();
+        writer.write_all(&molecule::pack_number(total_size as molecule::Number))?;
+        for offset in offsets.into_iter() {
+            writer.write_all(&molecule::pack_number(offset as molecule::Number))?;
+        }
+        writer.write_all(self.user_staking_ckb.as_slice())?;
+        writer.write_all(self.user_deck_size.as_slice())?;
+        writer.write_all(self.begin_blocknumber.as_slice())?;
+        writer.write_all(self.lock_code_hash.as_slice())?;
+        writer.write_all(self.lua_code_hashes.as_slice())?;
+        writer.write_all(self.user1_pkhash.as_slice())?;
+        writer.write_all(self.user1_nft_root.as_slice())?;
+        writer.write_all(self.user2_pkhash.as_slice())?;
+        writer.write_all(self.user2_nft_root.as_slice())?;
+        Ok(())
+    }
+    fn build(&self) -> Self::Entity {
+        let mut inner = Vec::with_capacity(self.expected_length());
+        self.write(&mut inner)
+            .unwrap_or_else(|_| panic!("{} build should be ok", Self::NAME));
+        MerkleArgs::new_unchecked(inner.into())
+    }
+}
+#[derive(Clone)]
+pub struct Reveal(molecule::bytes::Bytes);
+impl ::core::fmt::LowerHex for Reveal {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        use molecule::hex_string;
+        if f.alternate() {
+            write!(f, "0x")?;
+        }
+        write!(f, "{}", hex_string(self.as_slice()))
+    }
+}
+impl ::core::fmt::Debug for Reveal {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{}({:#x})", Self::NAME, self)
+    }
+}
+impl ::core::fmt::Display for Reveal {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{} {{ ", Self::NAME)?;
+        write!(f, "{}: {}", "user_type", self.user_type())?;
+        write!(f, ", {}: {}", "index", self.index())?;
+        write!(f, ", {}: {}", "nft", self.nft())?;
+        write!(f, ", {}: {}", "proof", self.proof())?;
+        let extra_count = self.count_extra_fields();
+        if extra_count != 0 {
+            write!(f, ", .. ({} fields)", extra_count)?;
+        }
+        write!(f, " }}")
+    }
+}
+impl ::core::default::Default for Reveal {
+    fn default() -> Self {
+        let v: Vec<u8> = vec![
+            46, 0, 0, 0, 20, 0, 0, 0, 21, 0, 0, 0, 22, 0, 0, 0, 42, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+        ];
+        Reveal::new_unchecked(v.into())
+    }
+}
+impl Reveal {
+    pub const FIELD_COUNT: usize = 4;
+    pub fn total_size(&self) -> usize {
+        molecule::unpack_number(self.as_slice()) as usize
+    }
+    pub fn field_count(&self) -> usize {
+        if self.total_size() == molecule::NUMBER_SIZE {
+            0
+        } else {
+            (molecule::unpack_number(&self.as_slice()[molecule::NUMBER_SIZE..]) as usize / 4) - 1
+        }
+    }
+    pub fn count_extra_fields(&self) -> usize {
+        self.field_count() - Self::FIELD_COUNT
+    }
+    pub fn has_extra_fields(&self) -> bool {
+        Self::FIELD_COUNT != self.field_count()
+    }
+    pub fn user_type(&self) -> Uint8T {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[4..]) as usize;
+        let end = molecule::unpack_number(&slice[8..]) as usize;
+        Uint8T::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn index(&self) -> Uint8T {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[8..]) as usize;
+        let end = molecule::unpack_number(&slice[12..]) as usize;
+        Uint8T::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn nft(&self) -> Blake160 {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[12..]) as usize;
+        let end = molecule::unpack_number(&slice[16..]) as usize;
+        Blake160::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn proof(&self) -> Hashes {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[16..]) as usize;
+        if self.has_extra_fields() {
+            let end = molecule::unpack_number(&slice[20..]) as usize;
+            Hashes::new_unchecked(self.0.slice(start..end))
+        } else {
+            Hashes::new_unchecked(self.0.slice(start..))
+        }
+    }
+    pub fn as_reader<'r>(&'r self) -> RevealReader<'r> {
+        RevealReader::new_unchecked(self.as_slice())
+    }
+}
+impl molecule::prelude::Entity for Reveal {
+    type Builder = RevealBuilder;
+    const NAME: &'static str = "Reveal";
+    fn new_unchecked(data: molecule::bytes::Bytes) -> Self {
+        Reveal(data)
+    }
+    fn as_bytes(&self) -> molecule::bytes::Bytes {
+        self.0.clone()
+    }
+    fn as_slice(&self) -> &[u8] {
+        &self.0[..]
+    }
+    fn from_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
+        RevealReader::from_slice(slice).map(|reader| reader.to_entity())
+    }
+    fn from_compatible_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
+        RevealReader::from_compatible_slice(slice).map(|reader| reader.to_entity())
+    }
+    fn new_builder() -> Self::Builder {
+        ::core::default::Default::default()
+    }
+    fn as_builder(self) -> Self::Builder {
+        Self::new_builder()
+            .user_type(self.user_type())
+            .index(self.index())
+            .nft(self.nft())
+            .proof(self.proof())
+    }
+}
+#[derive(Clone, Copy)]
+pub struct RevealReader<'r>(&'r [u8]);
+impl<'r> ::core::fmt::LowerHex for RevealReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        use molecule::hex_string;
+        if f.alternate() {
+            write!(f, "0x")?;
+        }
+        write!(f, "{}", hex_string(self.as_slice()))
+    }
+}
+impl<'r> ::core::fmt::Debug for RevealReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{}({:#x})", Self::NAME, self)
+    }
+}
+impl<'r> ::core::fmt::Display for RevealReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{} {{ ", Self::NAME)?;
+        write!(f, "{}: {}", "user_type", self.user_type())?;
+        write!(f, ", {}: {}", "index", self.index())?;
+        write!(f, ", {}: {}", "nft", self.nft())?;
+        write!(f, ", {}: {}", "proof", self.proof())?;
+        let extra_count = self.count_extra_fields();
+        if extra_count != 0 {
+            write!(f, ", .. ({} fields)", extra_count)?;
+        }
+        write!(f, " }}")
+    }
+}
+impl<'r> RevealReader<'r> {
+    pub const FIELD_COUNT: usize = 4;
+    pub fn total_size(&self) -> usize {
+        molecule::unpack_number(self.as_slice()) as usize
+    }
+    pub fn field_count(&self) -> usize {
+        if self.total_size() == molecule::NUMBER_SIZE {
+            0
+        } else {
+            (molecule::unpack_number(&self.as_slice()[molecule::NUMBER_SIZE..]) as usize / 4) - 1
+        }
+    }
+    pub fn count_extra_fields(&self) -> usize {
+        self.field_count() - Self::FIELD_COUNT
+    }
+    pub fn has_extra_fields(&self) -> bool {
+        Self::FIELD_COUNT != self.field_count()
+    }
+    pub fn user_type(&self) -> Uint8TReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[4..]) as usize;
+        let end = molecule::unpack_number(&slice[8..]) as usize;
+        Uint8TReader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn index(&self) -> Uint8TReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[8..]) as usize;
+        let end = molecule::unpack_number(&slice[12..]) as usize;
+        Uint8TReader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn nft(&self) -> Blake160Reader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[12..]) as usize;
+        let end = molecule::unpack_number(&slice[16..]) as usize;
+        Blake160Reader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn proof(&self) -> HashesReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[16..]) as usize;
+        if self.has_extra_fields() {
+            let end = molecule::unpack_number(&slice[20..]) as usize;
+            HashesReader::new_unchecked(&self.as_slice()[start..end])
+        } else {
+            HashesReader::new_unchecked(&self.as_slice()[start..])
+        }
+    }
+}
+impl<'r> molecule::prelude::Reader<'r> for RevealReader<'r> {
+    type Entity = Reveal;
+    const NAME: &'static str = "RevealReader";
+    fn to_entity(&self) -> Self::Entity {
+        Self::Entity::new_unchecked(self.as_slice().to_owned().into())
+    }
+    fn new_unchecked(slice: &'r [u8]) -> Self {
+        RevealReader(slice)
+    }
+    fn as_slice(&self) -> &'r [u8] {
+        self.0
+    }
+    fn verify(slice: &[u8], compatible: bool) -> molecule::error::VerificationResult<()> {
+        use molecule::verification_error as ve;
+        let slice_len = slice.len();
+        if slice_len < molecule::NUMBER_SIZE {
+            return ve!(Self, HeaderIsBroken, molecule::NUMBER_SIZE, slice_len);
+        }
+        let total_size = molecule::unpack_number(slice) as usize;
+        if slice_len != total_size {
+            return ve!(Self, TotalSizeNotMatch, total_size, slice_len);
+        }
+        if slice_len == molecule::NUMBER_SIZE && Self::FIELD_COUNT == 0 {
+            return Ok(());
+        }
+        if slice_len < molecule::NUMBER_SIZE * 2 {
+            return ve!(Self, HeaderIsBroken, molecule::NUMBER_SIZE * 2, slice_len);
+        }
+        let offset_first = molecule::unpack_number(&slice[molecule::NUMBER_SIZE..]) as usize;
+        if offset_first % molecule::NUMBER_SIZE != 0 || offset_first < molecule::NUMBER_SIZE * 2 {
+            return ve!(Self, OffsetsNotMatch);
+        }
+        if slice_len < offset_first {
+            return ve!(Self, HeaderIsBroken, offset_first, slice_len);
+        }
+        let field_count = offset_first / molecule::NUMBER_SIZE - 1;
+        if field_count < Self::FIELD_COUNT {
+            return ve!(Self, FieldCountNotMatch, Self::FIELD_COUNT, field_count);
+        } else if !compatible && field_count > Self::FIELD_COUNT {
+            return ve!(Self, FieldCountNotMatch, Self::FIELD_COUNT, field_count);
+        };
+        let mut offsets: Vec<usize> = slice[molecule::NUMBER_SIZE..offset_first]
+            .chunks_exact(molecule::NUMBER_SIZE)
+            .map(|x| molecule::unpack_number(x) as usize)
+            .collect();
+        offsets.push(total_size);
+        if offsets.windows(2).any(|i| i[0] > i[1]) {
+            return ve!(Self, OffsetsNotMatch);
+        }
+        Uint8TReader::verify(&slice[offsets[0]..offsets[1]], compatible)?;
+        Uint8TReader::verify(&slice[offsets[1]..offsets[2]], compatible)?;
+        Blake160Reader::verify(&slice[offsets[2]..offsets[3]], compatible)?;
+        HashesReader::verify(&slice[offsets[3]..offsets[4]], compatible)?;
+        Ok(())
+    }
+}
+#[derive(Debug, Default)]
+pub struct RevealBuilder {
+    pub(crate) user_type: Uint8T,
+    pub(crate) index: Uint8T,
+    pub(crate) nft: Blake160,
+    pub(crate) proof: Hashes,
+}
+impl RevealBuilder {
+    pub const FIELD_COUNT: usize = 4;
+    pub fn user_type(mut self, v: Uint8T) -> Self {
+        self.user_type = v;
+        self
+    }
+    pub fn index(mut self, v: Uint8T) -> Self {
+        self.index = v;
+        self
+    }
+    pub fn nft(mut self, v: Blake160) -> Self {
+        self.nft = v;
+        self
+    }
+    pub fn proof(mut self, v: Hashes) -> Self {
+        self.proof = v;
+        self
+    }
+}
+impl molecule::prelude::Builder for RevealBuilder {
+    type Entity = Reveal;
+    const NAME: &'static str = "RevealBuilder";
+    fn expected_length(&self) -> usize {
+        molecule::NUMBER_SIZE * (Self::FIELD_COUNT + 1)
+            + self.user_type.as_slice().len()
+            + self.index.as_slice().len()
+            + self.nft.as_slice().len()
+            + self.proof.as_slice().len()
+    }
+    fn write<W: ::molecule::io::Write>(&self, writer: &mut W) -> ::molecule::io::Result<()> {
+        let mut total_size = molecule::NUMBER_SIZE * (Self::FIELD_COUNT + 1);
+        let mut offsets = Vec::with_capacity(Self::FIELD_COUNT);
+        offsets.push(total_size);
+        total_size += self.user_type.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.index.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.nft.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.proof.as_slice().len();
+        writer.write_all(&molecule::pack_number(total_size as molecule::Number))?;
+        for offset in offsets.into_iter() {
+            writer.write_all(&molecule::pack_number(offset as molecule::Number))?;
+        }
+        writer.write_all(self.user_type.as_slice())?;
+        writer.write_all(self.index.as_slice())?;
+        writer.write_all(self.nft.as_slice())?;
+        writer.write_all(self.proof.as_slice())?;
+        Ok(())
+    }
+    fn build(&self) -> Self::Entity {
+        let mut inner = Vec::with_capacity(self.expected_length());
+        self.write(&mut inner)
+            .unwrap_or_else(|_| panic!("{} build should be ok", Self::NAME));
+        Reveal::new_unchecked(inner.into())
+    }
+}
+#[derive(Clone)]
+pub struct Reveals(molecule::bytes::Bytes);
+impl ::core::fmt::LowerHex for Reveals {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        use molecule::hex_string;
+        if f.alternate() {
+            write!(f, "0x")?;
+        }
+        write!(f, "{}", hex_string(self.as_slice()))
+    }
+}
+impl ::core::fmt::Debug for Reveals {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{}({:#x})", Self::NAME, self)
+    }
+}
+impl ::core::fmt::Display for Reveals {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{} [", Self::NAME)?;
+        for i in 0..self.len() {
+            if i == 0 {
+                write!(f, "{}", self.get_unchecked(i))?;
+            } else {
+                write!(f, ", {}", self.get_unchecked(i))?;
+            }
+        }
+        write!(f, "]")
+    }
+}
+impl ::core::default::Default for Reveals {
+    fn default() -> Self {
+        let v: Vec<u8> = vec![4, 0, 0, 0];
+        Reveals::new_unchecked(v.into())
+    }
+}
+impl Reveals {
+    pub fn total_size(&self) -> usize {
+        molecule::unpack_number(self.as_slice()) as usize
+    }
+    pub fn item_count(&self) -> usize {
+        if self.total_size() == molecule::NUMBER_SIZE {
+            0
+        } else {
+            (molecule::unpack_number(&self.as_slice()[molecule::NUMBER_SIZE..]) as usize / 4) - 1
+        }
+    }
+    pub fn len(&self) -> usize {
+        self.item_count()
+    }
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+    pub fn get(&self, idx: usize) -> Option<Reveal> {
+        if idx >= self.len() {
+            None
+        } else {
+            Some(self.get_unchecked(idx))
+        }
+    }
+    pub fn get_unchecked(&self, idx: usize) -> Reveal {
+        let slice = self.as_slice();
+        let start_idx = molecule::NUMBER_SIZE * (1 + idx);
+        let start = molecule::unpack_number(&slice[start_idx..]) as usize;
+        if idx == self.len() - 1 {
+            Reveal::new_unchecked(self.0.slice(start..))
+        } else {
+            let end_idx = start_idx + molecule::NUMBER_SIZE;
+            let end = molecule::unpack_number(&slice[end_idx..]) as usize;
+            Reveal::new_unchecked(self.0.slice(start..end))
+        }
+    }
+    pub fn as_reader<'r>(&'r self) -> RevealsReader<'r> {
+        RevealsReader::new_unchecked(self.as_slice())
+    }
+}
+impl molecule::prelude::Entity for Reveals {
+    type Builder = RevealsBuilder;
+    const NAME: &'static str = "Reveals";
+    fn new_unchecked(data: molecule::bytes::Bytes) -> Self {
+        Reveals(data)
+    }
+    fn as_bytes(&self) -> molecule::bytes::Bytes {
+        self.0.clone()
+    }
+    fn as_slice(&self) -> &[u8] {
+        &self.0[..]
+    }
+    fn from_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
+        RevealsReader::from_slice(slice).map(|reader| reader.to_entity())
+    }
+    fn from_compatible_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
+        RevealsReader::from_compatible_slice(slice).map(|reader| reader.to_entity())
+    }
+    fn new_builder() -> Self::Builder {
+        ::core::default::Default::default()
+    }
+    fn as_builder(self) -> Self::Builder {
+        Self::new_builder().extend(self.into_iter())
+    }
+}
+#[derive(Clone, Copy)]
+pub struct RevealsReader<'r>(&'r [u8]);
+impl<'r> ::core::fmt::LowerHex for RevealsReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        use molecule::hex_string;
+        if f.alternate() {
+            write!(f, "0x")?;
+        }
+        write!(f, "{}", hex_string(self.as_slice()))
+    }
+}
+impl<'r> ::core::fmt::Debug for RevealsReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{}({:#x})", Self::NAME, self)
+    }
+}
+impl<'r> ::core::fmt::Display for RevealsReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{} [", Self::NAME)?;
+        for i in 0..self.len() {
+            if i == 0 {
+                write!(f, "{}", self.get_unchecked(i))?;
+            } else {
+                write!(f, ", {}", self.get_unchecked(i))?;
+            }
+        }
+        write!(f, "]")
+    }
+}
+impl<'r> RevealsReader<'r> {
+    pub fn total_size(&self) -> usize {
+        molecule::unpack_number(self.as_slice()) as usize
+    }
+    pub fn item_count(&self) -> usize {
+        if self.total_size() == molecule::NUMBER_SIZE {
+            0
+        } else {
+            (molecule::unpack_number(&self.as_slice()[molecule::NUMBER_SIZE..]) as usize / 4) - 1
+        }
+    }
+    pub fn len(&self) -> usize {
+        self.item_count()
+    }
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+    pub fn get(&self, idx: usize) -> Option<RevealReader<'r>> {
+        if idx >= self.len() {
+            None
+        } else {
+            Some(self.get_unchecked(idx))
+        }
+    }
+    pub fn get_unchecked(&self, idx: usize) -> RevealReader<'r> {
+        let slice = self.as_slice();
+        let start_idx = molecule::NUMBER_SIZE * (1 + idx);
+        let start = molecule::unpack_number(&slice[start_idx..]) as usize;
+        if idx == self.len() - 1 {
+            RevealReader::new_unchecked(&self.as_slice()[start..])
+        } else {
+            let end_idx = start_idx + molecule::NUMBER_SIZE;
+            let end = molecule::unpack_number(&slice[end_idx..]) as usize;
+            RevealReader::new_unchecked(&self.as_slice()[start..end])
+        }
+    }
+}
+impl<'r> molecule::prelude::Reader<'r> for RevealsReader<'r> {
+    type Entity = Reveals;
+    const NAME: &'static str = "RevealsReader";
+    fn to_entity(&self) -> Self::Entity {
+        Self::Entity::new_unchecked(self.as_slice().to_owned().into())
+    }
+    fn new_unchecked(slice: &'r [u8]) -> Self {
+        RevealsReader(slice)
+    }
+    fn as_slice(&self) -> &'r [u8] {
+        self.0
+    }
+    fn verify(slice: &[u8], compatible: bool) -> molecule::error::VerificationResult<()> {
+        use molecule::verification_error as ve;
+        let slice_len = slice.len();
+        if slice_len < molecule::NUMBER_SIZE {
+            return ve!(Self, HeaderIsBroken, molecule::NUMBER_SIZE, slice_len);
+        }
+        let total_size = molecule::unpack_number(slice) as usize;
+        if slice_len != total_size {
+            return ve!(Self, TotalSizeNotMatch, total_size, slice_len);
+        }
+        if slice_len == molecule::NUMBER_SIZE {
+            return Ok(());
+        }
+        if slice_len < molecule::NUMBER_SIZE * 2 {
+            return ve!(
+                Self,
+                TotalSizeNotMatch,
+                molecule::NUMBER_SIZE * 2,
+                slice_len
+            );
+        }
+        let offset_first = molecule::unpack_number(&slice[molecule::NUMBER_SIZE..]) as usize;
+        if offset_first % molecule::NUMBER_SIZE != 0 || offset_first < molecule::NUMBER_SIZE * 2 {
+            return ve!(Self, OffsetsNotMatch);
+        }
+        if slice_len < offset_first {
+            return ve!(Self, HeaderIsBroken, offset_first, slice_len);
+        }
+        let mut offsets: Vec<usize> = slice[molecule::NUMBER_SIZE..offset_first]
+            .chunks_exact(molecule::NUMBER_SIZE)
+            .map(|x| molecule::unpack_number(x) as usize)
+            .collect();
+        offsets.push(total_size);
+        if offsets.windows(2).any(|i| i[0] > i[1]) {
+            return ve!(Self, OffsetsNotMatch);
+        }
+        for pair in offsets.windows(2) {
+            let start = pair[0];
+            let end = pair[1];
+            RevealReader::verify(&slice[start..end], compatible)?;
+        }
+        Ok(())
+    }
+}
+#[derive(Debug, Default)]
+pub struct RevealsBuilder(pub(crate) Vec<Reveal>);
+impl RevealsBuilder {
+    pub fn set(mut self, v: Vec<Reveal>) -> Self {
+        self.0 = v;
+        self
+    }
+    pub fn push(mut self, v: Reveal) -> Self {
+        self.0.push(v);
+        self
+    }
+    pub fn extend<T: ::core::iter::IntoIterator<Item = Reveal>>(mut self, iter: T) -> Self {
+        for elem in iter {
+            self.0.push(elem);
+        }
+        self
+    }
+}
+impl molecule::prelude::Builder for RevealsBuilder {
+    type Entity = Reveals;
+    const NAME: &'static str = "RevealsBuilder";
+    fn expected_length(&self) -> usize {
+        molecule::NUMBER_SIZE * (self.0.len() + 1)
+            + self
+                .0
+                .iter()
+                .map(|inner| inner.as_slice().len())
+                .sum::<usize>()
+    }
+    fn write<W: ::molecule::io::Write>(&self, writer: &mut W) -> ::molecule::io::Result<()> {
+        let item_count = self.0.len();
+        if item_count == 0 {
+            writer.write_all(&molecule::pack_number(
+                molecule::NUMBER_SIZE as molecule::Number,
+            ))?;
+        } else {
+            let (total_size, offsets) = self.0.iter().fold(
+                (
+                    molecule::NUMBER_SIZE * (item_count + 1),
+                    Vec::with_capacity(item_count),
+                ),
+                |(start, mut offsets), inner| {
+                    offsets.push(start);
+                    (start + inner.as_slice().len(), offsets)
+                },
+            );
+            writer.write_all(&molecule::pack_number(total_size as molecule::Number))?;
+            for offset in offsets.into_iter() {
+                writer.write_all(&molecule::pack_number(offset as molecule::Number))?;
+            }
+            for inner in self.0.iter() {
+                writer.write_all(inner.as_slice())?;
+            }
+        }
+        Ok(())
+    }
+    fn build(&self) -> Self::Entity {
+        let mut inner = Vec::with_capacity(self.expected_length());
+        self.write(&mut inner)
+            .unwrap_or_else(|_| panic!("{} build should be ok", Self::NAME));
+        Reveals::new_unchecked(inner.into())
+    }
+}
+pub struct RevealsIterator(Reveals, usize, usize);
+impl ::core::iter::Iterator for RevealsIterator {
+    type Item = Reveal;
+    fn next(&mut self) -> Option<Self::Item> {
+        if self.1 >= self.2 {
+            None
+        } else {
+            let ret = self.0.get_unchecked(self.1);
+            self.1 += 1;
+            Some(ret)
+        }
+    }
+}
+impl ::core::iter::ExactSizeIterator for RevealsIterator {
+    fn len(&self) -> usize {
+        self.2 - self.1
+    }
+}
+impl ::core::iter::IntoIterator for Reveals {
+    type Item = Reveal;
+    type IntoIter = RevealsIterator;
+    fn into_iter(self) -> Self::IntoIter {
+        let len = self.len();
+        RevealsIterator(self, 0, len)
+    }
+}
+impl<'r> RevealsReader<'r> {
+    pub fn iter<'t>(&'t self) -> RevealsReaderIterator<'t, 'r> {
+        RevealsReaderIterator(&self, 0, self.len())
+    }
+}
+pub struct RevealsReaderIterator<'t, 'r>(&'t RevealsReader<'r>, usize, usize);
+impl<'t: 'r, 'r> ::core::iter::Iterator for RevealsReaderIterator<'t, 'r> {
+    type Item = RevealReader<'t>;
+    fn next(&mut self) -> Option<Self::Item> {
+        if self.1 >= self.2 {
+            None
+        } else {
+            let ret = self.0.get_unchecked(self.1);
+            self.1 += 1;
+            Some(ret)
+        }
+    }
+}
+impl<'t: 'r, 'r> ::core::iter::ExactSizeIterator for RevealsReaderIterator<'t, 'r> {
+    fn len(&self) -> usize {
+        self.2 - self.1
+    }
+}
+#[derive(Clone)]
+pub struct Challenge(molecule::bytes::Bytes);
+impl ::core::fmt::LowerHex for Challenge {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        use molecule::hex_string;
+        if f.alternate() {
+            write!(f, "0x")?;
+        }
+        write!(f, "{}", hex_string(self.as_slice()))
+    }
+}
+impl ::core::fmt::Debug for Challenge {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{}({:#x})", Self::NAME, self)
+    }
+}
+impl ::core::fmt::Display for Challenge {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{} {{ ", Self::NAME)?;
+        write!(f, "{}: {}", "count", self.count())?;
+        write!(f, ", {}: {}", "challenger", self.challenger())?;
+        write!(f, ", {}: {}", "snapshot_position", self.snapshot_position())?;
+        write!(
+            f,
+            ", {}: {}",
+            "snapshot_hashproof",
+            self.snapshot_hashproof()
+        )?;
+        write!(
+            f,
+            ", {}: {}",
+            "snapshot_signature",
+            self.snapshot_signature()
+        )?;
+        write!(f, ", {}: {}", "operations", self.operations())?;
+        let extra_count = self.count_extra_fields();
+        if extra_count != 0 {
+            write!(f, ", .. ({} fields)", extra_count)?;
+        }
+        write!(f, " }}")
+    }
+}
+impl ::core::default::Default for Challenge {
+    fn default() -> Self {
+        let v: Vec<u8> = vec![
+            134, 0, 0, 0, 28, 0, 0, 0, 30, 0, 0, 0, 31, 0, 0, 0, 33, 0, 0, 0, 65, 0, 0, 0, 130, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0,
+        ];
+        Challenge::new_unchecked(v.into())
+    }
+}
+impl Challenge {
+    pub const FIELD_COUNT: usize = 6;
+    pub fn total_size(&self) -> usize {
+        molecule::unpack_number(self.as_slice()) as usize
+    }
+    pub fn field_count(&self) -> usize {
+        if self.total_size() == molecule::NUMBER_SIZE {
+            0
+        } else {
+            (molecule::unpack_number(&self.as_slice()[molecule::NUMBER_SIZE..]) as usize / 4) - 1
+        }
+    }
+    pub fn count_extra_fields(&self) -> usize {
+        self.field_count() - Self::FIELD_COUNT
+    }
+    pub fn has_extra_fields(&self) -> bool {
+        Self::FIELD_COUNT != self.field_count()
+    }
+    pub fn count(&self) -> Uint16T {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[4..]) as usize;
+        let end = molecule::unpack_number(&slice[8..]) as usize;
+        Uint16T::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn challenger(&self) -> Uint8T {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[8..]) as usize;
+        let end = molecule::unpack_number(&slice[12..]) as usize;
+        Uint8T::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn snapshot_position(&self) -> Uint16T {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[12..]) as usize;
+        let end = molecule::unpack_number(&slice[16..]) as usize;
+        Uint16T::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn snapshot_hashproof(&self) -> Blake256 {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[16..]) as usize;
+        let end = molecule::unpack_number(&slice[20..]) as usize;
+        Blake256::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn snapshot_signature(&self) -> Signature {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[20..]) as usize;
+        let end = molecule::unpack_number(&slice[24..]) as usize;
+        Signature::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn operations(&self) -> Operations {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[24..]) as usize;
+        if self.has_extra_fields() {
+            let end = molecule::unpack_number(&slice[28..]) as usize;
+            Operations::new_unchecked(self.0.slice(start..end))
+        } else {
+            Operations::new_unchecked(self.0.slice(start..))
+        }
+    }
+    pub fn as_reader<'r>(&'r self) -> ChallengeReader<'r> {
+        ChallengeReader::new_unchecked(self.as_slice())
+    }
+}
+impl molecule::prelude::Entity for Challenge {
+    type Builder = ChallengeBuilder;
+    const NAME: &'static str = "Challenge";
+    fn new_unchecked(data: molecule::bytes::Bytes) -> Self {
+        Challenge(data)
+    }
+    fn as_bytes(&self) -> molecule::bytes::Bytes {
+        self.0.clone()
+    }
+    fn as_slice(&self) -> &[u8] {
+        &self.0[..]
+    }
+    fn from_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
+        ChallengeReader::from_slice(slice).map(|reader| reader.to_entity())
+    }
+    fn from_compatible_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
+        ChallengeReader::from_compatible_slice(slice).map(|reader| reader.to_entity())
+    }
+    fn new_builder() -> Self::Builder {
+        ::core::default::Default::default()
+    }
+    fn as_builder(self) -> Self::Builder {
+        Self::new_builder()
+            .count(self.count())
+            .challenger(self.challenger())
+            .snapshot_position(self.snapshot_position())
+            .snapshot_hashproof(self.snapshot_hashproof())
+            .snapshot_signature(self.snapshot_signature())
+            .operations(self.operations())
+    }
+}
+#[derive(Clone, Copy)]
+pub struct ChallengeReader<'r>(&'r [u8]);
+impl<'r> ::core::fmt::LowerHex for ChallengeReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        use molecule::hex_string;
+        if f.alternate() {
+            write!(f, "0x")?;
+        }
+        write!(f, "{}", hex_string(self.as_slice()))
+    }
+}
+impl<'r> ::core::fmt::Debug for ChallengeReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{}({:#x})", Self::NAME, self)
+    }
+}
+impl<'r> ::core::fmt::Display for ChallengeReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{} {{ ", Self::NAME)?;
+        write!(f, "{}: {}", "count", self.count())?;
+        write!(f, ", {}: {}", "challenger", self.challenger())?;
+        write!(f, ", {}: {}", "snapshot_position", self.snapshot_position())?;
+        write!(
+            f,
+            ", {}: {}",
+            "snapshot_hashproof",
+            self.snapshot_hashproof()
+        )?;
+        write!(
+            f,
+            ", {}: {}",
+            "snapshot_signature",
+            self.snapshot_signature()
+        )?;
+        write!(f, ", {}: {}", "operations", self.operations())?;
+        let extra_count = self.count_extra_fields();
+        if extra_count != 0 {
+            write!(f, ", .. ({} fields)", extra_count)?;
+        }
+        write!(f, " }}")
+    }
+}
+impl<'r> ChallengeReader<'r> {
+    pub const FIELD_COUNT: usize = 6;
+    pub fn total_size(&self) -> usize {
+        molecule::unpack_number(self.as_slice()) as usize
+    }
+    pub fn field_count(&self) -> usize {
+        if self.total_size() == molecule::NUMBER_SIZE {
+            0
+        } else {
+            (molecule::unpack_number(&self.as_slice()[molecule::NUMBER_SIZE..]) as usize / 4) - 1
+        }
+    }
+    pub fn count_extra_fields(&self) -> usize {
+        self.field_count() - Self::FIELD_COUNT
+    }
+    pub fn has_extra_fields(&self) -> bool {
+        Self::FIELD_COUNT != self.field_count()
+    }
+    pub fn count(&self) -> Uint16TReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[4..]) as usize;
+        let end = molecule::unpack_number(&slice[8..]) as usize;
+        Uint16TReader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn challenger(&self) -> Uint8TReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[8..]) as usize;
+        let end = molecule::unpack_number(&slice[12..]) as usize;
+        Uint8TReader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn snapshot_position(&self) -> Uint16TReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[12..]) as usize;
+        let end = molecule::unpack_number(&slice[16..]) as usize;
+        Uint16TReader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn snapshot_hashproof(&self) -> Blake256Reader<'r> {
+        let slice = self.as_slice();
         let start = molecule::unpack_number(&slice[16..]) as usize;
         let end = molecule::unpack_number(&slice[20..]) as usize;
         Blake256Reader::new_unchecked(&self.as_slice()[start..end])
     }
-    pub fn lua_code_hashes(&self) -> HashesReader<'r> {
-        let slice = self.as_slice();
-        let start = molecule::unpack_number(&slice[20..]) as usize;
-        let end = molecule::unpack_number(&slice[24..]) as usize;
-        HashesReader::new_unchecked(&self.as_slice()[start..end])
+    pub fn snapshot_signature(&self) -> SignatureReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[20..]) as usize;
+        let end = molecule::unpack_number(&slice[24..]) as usize;
+        SignatureReader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn operations(&self) -> OperationsReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[24..]) as usize;
+        if self.has_extra_fields() {
+            let end = molecule::unpack_number(&slice[28..]) as usize;
+            OperationsReader::new_unchecked(&self.as_slice()[start..end])
+        } else {
+            OperationsReader::new_unchecked(&self.as_slice()[start..])
+        }
+    }
+}
+impl<'r> molecule::prelude::Reader<'r> for ChallengeReader<'r> {
+    type Entity = Challenge;
+    const NAME: &'static str = "ChallengeReader";
+    fn to_entity(&self) -> Self::Entity {
+        Self::Entity::new_unchecked(self.as_slice().to_owned().into())
+    }
+    fn new_unchecked(slice: &'r [u8]) -> Self {
+        ChallengeReader(slice)
+    }
+    fn as_slice(&self) -> &'r [u8] {
+        self.0
+    }
+    fn verify(slice: &[u8], compatible: bool) -> molecule::error::VerificationResult<()> {
+        use molecule::verification_error as ve;
+        let slice_len = slice.len();
+        if slice_len < molecule::NUMBER_SIZE {
+            return ve!(Self, HeaderIsBroken, molecule::NUMBER_SIZE, slice_len);
+        }
+        let total_size = molecule::unpack_number(slice) as usize;
+        if slice_len != total_size {
+            return ve!(Self, TotalSizeNotMatch, total_size, slice_len);
+        }
+        if slice_len == molecule::NUMBER_SIZE && Self::FIELD_COUNT == 0 {
+            return Ok(());
+        }
+        if slice_len < molecule::NUMBER_SIZE * 2 {
+            return ve!(Self, HeaderIsBroken, molecule::NUMBER_SIZE * 2, slice_len);
+        }
+        let offset_first = molecule::unpack_number(&slice[molecule::NUMBER_SIZE..]) as usize;
+        if offset_first % molecule::NUMBER_SIZE != 0 || offset_first < molecule::NUMBER_SIZE * 2 {
+            return ve!(Self, OffsetsNotMatch);
+        }
+        if slice_len < offset_first {
+            return ve!(Self, HeaderIsBroken, offset_first, slice_len);
+        }
+        let field_count = offset_first / molecule::NUMBER_SIZE - 1;
+        if field_count < Self::FIELD_COUNT {
+            return ve!(Self, FieldCountNotMatch, Self::FIELD_COUNT, field_count);
+        } else if !compatible && field_count > Self::FIELD_COUNT {
+            return ve!(Self, FieldCountNotMatch, Self::FIELD_COUNT, field_count);
+        };
+        let mut offsets: Vec<usize> = slice[molecule::NUMBER_SIZE..offset_first]
+            .chunks_exact(molecule::NUMBER_SIZE)
+            .map(|x| molecule::unpack_number(x) as usize)
+            .collect();
+        offsets.push(total_size);
+        if offsets.windows(2).any(|i| i[0] > i[1]) {
+            return ve!(Self, OffsetsNotMatch);
+        }
+        Uint16TReader::verify(&slice[offsets[0]..offsets[1]], compatible)?;
+        Uint8TReader::verify(&slice[offsets[1]..offsets[2]], compatible)?;
+        Uint16TReader::verify(&slice[offsets[2]..offsets[3]], compatible)?;
+        Blake256Reader::verify(&slice[offsets[3]..offsets[4]], compatible)?;
+        SignatureReader::verify(&slice[offsets[4]..offsets[5]], compatible)?;
+        OperationsReader::verify(&slice[offsets[5]..offsets[6]], compatible)?;
+        Ok(())
+    }
+}
+#[derive(Debug, Default)]
+pub struct ChallengeBuilder {
+    pub(crate) count: Uint16T,
+    pub(crate) challenger: Uint8T,
+    pub(crate) snapshot_position: Uint16T,
+    pub(crate) snapshot_hashproof: Blake256,
+    pub(crate) snapshot_signature: Signature,
+    pub(crate) operations: Operations,
+}
+impl ChallengeBuilder {
+    pub const FIELD_COUNT: usize = 6;
+    pub fn count(mut self, v: Uint16T) -> Self {
+        self.count = v;
+        self
+    }
+    pub fn challenger(mut self, v: Uint8T) -> Self {
+        self.challenger = v;
+        self
+    }
+    pub fn snapshot_position(mut self, v: Uint16T) -> Self {
+        self.snapshot_position = v;
+        self
+    }
+    pub fn snapshot_hashproof(mut self, v: Blake256) -> Self {
+        self.snapshot_hashproof = v;
+        self
+    }
+    pub fn snapshot_signature(mut self, v: Signature) -> Self {
+        self.snapshot_signature = v;
+        self
+    }
+    pub fn operations(mut self, v: Operations) -> Self {
+        self.operations = v;
+        self
+    }
+}
+impl molecule::prelude::Builder for ChallengeBuilder {
+    type Entity = Challenge;
+    const NAME: &'static str = "ChallengeBuilder";
+    fn expected_length(&self) -> usize {
+        molecule::NUMBER_SIZE * (Self::FIELD_COUNT + 1)
+            + self.count.as_slice().len()
+            + self.challenger.as_slice().len()
+            + self.snapshot_position.as_slice().len()
+            + self.snapshot_hashproof.as_slice().len()
+            + self.snapshot_signature.as_slice().len()
+            + self.operations.as_slice().len()
+    }
+    fn write<W: ::molecule::io::Write>(&self, writer: &mut W) -> ::molecule::io::Result<()> {
+        let mut total_size = molecule::NUMBER_SIZE * (Self::FIELD_COUNT + 1);
+        let mut offsets = Vec::with_capacity(Self::FIELD_COUNT);
+        offsets.push(total_size);
+        total_size += self.count.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.challenger.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.snapshot_position.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.snapshot_hashproof.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.snapshot_signature.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.operations.as_slice().len();
+        writer.write_all(&molecule::pack_number(total_size as molecule::Number))?;
+        for offset in offsets.into_iter() {
+            writer.write_all(&molecule::pack_number(offset as molecule::Number))?;
+        }
+        writer.write_all(self.count.as_slice())?;
+        writer.write_all(self.challenger.as_slice())?;
+        writer.write_all(self.snapshot_position.as_slice())?;
+        writer.write_all(self.snapshot_hashproof.as_slice())?;
+        writer.write_all(self.snapshot_signature.as_slice())?;
+        writer.write_all(self.operations.as_slice())?;
+        Ok(())
+    }
+    fn build(&self) -> Self::Entity {
+        let mut inner = Vec::with_capacity(self.expected_length());
+        self.write(&mut inner)
+            .unwrap_or_else(|_| panic!("{} build should be ok", Self::NAME));
+        Challenge::new_unchecked(inner.into())
+    }
+}
+#[derive(Clone)]
+pub struct Argument(molecule::bytes::Bytes);
+impl ::core::fmt::LowerHex for Argument {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        use molecule::hex_string;
+        if f.alternate() {
+            write!(f, "0x")?;
+        }
+        write!(f, "{}", hex_string(self.as_slice()))
+    }
+}
+impl ::core::fmt::Debug for Argument {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{}({:#x})", Self::NAME, self)
+    }
+}
+impl ::core::fmt::Display for Argument {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{} {{ ", Self::NAME)?;
+        write!(f, "{}: {}", "kind", self.kind())?;
+        write!(f, ", {}: {}", "data", self.data())?;
+        let extra_count = self.count_extra_fields();
+        if extra_count != 0 {
+            write!(f, ", .. ({} fields)", extra_count)?;
+        }
+        write!(f, " }}")
+    }
+}
+impl ::core::default::Default for Argument {
+    fn default() -> Self {
+        let v: Vec<u8> = vec![17, 0, 0, 0, 12, 0, 0, 0, 13, 0, 0, 0, 0, 0, 0, 0, 0];
+        Argument::new_unchecked(v.into())
+    }
+}
+impl Argument {
+    pub const FIELD_COUNT: usize = 2;
+    pub fn total_size(&self) -> usize {
+        molecule::unpack_number(self.as_slice()) as usize
+    }
+    pub fn field_count(&self) -> usize {
+        if self.total_size() == molecule::NUMBER_SIZE {
+            0
+        } else {
+            (molecule::unpack_number(&self.as_slice()[molecule::NUMBER_SIZE..]) as usize / 4) - 1
+        }
+    }
+    pub fn count_extra_fields(&self) -> usize {
+        self.field_count() - Self::FIELD_COUNT
+    }
+    pub fn has_extra_fields(&self) -> bool {
+        Self::FIELD_COUNT != self.field_count()
+    }
+    pub fn kind(&self) -> Uint8T {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[4..]) as usize;
+        let end = molecule::unpack_number(&slice[8..]) as usize;
+        Uint8T::new_unchecked(self.0.slice(start..end))
+    }
+    pub fn data(&self) -> Bytes {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[8..]) as usize;
+        if self.has_extra_fields() {
+            let end = molecule::unpack_number(&slice[12..]) as usize;
+            Bytes::new_unchecked(self.0.slice(start..end))
+        } else {
+            Bytes::new_unchecked(self.0.slice(start..))
+        }
+    }
+    pub fn as_reader<'r>(&'r self) -> ArgumentReader<'r> {
+        ArgumentReader::new_unchecked(self.as_slice())
+    }
+}
+impl molecule::prelude::Entity for Argument {
+    type Builder = ArgumentBuilder;
+    const NAME: &'static str = "Argument";
+    fn new_unchecked(data: molecule::bytes::Bytes) -> Self {
+        Argument(data)
+    }
+    fn as_bytes(&self) -> molecule::bytes::Bytes {
+        self.0.clone()
+    }
+    fn as_slice(&self) -> &[u8] {
+        &self.0[..]
+    }
+    fn from_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
+        ArgumentReader::from_slice(slice).map(|reader| reader.to_entity())
+    }
+    fn from_compatible_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
+        ArgumentReader::from_compatible_slice(slice).map(|reader| reader.to_entity())
+    }
+    fn new_builder() -> Self::Builder {
+        ::core::default::Default::default()
+    }
+    fn as_builder(self) -> Self::Builder {
+        Self::new_builder().kind(self.kind()).data(self.data())
+    }
+}
+#[derive(Clone, Copy)]
+pub struct ArgumentReader<'r>(&'r [u8]);
+impl<'r> ::core::fmt::LowerHex for ArgumentReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        use molecule::hex_string;
+        if f.alternate() {
+            write!(f, "0x")?;
+        }
+        write!(f, "{}", hex_string(self.as_slice()))
+    }
+}
+impl<'r> ::core::fmt::Debug for ArgumentReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{}({:#x})", Self::NAME, self)
+    }
+}
+impl<'r> ::core::fmt::Display for ArgumentReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{} {{ ", Self::NAME)?;
+        write!(f, "{}: {}", "kind", self.kind())?;
+        write!(f, ", {}: {}", "data", self.data())?;
+        let extra_count = self.count_extra_fields();
+        if extra_count != 0 {
+            write!(f, ", .. ({} fields)", extra_count)?;
+        }
+        write!(f, " }}")
+    }
+}
+impl<'r> ArgumentReader<'r> {
+    pub const FIELD_COUNT: usize = 2;
+    pub fn total_size(&self) -> usize {
+        molecule::unpack_number(self.as_slice()) as usize
+    }
+    pub fn field_count(&self) -> usize {
+        if self.total_size() == molecule::NUMBER_SIZE {
+            0
+        } else {
+            (molecule::unpack_number(&self.as_slice()[molecule::NUMBER_SIZE..]) as usize / 4) - 1
+        }
+    }
+    pub fn count_extra_fields(&self) -> usize {
+        self.field_count() - Self::FIELD_COUNT
+    }
+    pub fn has_extra_fields(&self) -> bool {
+        Self::FIELD_COUNT != self.field_count()
+    }
+    pub fn kind(&self) -> Uint8TReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[4..]) as usize;
+        let end = molecule::unpack_number(&slice[8..]) as usize;
+        Uint8TReader::new_unchecked(&self.as_slice()[start..end])
+    }
+    pub fn data(&self) -> BytesReader<'r> {
+        let slice = self.as_slice();
+        let start = molecule::unpack_number(&slice[8..]) as usize;
+        if self.has_extra_fields() {
+            let end = molecule::unpack_number(&slice[12..]) as usize;
+            BytesReader::new_unchecked(&self.as_slice()[start..end])
+        } else {
+            BytesReader::new_unchecked(&self.as_slice()[start..])
+        }
+    }
+}
+impl<'r> molecule::prelude::Reader<'r> for ArgumentReader<'r> {
+    type Entity = Argument;
+    const NAME: &'static str = "ArgumentReader";
+    fn to_entity(&self) -> Self::Entity {
+        Self::Entity::new_unchecked(self.as_slice().to_owned().into())
+    }
+    fn new_unchecked(slice: &'r [u8]) -> Self {
+        ArgumentReader(slice)
+    }
+    fn as_slice(&self) -> &'r [u8] {
+        self.0
+    }
+    fn verify(slice: &[u8], compatible: bool) -> molecule::error::VerificationResult<()> {
+        use molecule::verification_error as ve;
+        let slice_len = slice.len();
+        if slice_len < molecule::NUMBER_SIZE {
+            return ve!(Self, HeaderIsBroken, molecule::NUMBER_SIZE, slice_len);
+        }
+        let total_size = molecule::unpack_number(slice) as usize;
+        if slice_len != total_size {
+            return ve!(Self, TotalSizeNotMatch, total_size, slice_len);
+        }
+        if slice_len == molecule::NUMBER_SIZE && Self::FIELD_COUNT == 0 {
+            return Ok(());
+        }
+        if slice_len < molecule::NUMBER_SIZE * 2 {
+            return ve!(Self, HeaderIsBroken, molecule::NUMBER_SIZE * 2, slice_len);
+        }
+        let offset_first = molecule::unpack_number(&slice[molecule::NUMBER_SIZE..]) as usize;
+        if offset_first % molecule::NUMBER_SIZE != 0 || offset_first < molecule::NUMBER_SIZE * 2 {
+            return ve!(Self, OffsetsNotMatch);
+        }
+        if slice_len < offset_first {
+            return ve!(Self, HeaderIsBroken, offset_first, slice_len);
+        }
+        let field_count = offset_first / molecule::NUMBER_SIZE - 1;
+        if field_count < Self::FIELD_COUNT {
+            return ve!(Self, FieldCountNotMatch, Self::FIELD_COUNT, field_count);
+        } else if !compatible && field_count > Self::FIELD_COUNT {
+            return ve!(Self, FieldCountNotMatch, Self::FIELD_COUNT, field_count);
+        };
+        let mut offsets: Vec<usize> = slice[molecule::NUMBER_SIZE..offset_first]
+            .chunks_exact(molecule::NUMBER_SIZE)
+            .map(|x| molecule::unpack_number(x) as usize)
+            .collect();
+        offsets.push(total_size);
+        if offsets.windows(2).any(|i| i[0] > i[1]) {
+            return ve!(Self, OffsetsNotMatch);
+        }
+        Uint8TReader::verify(&slice[offsets[0]..offsets[1]], compatible)?;
+        BytesReader::verify(&slice[offsets[1]..offsets[2]], compatible)?;
+        Ok(())
+    }
+}
+#[derive(Debug, Default)]
+pub struct ArgumentBuilder {
+    pub(crate) kind: Uint8T,
+    pub(crate) data: Bytes,
+}
+impl ArgumentBuilder {
+    pub const FIELD_COUNT: usize = 2;
+    pub fn kind(mut self, v: Uint8T) -> Self {
+        self.kind = v;
+        self
+    }
+    pub fn data(mut self, v: Bytes) -> Self {
+        self.data = v;
+        self
+    }
+}
+impl molecule::prelude::Builder for ArgumentBuilder {
+    type Entity = Argument;
+    const NAME: &'static str = "ArgumentBuilder";
+    fn expected_length(&self) -> usize {
+        molecule::NUMBER_SIZE * (Self::FIELD_COUNT + 1)
+            + self.kind.as_slice().len()
+            + self.data.as_slice().len()
+    }
+    fn write<W: ::molecule::io::Write>(&self, writer: &mut W) -> ::molecule::io::Result<()> {
+        let mut total_size = molecule::NUMBER_SIZE * (Self::FIELD_COUNT + 1);
+        let mut offsets = Vec::with_capacity(Self::FIELD_COUNT);
+        offsets.push(total_size);
+        total_size += self.kind.as_slice().len();
+        offsets.push(total_size);
+        total_size += self.data.as_slice().len();
+        writer.write_all(&molecule::pack_number(total_size as molecule::Number))?;
+        for offset in offsets.into_iter() {
+            writer.write_all(&molecule::pack_number(offset as molecule::Number))?;
+        }
+        writer.write_all(self.kind.as_slice())?;
+        writer.write_all(self.data.as_slice())?;
+        Ok(())
+    }
+    fn build(&self) -> Self::Entity {
+        let mut inner = Vec::with_capacity(self.expected_length());
+        self.write(&mut inner)
+            .unwrap_or_else(|_| panic!("{} build should be ok", Self::NAME));
+        Argument::new_unchecked(inner.into())
+    }
+}
+#[derive(Clone)]
+pub struct Arguments(molecule::bytes::Bytes);
+impl ::core::fmt::LowerHex for Arguments {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        use molecule::hex_string;
+        if f.alternate() {
+            write!(f, "0x")?;
+        }
+        write!(f, "{}", hex_string(self.as_slice()))
+    }
+}
+impl ::core::fmt::Debug for Arguments {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{}({:#x})", Self::NAME, self)
+    }
+}
+impl ::core::fmt::Display for Arguments {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{} [", Self::NAME)?;
+        for i in 0..self.len() {
+            if i == 0 {
+                write!(f, "{}", self.get_unchecked(i))?;
+            } else {
+                write!(f, ", {}", self.get_unchecked(i))?;
+            }
+        }
+        write!(f, "]")
+    }
+}
+impl ::core::default::Default for Arguments {
+    fn default() -> Self {
+        let v: Vec<u8> = vec![4, 0, 0, 0];
+        Arguments::new_unchecked(v.into())
+    }
+}
+impl Arguments {
+    pub fn total_size(&self) -> usize {
+        molecule::unpack_number(self.as_slice()) as usize
+    }
+    pub fn item_count(&self) -> usize {
+        if self.total_size() == molecule::NUMBER_SIZE {
+            0
+        } else {
+            (molecule::unpack_number(&self.as_slice()[molecule::NUMBER_SIZE..]) as usize / 4) - 1
+        }
+    }
+    pub fn len(&self) -> usize {
+        self.item_count()
+    }
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+    pub fn get(&self, idx: usize) -> Option<Argument> {
+        if idx >= self.len() {
+            None
+        } else {
+            Some(self.get_unchecked(idx))
+        }
+    }
+    pub fn get_unchecked(&self, idx: usize) -> Argument {
+        let slice = self.as_slice();
+        let start_idx = molecule::NUMBER_SIZE * (1 + idx);
+        let start = molecule::unpack_number(&slice[start_idx..]) as usize;
+        if idx == self.len() - 1 {
+            Argument::new_unchecked(self.0.slice(start..))
+        } else {
+            let end_idx = start_idx + molecule::NUMBER_SIZE;
+            let end = molecule::unpack_number(&slice[end_idx..]) as usize;
+            Argument::new_unchecked(self.0.slice(start..end))
+        }
+    }
+    pub fn as_reader<'r>(&'r self) -> ArgumentsReader<'r> {
+        ArgumentsReader::new_unchecked(self.as_slice())
+    }
+}
+impl molecule::prelude::Entity for Arguments {
+    type Builder = ArgumentsBuilder;
+    const NAME: &'static str = "Arguments";
+    fn new_unchecked(data: molecule::bytes::Bytes) -> Self {
+        Arguments(data)
+    }
+    fn as_bytes(&self) -> molecule::bytes::Bytes {
+        self.0.clone()
+    }
+    fn as_slice(&self) -> &[u8] {
+        &self.0[..]
+    }
+    fn from_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
+        ArgumentsReader::from_slice(slice).map(|reader| reader.to_entity())
+    }
+    fn from_compatible_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
+        ArgumentsReader::from_compatible_slice(slice).map(|reader| reader.to_entity())
+    }
+    fn new_builder() -> Self::Builder {
+        ::core::default::Default::default()
+    }
+    fn as_builder(self) -> Self::Builder {
+        Self::new_builder().extend(self.into_iter())
+    }
+}
+#[derive(Clone, Copy)]
+pub struct ArgumentsReader<'r>(&'r [u8]);
+impl<'r> ::core::fmt::LowerHex for ArgumentsReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        use molecule::hex_string;
+        if f.alternate() {
+            write!(f, "0x")?;
+        }
+        write!(f, "{}", hex_string(self.as_slice()))
+    }
+}
+impl<'r> ::core::fmt::Debug for ArgumentsReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{}({:#x})", Self::NAME, self)
+    }
+}
+impl<'r> ::core::fmt::Display for ArgumentsReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{} [", Self::NAME)?;
+        for i in 0..self.len() {
+            if i == 0 {
+                write!(f, "{}", self.get_unchecked(i))?;
+            } else {
+                write!(f, ", {}", self.get_unchecked(i))?;
+            }
+        }
+        write!(f, "]")
+    }
+}
+impl<'r> ArgumentsReader<'r> {
+    pub fn total_size(&self) -> usize {
+        molecule::unpack_number(self.as_slice()) as usize
+    }
+    pub fn item_count(&self) -> usize {
+        if self.total_size() == molecule::NUMBER_SIZE {
+            0
+        } else {
+            (molecule::unpack_number(&self.as_slice()[molecule::NUMBER_SIZE..]) as usize / 4) - 1
+        }
+    }
+    pub fn len(&self) -> usize {
+        self.item_count()
+    }
+    pub fn is_empty(&self) -> bool {
+        self.len() == 0
+    }
+    pub fn get(&self, idx: usize) -> Option<ArgumentReader<'r>> {
+        if idx >= self.len() {
+            None
+        } else {
+            Some(self.get_unchecked(idx))
+        }
+    }
+    pub fn get_unchecked(&self, idx: usize) -> ArgumentReader<'r> {
+        let slice = self.as_slice();
+        let start_idx = molecule::NUMBER_SIZE * (1 + idx);
+        let start = molecule::unpack_number(&slice[start_idx..]) as usize;
+        if idx == self.len() - 1 {
+            ArgumentReader::new_unchecked(&self.as_slice()[start..])
+        } else {
+            let end_idx = start_idx + molecule::NUMBER_SIZE;
+            let end = molecule::unpack_number(&slice[end_idx..]) as usize;
+            ArgumentReader::new_unchecked(&self.as_slice()[start..end])
+        }
+    }
+}
+impl<'r> molecule::prelude::Reader<'r> for ArgumentsReader<'r> {
+    type Entity = Arguments;
+    const NAME: &'static str = "ArgumentsReader";
+    fn to_entity(&self) -> Self::Entity {
+        Self::Entity::new_unchecked(self.as_slice().to_owned().into())
+    }
+    fn new_unchecked(slice: &'r [u8]) -> Self {
+        ArgumentsReader(slice)
+    }
+    fn as_slice(&self) -> &'r [u8] {
+        self.0
+    }
+    fn verify(slice: &[u8], compatible: bool) -> molecule::error::VerificationResult<()> {
+        use molecule::verification_error as ve;
+        let slice_len = slice.len();
+        if slice_len < molecule::NUMBER_SIZE {
+            return ve!(Self, HeaderIsBroken, molecule::NUMBER_SIZE, slice_len);
+        }
+        let total_size = molecule::unpack_number(slice) as usize;
+        if slice_len != total_size {
+            return ve!(Self, TotalSizeNotMatch, total_size, slice_len);
+        }
+        if slice_len == molecule::NUMBER_SIZE {
+            return Ok(());
+        }
+        if slice_len < molecule::NUMBER_SIZE * 2 {
+            return ve!(
+                Self,
+                TotalSizeNotMatch,
+                molecule::NUMBER_SIZE * 2,
+                slice_len
+            );
+        }
+        let offset_first = molecule::unpack_number(&slice[molecule::NUMBER_SIZE..]) as usize;
+        if offset_first % molecule::NUMBER_SIZE != 0 || offset_first < molecule::NUMBER_SIZE * 2 {
+            return ve!(Self, OffsetsNotMatch);
+        }
+        if slice_len < offset_first {
+            return ve!(Self, HeaderIsBroken, offset_first, slice_len);
+        }
+        let mut offsets: Vec<usize> = slice[molecule::NUMBER_SIZE..offset_first]
+            .chunks_exact(molecule::NUMBER_SIZE)
+            .map(|x| molecule::unpack_number(x) as usize)
+            .collect();
+        offsets.push(total_size);
+        if offsets.windows(2).any(|i| i[0] > i[1]) {
+            return ve!(Self, OffsetsNotMatch);
+        }
+        for pair in offsets.windows(2) {
+            let start = pair[0];
+            let end = pair[1];
+            ArgumentReader::verify(&slice[start..end], compatible)?;
+        }
+        Ok(())
+    }
+}
+#[derive(Debug, Default)]
+pub struct ArgumentsBuilder(pub(crate) Vec<Argument>);
+impl ArgumentsBuilder {
+    pub fn set(mut self, v: Vec<Argument>) -> Self {
+        self.0 = v;
+        self
     }
-    pub fn user1_pkhash(&self) -> Blake160Reader<'r> {
+    pub fn push(mut self, v: Argument) -> Self {
+        self.0.push(v);
+        self
+    }
+    pub fn extend<T: ::core::iter::IntoIterator<Item = Argument>>(mut self, iter: T) -> Self {
+        for elem in iter {
+            self.0.push(elem);
+        }
+        self
+    }
+}
+impl molecule::prelude::Builder for ArgumentsBuilder {
+    type Entity = Arguments;
+    const NAME: &'static str = "ArgumentsBuilder";
+    fn expected_length(&self) -> usize {
+        molecule::NUMBER_SIZE * (self.0.len() + 1)
+            + self
+                .0
+                .iter()
+                .map(|inner| inner.as_slice().len())
+                .sum::<usize>()
+    }
+    fn write<W: ::molecule::io::Write>(&self, writer: &mut W) -> ::molecule::io::Result<()> {
+        let item_count = self.0.len();
+        if item_count == 0 {
+            writer.write_all(&molecule::pack_number(
+                molecule::NUMBER_SIZE as molecule::Number,
+            ))?;
+        } else {
+            let (total_size, offsets) = self.0.iter().fold(
+                (
+                    molecule::NUMBER_SIZE * (item_count + 1),
+                    Vec::with_capacity(item_count),
+                ),
+                |(start, mut offsets), inner| {
+                    offsets.push(start);
+                    (start + inner.as_slice().len(), offsets)
+                },
+            );
+            writer.write_all(&molecule::pack_number(total_size as molecule::Number))?;
+            for offset in offsets.into_iter() {
+                writer.write_all(&molecule::pack_number(offset as molecule::Number))?;
+            }
+            for inner in self.0.iter() {
+                writer.write_all(inner.as_slice())?;
+            }
+        }
+        Ok(())
+    }
+    fn build(&self) -> Self::Entity {
+        let mut inner = Vec::with_capacity(self.expected_length());
+        self.write(&mut inner)
+            .unwrap_or_else(|_| panic!("{} build should be ok", Self::NAME));
+        Arguments::new_unchecked(inner.into())
+    }
+}
+pub struct ArgumentsIterator(Arguments, usize, usize);
+impl ::core::iter::Iterator for ArgumentsIterator {
+    type Item = Argument;
+    fn next(&mut self) -> Option<Self::Item> {
+        if self.1 >= self.2 {
+            None
+        } else {
+            let ret = self.0.get_unchecked(self.1);
+            self.1 += 1;
+            Some(ret)
+        }
+    }
+}
+impl ::core::iter::ExactSizeIterator for ArgumentsIterator {
+    fn len(&self) -> usize {
+        self.2 - self.1
+    }
+}
+impl ::core::iter::IntoIterator for Arguments {
+    type Item = Argument;
+    type IntoIter = ArgumentsIterator;
+    fn into_iter(self) -> Self::IntoIter {
+        let len = self.len();
+        ArgumentsIterator(self, 0, len)
+    }
+}
+impl<'r> ArgumentsReader<'r> {
+    pub fn iter<'t>(&'t self) -> ArgumentsReaderIterator<'t, 'r> {
+        ArgumentsReaderIterator(&self, 0, self.len())
+    }
+}
+pub struct ArgumentsReaderIterator<'t, 'r>(&'t ArgumentsReader<'r>, usize, usize);
+impl<'t: 'r, 'r> ::core::iter::Iterator for ArgumentsReaderIterator<'t, 'r> {
+    type Item = ArgumentReader<'t>;
+    fn next(&mut self) -> Option<Self::Item> {
+        if self.1 >= self.2 {
+            None
+        } else {
+            let ret = self.0.get_unchecked(self.1);
+            self.1 += 1;
+            Some(ret)
+        }
+    }
+}
+impl<'t: 'r, 'r> ::core::iter::ExactSizeIterator for ArgumentsReaderIterator<'t, 'r> {
+    fn len(&self) -> usize {
+        self.2 - self.1
+    }
+}
+#[derive(Clone)]
+pub struct Call(molecule::bytes::Bytes);
+impl ::core::fmt::LowerHex for Call {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        use molecule::hex_string;
+        if f.alternate() {
+            write!(f, "0x")?;
+        }
+        write!(f, "{}", hex_string(self.as_slice()))
+    }
+}
+impl ::core::fmt::Debug for Call {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{}({:#x})", Self::NAME, self)
+    }
+}
+impl ::core::fmt::Display for Call {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{} {{ ", Self::NAME)?;
+        write!(f, "{}: {}", "function_id", self.function_id())?;
+        write!(f, ", {}: {}", "arguments", self.arguments())?;
+        let extra_count = self.count_extra_fields();
+        if extra_count != 0 {
+            write!(f, ", .. ({} fields)", extra_count)?;
+        }
+        write!(f, " }}")
+    }
+}
+impl ::core::default::Default for Call {
+    fn default() -> Self {
+        let v: Vec<u8> = vec![18, 0, 0, 0, 12, 0, 0, 0, 14, 0, 0, 0, 0, 0, 4, 0, 0, 0];
+        Call::new_unchecked(v.into())
+    }
+}
+impl Call {
+    pub const FIELD_COUNT: usize = 2;
+    pub fn total_size(&self) -> usize {
+        molecule::unpack_number(self.as_slice()) as usize
+    }
+    pub fn field_count(&self) -> usize {
+        if self.total_size() == molecule::NUMBER_SIZE {
+            0
+        } else {
+            (molecule::unpack_number(&self.as_slice()[molecule::NUMBER_SIZE..]) as usize / 4) - 1
+        }
+    }
+    pub fn count_extra_fields(&self) -> usize {
+        self.field_count() - Self::FIELD_COUNT
+    }
+    pub fn has_extra_fields(&self) -> bool {
+        Self::FIELD_COUNT != self.field_count()
+    }
+    pub fn function_id(&self) -> Uint16T {
         let slice = self.as_slice();
-        let start = molecule::unpack_number(&slice[24..]) as usize;
-        let end = molecule::unpack_number(&slice[28..]) as usize;
-        Blake160Reader::new_unchecked(&self.as_slice()[start..end])
+        let start = molecule::unpack_number(&slice[4..]) as usize;
+        let end = molecule::unpack_number(&slice[8..]) as usize;
+        Uint16T::new_unchecked(self.0.slice(start..end))
     }
-    pub fn user1_nfts(&self) -> NftsReader<'r> {
+    pub fn arguments(&self) -> Arguments {
         let slice = self.as_slice();
-        let start = molecule::unpack_number(&slice[28..]) as usize;
-        let end = molecule::unpack_number(&slice[32..]) as usize;
-        NftsReader::new_unchecked(&self.as_slice()[start..end])
+        let start = molecule::unpack_number(&slice[8..]) as usize;
+        if self.has_extra_fields() {
+            let end = molecule::unpack_number(&slice[12..]) as usize;
+            Arguments::new_unchecked(self.0.slice(start..end))
+        } else {
+            Arguments::new_unchecked(self.0.slice(start..))
+        }
     }
-    pub fn user2_pkhash(&self) -> Blake160Reader<'r> {
+    pub fn as_reader<'r>(&'r self) -> CallReader<'r> {
+        CallReader::new_unchecked(self.as_slice())
+    }
+}
+impl molecule::prelude::Entity for Call {
+    type Builder = CallBuilder;
+    const NAME: &'static str = "Call";
+    fn new_unchecked(data: molecule::bytes::Bytes) -> Self {
+        Call(data)
+    }
+    fn as_bytes(&self) -> molecule::bytes::Bytes {
+        self.0.clone()
+    }
+    fn as_slice(&self) -> &[u8] {
+        &self.0[..]
+    }
+    fn from_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
+        CallReader::from_slice(slice).map(|reader| reader.to_entity())
+    }
+    fn from_compatible_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
+        CallReader::from_compatible_slice(slice).map(|reader| reader.to_entity())
+    }
+    fn new_builder() -> Self::Builder {
+        ::core::default::Default::default()
+    }
+    fn as_builder(self) -> Self::Builder {
+        Self::new_builder()
+            .function_id(self.function_id())
+            .arguments(self.arguments())
+    }
+}
+#[derive(Clone, Copy)]
+pub struct CallReader<'r>(&'r [u8]);
+impl<'r> ::core::fmt::LowerHex for CallReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        use molecule::hex_string;
+        if f.alternate() {
+            write!(f, "0x")?;
+        }
+        write!(f, "{}", hex_string(self.as_slice()))
+    }
+}
+impl<'r> ::core::fmt::Debug for CallReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{}({:#x})", Self::NAME, self)
+    }
+}
+impl<'r> ::core::fmt::Display for CallReader<'r> {
+    fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
+        write!(f, "{} {{ ", Self::NAME)?;
+        write!(f, "{}: {}", "function_id", self.function_id())?;
+        write!(f, ", {}: {}", "arguments", self.arguments())?;
+        let extra_count = self.count_extra_fields();
+        if extra_count != 0 {
+            write!(f, ", .. ({} fields)", extra_count)?;
+        }
+        write!(f, " }}")
+    }
+}
+impl<'r> CallReader<'r> {
+    pub const FIELD_COUNT: usize = 2;
+    pub fn total_size(&self) -> usize {
+        molecule::unpack_number(self.as_slice()) as usize
+    }
+    pub fn field_count(&self) -> usize {
+        if self.total_size() == molecule::NUMBER_SIZE {
+            0
+        } else {
+            (molecule::unpack_number(&self.as_slice()[molecule::NUMBER_SIZE..]) as usize / 4) - 1
+        }
+    }
+    pub fn count_extra_fields(&self) -> usize {
+        self.field_count() - Self::FIELD_COUNT
+    }
+    pub fn has_extra_fields(&self) -> bool {
+        Self::FIELD_COUNT != self.field_count()
+    }
+    pub fn function_id(&self) -> Uint16TReader<'r> {
         let slice = self.as_slice();
-        let start = molecule::unpack_number(&slice[32..]) as usize;
-        let end = molecule::unpack_number(&slice[36..]) as usize;
-        Blake160Reader::new_unchecked(&self.as_slice()[start..end])
+        let start = molecule::unpack_number(&slice[4..]) as usize;
+        let end = molecule::unpack_number(&slice[8..]) as usize;
+        Uint16TReader::new_unchecked(&self.as_slice()[start..end])
     }
-    pub fn user2_nfts(&self) -> NftsReader<'r> {
+    pub fn arguments(&self) -> ArgumentsReader<'r> {
         let slice = self.as_slice();
-        let start = molecule::unpack_number(&slice[36..]) as usize;
+        let start = molecule::unpack_number(&slice[8..]) as usize;
         if self.has_extra_fields() {
-            let end = molecule::unpack_number(&slice[40..]) as usize;
-            NftsReader::new_unchecked(&self.as_slice()[start..end])
+            let end = molecule::unpack_number(&slice[12..]) as usize;
+            ArgumentsReader::new_unchecked(&self.as_slice()[start..end])
         } else {
-            NftsReader::new_unchecked(&self.as_slice()[start..])
+            ArgumentsReader::new_unchecked(&self.as_slice()[start..])
         }
     }
 }
-impl<'r> molecule::prelude::Reader<'r> for ArgsReader<'r> {
-    type Entity = Args;
-    const NAME: &'static str = "ArgsReader";
+impl<'r> molecule::prelude::Reader<'r> for CallReader<'r> {
+    type Entity = Call;
+    const NAME: &'static str = "CallReader";
     fn to_entity(&self) -> Self::Entity {
         Self::Entity::new_unchecked(self.as_slice().to_owned().into())
     }
     fn new_unchecked(slice: &'r [u8]) -> Self {
-        ArgsReader(slice)
+        CallReader(slice)
     }
     fn as_slice(&self) -> &'r [u8] {
         self.0
@@ -4106,130 +7759,60 @@ impl<'r> molecule::prelude::Reader<'r> for ArgsReader<'r> {
         if offsets.windows(2).any(|i| i[0] > i[1]) {
             return ve!(Self, OffsetsNotMatch);
         }
-        Uint64TReader::verify(&slice[offsets[0]..offsets[1]], compatible)?;
-        Uint8TReader::verify(&slice[offsets[1]..offsets[2]], compatible)?;
-        Uint64TReader::verify(&slice[offsets[2]..offsets[3]], compatible)?;
-        Blake256Reader::verify(&slice[offsets[3]..offsets[4]], compatible)?;
-        HashesReader::verify(&slice[offsets[4]..offsets[5]], compatible)?;
-        Blake160Reader::verify(&slice[offsets[5]..offsets[6]], compatible)?;
-        NftsReader::verify(&slice[offsets[6]..offsets[7]], compatible)?;
-        Blake160Reader::verify(&slice[offsets[7]..offsets[8]], compatible)?;
-        NftsReader::verify(&slice[offsets[8]..offsets[9]], compatible)?;
+        Uint16TReader::verify(&slice[offsets[0]..offsets[1]], compatible)?;
+        ArgumentsReader::verify(&slice[offsets[1]..offsets[2]], compatible)?;
         Ok(())
     }
 }
 #[derive(Debug, Default)]
-pub struct ArgsBuilder {
-    pub(crate) user_staking_ckb: Uint64T,
-    pub(crate) user_deck_size: Uint8T,
-    pub(crate) begin_blocknumber: Uint64T,
-    pub(crate) lock_code_hash: Blake256,
-    pub(crate) lua_code_hashes: Hashes,
-    pub(crate) user1_pkhash: Blake160,
-    pub(crate) user1_nfts: Nfts,
-    pub(crate) user2_pkhash: Blake160,
-    pub(crate) user2_nfts: Nfts,
+pub struct CallBuilder {
+    pub(crate) function_id: Uint16T,
+    pub(crate) arguments: Arguments,
 }
-impl ArgsBuilder {
-    pub const FIELD_COUNT: usize = 9;
-    pub fn user_staking_ckb(mut self, v: Uint64T) -> Self {
-        self.user_staking_ckb = v;
-        self
-    }
-    pub fn user_deck_size(mut self, v: Uint8T) -> Self {
-        self.user_deck_size = v;
-        self
-    }
-    pub fn begin_blocknumber(mut self, v: Uint64T) -> Self {
-        self.begin_blocknumber = v;
-        self
-    }
-    pub fn lock_code_hash(mut self, v: Blake256) -> Self {
-        self.lock_code_hash = v;
-        self
-    }
-    pub fn lua_code_hashes(mut self, v: Hashes) -> Self {
-        self.lua_code_hashes = v;
-        self
-    }
-    pub fn user1_pkhash(mut self, v: Blake160) -> Self {
-        self.user1_pkhash = v;
-        self
-    }
-    pub fn user1_nfts(mut self, v: Nfts) -> Self {
-        self.user1_nfts = v;
-        self
-    }
-    pub fn user2_pkhash(mut self, v: Blake160) -> Self {
-        self.user2_pkhash = v;
+impl CallBuilder {
+    pub const FIELD_COUNT: usize = 2;
+    pub fn function_id(mut self, v: Uint16T) -> Self {
+        self.function_id = v;
         self
     }
-    pub fn user2_nfts(mut self, v: Nfts) -> Self {
-        self.user2_nfts = v;
+    pub fn arguments(mut self, v: Arguments) -> Self {
+        self.arguments = v;
         self
     }
 }
-impl molecule::prelude::Builder for ArgsBuilder {
-    type Entity = Args;
-    const NAME: &'static str = "ArgsBuilder";
+impl molecule::prelude::Builder for CallBuilder {
+    type Entity = Call;
+    const NAME: &'static str = "CallBuilder";
     fn expected_length(&self) -> usize {
         molecule::NUMBER_SIZE * (Self::FIELD_COUNT + 1)
-            + self.user_staking_ckb.as_slice().len()
-            + self.user_deck_size.as_slice().len()
-            + self.begin_blocknumber.as_slice().len()
-            + self.lock_code_hash.as_slice().len()
-            + self.lua_code_hashes.as_slice().len()
-            + self.user1_pkhash.as_slice().len()
-            + self.user1_nfts.as_slice().len()
-            + self.user2_pkhash.as_slice().len()
-            + self.user2_nfts.as_slice().len()
+            + self.function_id.as_slice().len()
+            + self.arguments.as_slice().len()
     }
     fn write<W: ::molecule::io::Write>(&self, writer: &mut W) -> ::molecule::io::Result<()> {
         let mut total_size = molecule::NUMBER_SIZE * (Self::FIELD_COUNT + 1);
         let mut offsets = Vec::with_capacity(Self::FIELD_COUNT);
         offsets.push(total_size);
-        total_size += self.user_staking_ckb.as_slice().len();
-        offsets.push(total_size);
-        total_size += self.user_deck_size.as_slice().len();
-        offsets.push(total_size);
-        total_size += self.begin_blocknumber.as_slice().len();
-        offsets.push(total_size);
-        total_size += self.lock_code_hash.as_slice().len();
-        offsets.push(total_size);
-        total_size += self.lua_code_hashes.as_slice().len();
-        offsets.push(total_size);
-        total_size += self.user1_pkhash.as_slice().len();
-        offsets.push(total_size);
-        total_size += self.user1_nfts.as_slice().len();
-        offsets.push(total_size);
-        total_size += self.user2_pkhash.as_slice().len();
+        total_size += self.function_id.as_slice().len();
         offsets.push(total_size);
-        total_size += self.user2_nfts.as_slice().len();
+        total_size += self.arguments.as_slice().len();
         writer.write_all(&molecule::pack_number(total_size as molecule::Number))?;
         for offset in offsets.into_iter() {
             writer.write_all(&molecule::pack_number(offset as molecule::Number))?;
         }
-        writer.write_all(self.user_staking_ckb.as_slice())?;
-        writer.write_all(self.user_deck_size.as_slice())?;
-        writer.write_all(self.begin_blocknumber.as_slice())?;
-        writer.write_all(self.lock_code_hash.as_slice())?;
-        writer.write_all(self.lua_code_hashes.as_slice())?;
-        writer.write_all(self.user1_pkhash.as_slice())?;
-        writer.write_all(self.user1_nfts.as_slice())?;
-        writer.write_all(self.user2_pkhash.as_slice())?;
-        writer.write_all(self.user2_nfts.as_slice())?;
+        writer.write_all(self.function_id.as_slice())?;
+        writer.write_all(self.arguments.as_slice())?;
         Ok(())
     }
     fn build(&self) -> Self::Entity {
         let mut inner = Vec::with_capacity(self.expected_length());
         self.write(&mut inner)
             .unwrap_or_else(|_| panic!("{} build should be ok", Self::NAME));
-        Args::new_unchecked(inner.into())
+        Call::new_unchecked(inner.into())
     }
 }
 #[derive(Clone)]
-pub struct Challenge(molecule::bytes::Bytes);
-impl ::core::fmt::LowerHex for Challenge {
+pub struct RoundLayout(molecule::bytes::Bytes);
+impl ::core::fmt::LowerHex for RoundLayout {
     fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
         use molecule::hex_string;
         if f.alternate() {
@@ -4238,30 +7821,18 @@ impl ::core::fmt::LowerHex for Challenge {
         write!(f, "{}", hex_string(self.as_slice()))
     }
 }
-impl ::core::fmt::Debug for Challenge {
+impl ::core::fmt::Debug for RoundLayout {
     fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
         write!(f, "{}({:#x})", Self::NAME, self)
     }
 }
-impl ::core::fmt::Display for Challenge {
+impl ::core::fmt::Display for RoundLayout {
     fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
         write!(f, "{} {{ ", Self::NAME)?;
-        write!(f, "{}: {}", "count", self.count())?;
-        write!(f, ", {}: {}", "challenger", self.challenger())?;
-        write!(f, ", {}: {}", "snapshot_position", self.snapshot_position())?;
-        write!(
-            f,
-            ", {}: {}",
-            "snapshot_hashproof",
-            self.snapshot_hashproof()
-        )?;
-        write!(
-            f,
-            ", {}: {}",
-            "snapshot_signature",
-            self.snapshot_signature()
-        )?;
-        write!(f, ", {}: {}", "operations", self.operations())?;
+        write!(f, "{}: {}", "offset", self.offset())?;
+        write!(f, ", {}: {}", "count", self.count())?;
+        write!(f, ", {}: {}", "user1_output", self.user1_output())?;
+        write!(f, ", {}: {}", "user2_output", self.user2_output())?;
         let extra_count = self.count_extra_fields();
         if extra_count != 0 {
             write!(f, ", .. ({} fields)", extra_count)?;
@@ -4269,20 +7840,16 @@ impl ::core::fmt::Display for Challenge {
         write!(f, " }}")
     }
 }
-impl ::core::default::Default for Challenge {
+impl ::core::default::Default for RoundLayout {
     fn default() -> Self {
         let v: Vec<u8> = vec![
-            132, 0, 0, 0, 28, 0, 0, 0, 29, 0, 0, 0, 30, 0, 0, 0, 31, 0, 0, 0, 63, 0, 0, 0, 128, 0,
-            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
-            0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0,
+            28, 0, 0, 0, 20, 0, 0, 0, 22, 0, 0, 0, 24, 0, 0, 0, 26, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
         ];
-        Challenge::new_unchecked(v.into())
+        RoundLayout::new_unchecked(v.into())
     }
 }
-impl Challenge {
-    pub const FIELD_COUNT: usize = 6;
+impl RoundLayout {
+    pub const FIELD_COUNT: usize = 4;
     pub fn total_size(&self) -> usize {
         molecule::unpack_number(self.as_slice()) as usize
     }
@@ -4299,55 +7866,43 @@ impl Challenge {
     pub fn has_extra_fields(&self) -> bool {
         Self::FIELD_COUNT != self.field_count()
     }
-    pub fn count(&self) -> Uint8T {
+    pub fn offset(&self) -> Uint16T {
         let slice = self.as_slice();
         let start = molecule::unpack_number(&slice[4..]) as usize;
         let end = molecule::unpack_number(&slice[8..]) as usize;
-        Uint8T::new_unchecked(self.0.slice(start..end))
+        Uint16T::new_unchecked(self.0.slice(start..end))
     }
-    pub fn challenger(&self) -> Uint8T {
+    pub fn count(&self) -> Uint16T {
         let slice = self.as_slice();
         let start = molecule::unpack_number(&slice[8..]) as usize;
         let end = molecule::unpack_number(&slice[12..]) as usize;
-        Uint8T::new_unchecked(self.0.slice(start..end))
+        Uint16T::new_unchecked(self.0.slice(start..end))
     }
-    pub fn snapshot_position(&self) -> Uint8T {
+    pub fn user1_output(&self) -> Uint16T {
         let slice = self.as_slice();
         let start = molecule::unpack_number(&slice[12..]) as usize;
         let end = molecule::unpack_number(&slice[16..]) as usize;
-        Uint8T::new_unchecked(self.0.slice(start..end))
+        Uint16T::new_unchecked(self.0.slice(start..end))
     }
-    pub fn snapshot_hashproof(&self) -> Blake256 {
+    pub fn user2_output(&self) -> Uint16T {
         let slice = self.as_slice();
         let start = molecule::unpack_number(&slice[16..]) as usize;
-        let end = molecule::unpack_number(&slice[20..]) as usize;
-        Blake256::new_unchecked(self.0.slice(start..end))
-    }
-    pub fn snapshot_signature(&self) -> Signature {
-        let slice = self.as_slice();
-        let start = molecule::unpack_number(&slice[20..]) as usize;
-        let end = molecule::unpack_number(&slice[24..]) as usize;
-        Signature::new_unchecked(self.0.slice(start..end))
-    }
-    pub fn operations(&self) -> Operations {
-        let slice = self.as_slice();
-        let start = molecule::unpack_number(&slice[24..]) as usize;
         if self.has_extra_fields() {
-            let end = molecule::unpack_number(&slice[28..]) as usize;
-            Operations::new_unchecked(self.0.slice(start..end))
+            let end = molecule::unpack_number(&slice[20..]) as usize;
+            Uint16T::new_unchecked(self.0.slice(start..end))
         } else {
-            Operations::new_unchecked(self.0.slice(start..))
+            Uint16T::new_unchecked(self.0.slice(start..))
         }
     }
-    pub fn as_reader<'r>(&'r self) -> ChallengeReader<'r> {
-        ChallengeReader::new_unchecked(self.as_slice())
+    pub fn as_reader<'r>(&'r self) -> RoundLayoutReader<'r> {
+        RoundLayoutReader::new_unchecked(self.as_slice())
     }
 }
-impl molecule::prelude::Entity for Challenge {
-    type Builder = ChallengeBuilder;
-    const NAME: &'static str = "Challenge";
+impl molecule::prelude::Entity for RoundLayout {
+    type Builder = RoundLayoutBuilder;
+    const NAME: &'static str = "RoundLayout";
     fn new_unchecked(data: molecule::bytes::Bytes) -> Self {
-        Challenge(data)
+        RoundLayout(data)
     }
     fn as_bytes(&self) -> molecule::bytes::Bytes {
         self.0.clone()
@@ -4356,27 +7911,25 @@ impl molecule::prelude::Entity for Challenge {
         &self.0[..]
     }
     fn from_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
-        ChallengeReader::from_slice(slice).map(|reader| reader.to_entity())
+        RoundLayoutReader::from_slice(slice).map(|reader| reader.to_entity())
     }
     fn from_compatible_slice(slice: &[u8]) -> molecule::error::VerificationResult<Self> {
-        ChallengeReader::from_compatible_slice(slice).map(|reader| reader.to_entity())
+        RoundLayoutReader::from_compatible_slice(slice).map(|reader| reader.to_entity())
     }
     fn new_builder() -> Self::Builder {
         ::core::default::Default::default()
     }
     fn as_builder(self) -> Self::Builder {
         Self::new_builder()
+            .offset(self.offset())
             .count(self.count())
-            .challenger(self.challenger())
-            .snapshot_position(self.snapshot_position())
-            .snapshot_hashproof(self.snapshot_hashproof())
-            .snapshot_signature(self.snapshot_signature())
-            .operations(self.operations())
+            .user1_output(self.user1_output())
+            .user2_output(self.user2_output())
     }
 }
 #[derive(Clone, Copy)]
-pub struct ChallengeReader<'r>(&'r [u8]);
-impl<'r> ::core::fmt::LowerHex for ChallengeReader<'r> {
+pub struct RoundLayoutReader<'r>(&'r [u8]);
+impl<'r> ::core::fmt::LowerHex for RoundLayoutReader<'r> {
     fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
         use molecule::hex_string;
         if f.alternate() {
@@ -4385,30 +7938,18 @@ impl<'r> ::core::fmt::LowerHex for ChallengeReader<'r> {
         write!(f, "{}", hex_string(self.as_slice()))
     }
 }
-impl<'r> ::core::fmt::Debug for ChallengeReader<'r> {
+impl<'r> ::core::fmt::Debug for RoundLayoutReader<'r> {
     fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
         write!(f, "{}({:#x})", Self::NAME, self)
     }
 }
-impl<'r> ::core::fmt::Display for ChallengeReader<'r> {
+impl<'r> ::core::fmt::Display for RoundLayoutReader<'r> {
     fn fmt(&self, f: &mut ::core::fmt::Formatter) -> ::core::fmt::Result {
         write!(f, "{} {{ ", Self::NAME)?;
-        write!(f, "{}: {}", "count", self.count())?;
-        write!(f, ", {}: {}", "challenger", self.challenger())?;
-        write!(f, ", {}: {}", "snapshot_position", self.snapshot_position())?;
-        write!(
-            f,
-            ", {}: {}",
-            "snapshot_hashproof",
-            self.snapshot_hashproof()
-        )?;
-        write!(
-            f,
-            ", {}: {}",
-            "snapshot_signature",
-            self.snapshot_signature()
-        )?;
-        write!(f, ", {}: {}", "operations", self.operations())?;
+        write!(f, "{}: {}", "offset", self.offset())?;
+        write!(f, ", {}: {}", "count", self.count())?;
+        write!(f, ", {}: {}", "user1_output", self.user1_output())?;
+        write!(f, ", {}: {}", "user2_output", self.user2_output())?;
         let extra_count = self.count_extra_fields();
         if extra_count != 0 {
             write!(f, ", .. ({} fields)", extra_count)?;
@@ -4416,8 +7957,8 @@ impl<'r> ::core::fmt::Display for ChallengeReader<'r> {
         write!(f, " }}")
     }
 }
-impl<'r> ChallengeReader<'r> {
-    pub const FIELD_COUNT: usize = 6;
+impl<'r> RoundLayoutReader<'r> {
+    pub const FIELD_COUNT: usize = 4;
     pub fn total_size(&self) -> usize {
         molecule::unpack_number(self.as_slice()) as usize
     }
@@ -4434,55 +7975,43 @@ impl<'r> ChallengeReader<'r> {
     pub fn has_extra_fields(&self) -> bool {
         Self::FIELD_COUNT != self.field_count()
     }
-    pub fn count(&self) -> Uint8TReader<'r> {
+    pub fn offset(&self) -> Uint16TReader<'r> {
         let slice = self.as_slice();
         let start = molecule::unpack_number(&slice[4..]) as usize;
         let end = molecule::unpack_number(&slice[8..]) as usize;
-        Uint8TReader::new_unchecked(&self.as_slice()[start..end])
+        Uint16TReader::new_unchecked(&self.as_slice()[start..end])
     }
-    pub fn challenger(&self) -> Uint8TReader<'r> {
+    pub fn count(&self) -> Uint16TReader<'r> {
         let slice = self.as_slice();
         let start = molecule::unpack_number(&slice[8..]) as usize;
         let end = molecule::unpack_number(&slice[12..]) as usize;
-        Uint8TReader::new_unchecked(&self.as_slice()[start..end])
+        Uint16TReader::new_unchecked(&self.as_slice()[start..end])
     }
-    pub fn snapshot_position(&self) -> Uint8TReader<'r> {
+    pub fn user1_output(&self) -> Uint16TReader<'r> {
         let slice = self.as_slice();
         let start = molecule::unpack_number(&slice[12..]) as usize;
         let end = molecule::unpack_number(&slice[16..]) as usize;
-        Uint8TReader::new_unchecked(&self.as_slice()[start..end])
+        Uint16TReader::new_unchecked(&self.as_slice()[start..end])
     }
-    pub fn snapshot_hashproof(&self) -> Blake256Reader<'r> {
+    pub fn user2_output(&self) -> Uint16TReader<'r> {
         let slice = self.as_slice();
         let start = molecule::unpack_number(&slice[16..]) as usize;
-        let end = molecule::unpack_number(&slice[20..]) as usize;
-        Blake256Reader::new_unchecked(&self.as_slice()[start..end])
-    }
-    pub fn snapshot_signature(&self) -> SignatureReader<'r> {
-        let slice = self.as_slice();
-        let start = molecule::unpack_number(&slice[20..]) as usize;
-        let end = molecule::unpack_number(&slice[24..]) as usize;
-        SignatureReader::new_unchecked(&self.as_slice()[start..end])
-    }
-    pub fn operations(&self) -> OperationsReader<'r> {
-        let slice = self.as_slice();
-        let start = molecule::unpack_number(&slice[24..]) as usize;
         if self.has_extra_fields() {
-            let end = molecule::unpack_number(&slice[28..]) as usize;
-            OperationsReader::new_unchecked(&self.as_slice()[start..end])
+            let end = molecule::unpack_number(&slice[20..]) as usize;
+            Uint16TReader::new_unchecked(&self.as_slice()[start..end])
         } else {
-            OperationsReader::new_unchecked(&self.as_slice()[start..])
+            Uint16TReader::new_unchecked(&self.as_slice()[start..])
         }
     }
 }
-impl<'r> molecule::prelude::Reader<'r> for ChallengeReader<'r> {
-    type Entity = Challenge;
-    const NAME: &'static str = "ChallengeReader";
+impl<'r> molecule::prelude::Reader<'r> for RoundLayoutReader<'r> {
+    type Entity = RoundLayout;
+    const NAME: &'static str = "RoundLayoutReader";
     fn to_entity(&self) -> Self::Entity {
         Self::Entity::new_unchecked(self.as_slice().to_owned().into())
     }
     fn new_unchecked(slice: &'r [u8]) -> Self {
-        ChallengeReader(slice)
+        RoundLayoutReader(slice)
     }
     fn as_slice(&self) -> &'r [u8] {
         self.0
@@ -4524,94 +8053,74 @@ impl<'r> molecule::prelude::Reader<'r> for ChallengeReader<'r> {
         if offsets.windows(2).any(|i| i[0] > i[1]) {
             return ve!(Self, OffsetsNotMatch);
         }
-        Uint8TReader::verify(&slice[offsets[0]..offsets[1]], compatible)?;
-        Uint8TReader::verify(&slice[offsets[1]..offsets[2]], compatible)?;
-        Uint8TReader::verify(&slice[offsets[2]..offsets[3]], compatible)?;
-        Blake256Reader::verify(&slice[offsets[3]..offsets[4]], compatible)?;
-        SignatureReader::verify(&slice[offsets[4]..offsets[5]], compatible)?;
-        OperationsReader::verify(&slice[offsets[5]..offsets[6]], compatible)?;
+        Uint16TReader::verify(&slice[offsets[0]..offsets[1]], compatible)?;
+        Uint16TReader::verify(&slice[offsets[1]..offsets[2]], compatible)?;
+        Uint16TReader::verify(&slice[offsets[2]..offsets[3]], compatible)?;
+        Uint16TReader::verify(&slice[offsets[3]..offsets[4]], compatible)?;
         Ok(())
     }
 }
 #[derive(Debug, Default)]
-pub struct ChallengeBuilder {
-    pub(crate) count: Uint8T,
-    pub(crate) challenger: Uint8T,
-    pub(crate) snapshot_position: Uint8T,
-    pub(crate) snapshot_hashproof: Blake256,
-    pub(crate) snapshot_signature: Signature,
-    pub(crate) operations: Operations,
+pub struct RoundLayoutBuilder {
+    pub(crate) offset: Uint16T,
+    pub(crate) count: Uint16T,
+    pub(crate) user1_output: Uint16T,
+    pub(crate) user2_output: Uint16T,
 }
-impl ChallengeBuilder {
-    pub const FIELD_COUNT: usize = 6;
-    pub fn count(mut self, v: Uint8T) -> Self {
-        self.count = v;
-        self
-    }
-    pub fn challenger(mut self, v: Uint8T) -> Self {
-        self.challenger = v;
-        self
-    }
-    pub fn snapshot_position(mut self, v: Uint8T) -> Self {
-        self.snapshot_position = v;
+impl RoundLayoutBuilder {
+    pub const FIELD_COUNT: usize = 4;
+    pub fn offset(mut self, v: Uint16T) -> Self {
+        self.offset = v;
         self
     }
-    pub fn snapshot_hashproof(mut self, v: Blake256) -> Self {
-        self.snapshot_hashproof = v;
+    pub fn count(mut self, v: Uint16T) -> Self {
+        self.count = v;
         self
     }
-    pub fn snapshot_signature(mut self, v: Signature) -> Self {
-        self.snapshot_signature = v;
+    pub fn user1_output(mut self, v: Uint16T) -> Self {
+        self.user1_output = v;
         self
     }
-    pub fn operations(mut self, v: Operations) -> Self {
-        self.operations = v;
+    pub fn user2_output(mut self, v: Uint16T) -> Self {
+        self.user2_output = v;
         self
     }
 }
-impl molecule::prelude::Builder for ChallengeBuilder {
-    type Entity = Challenge;
-    const NAME: &'static str = "ChallengeBuilder";
+impl molecule::prelude::Builder for RoundLayoutBuilder {
+    type Entity = RoundLayout;
+    const NAME: &'static str = "RoundLayoutBuilder";
     fn expected_length(&self) -> usize {
         molecule::NUMBER_SIZE * (Self::FIELD_COUNT + 1)
+            + self.offset.as_slice().len()
             + self.count.as_slice().len()
-            + self.challenger.as_slice().len()
-            + self.snapshot_position.as_slice().len()
-            + self.snapshot_hashproof.as_slice().len()
-            + self.snapshot_signature.as_slice().len()
-            + self.operations.as_slice().len()
+            + self.user1_output.as_slice().len()
+            + self.user2_output.as_slice().len()
     }
     fn write<W: ::molecule::io::Write>(&self, writer: &mut W) -> ::molecule::io::Result<()> {
         let mut total_size = molecule::NUMBER_SIZE * (Self::FIELD_COUNT + 1);
         let mut offsets = Vec::with_capacity(Self::FIELD_COUNT);
         offsets.push(total_size);
-        total_size += self.count.as_slice().len();
-        offsets.push(total_size);
-        total_size += self.challenger.as_slice().len();
-        offsets.push(total_size);
-        total_size += self.snapshot_position.as_slice().len();
+        total_size += self.offset.as_slice().len();
         offsets.push(total_size);
-        total_size += self.snapshot_hashproof.as_slice().len();
+        total_size += self.count.as_slice().len();
         offsets.push(total_size);
-        total_size += self.snapshot_signature.as_slice().len();
+        total_size += self.user1_output.as_slice().len();
         offsets.push(total_size);
-        total_size += self.operations.as_slice().len();
+        total_size += self.user2_output.as_slice().len();
         writer.write_all(&molecule::pack_number(total_size as molecule::Number))?;
         for offset in offsets.into_iter() {
             writer.write_all(&molecule::pack_number(offset as molecule::Number))?;
         }
+        writer.write_all(self.offset.as_slice())?;
         writer.write_all(self.count.as_slice())?;
-        writer.write_all(self.challenger.as_slice())?;
-        writer.write_all(self.snapshot_position.as_slice())?;
-        writer.write_all(self.snapshot_hashproof.as_slice())?;
-        writer.write_all(self.snapshot_signature.as_slice())?;
-        writer.write_all(self.operations.as_slice())?;
+        writer.write_all(self.user1_output.as_slice())?;
+        writer.write_all(self.user2_output.as_slice())?;
         Ok(())
     }
     fn build(&self) -> Self::Entity {
         let mut inner = Vec::with_capacity(self.expected_length());
         self.write(&mut inner)
             .unwrap_or_else(|_| panic!("{} build should be ok", Self::NAME));
-        Challenge::new_unchecked(inner.into())
+        RoundLayout::new_unchecked(inner.into())
     }
 }
@@ -2,14 +2,23 @@
 mod kabletop;
 use molecule::prelude::{Byte, Builder, Entity};
 use ckb_tool::{
-	ckb_hash::new_blake2b, ckb_types::bytes::Bytes
+	ckb_hash::{blake2b_256, new_blake2b}, ckb_types::bytes::Bytes
 };
-use kabletop::{Args, Round, Operations, Challenge};
+use kabletop::{Args, NftArgs, Round, SignedRound, SignedRounds, Operations, Challenge, RoundLayout, Argument, Arguments, Call, MerkleArgs, Reveal, Reveals};
 
 fn uint8_t(v: u8) -> kabletop::Uint8T {
     kabletop::Uint8TBuilder::default().set([Byte::from(v); 1]).build()
 }
 
+fn uint16_t(v: u16) -> kabletop::Uint16T {
+    let mut mol_bytes: [Byte; 2] = [Byte::default(); 2];
+    let bytes = v.to_le_bytes();
+    for i in 0..2 {
+        mol_bytes[i] = Byte::from(bytes[i]);
+    }
+    kabletop::Uint16TBuilder::default().set(mol_bytes).build()
+}
+
 fn uint64_t(v: u64) -> kabletop::Uint64T {
     let mut mol_bytes: [Byte; 8] = [Byte::default(); 8];
     let bytes = v.to_le_bytes();
@@ -92,6 +101,103 @@ pub fn lock_args(
         .build()
 }
 
+// channels listing nft type hashes have both decks proved on-chain against nft cells
+#[allow(dead_code)]
+pub fn with_nft_type_hashes(args: Args, nft_type_hashes: Vec<[u8; 32]>) -> NftArgs {
+    NftArgs::new_builder()
+        .user_staking_ckb(args.user_staking_ckb())
+        .user_deck_size(args.user_deck_size())
+        .begin_blocknumber(args.begin_blocknumber())
+        .lock_code_hash(args.lock_code_hash())
+        .lua_code_hashes(args.lua_code_hashes())
+        .user1_pkhash(args.user1_pkhash())
+        .user1_nfts(args.user1_nfts())
+        .user2_pkhash(args.user2_pkhash())
+        .user2_nfts(args.user2_nfts())
+        .nft_type_hashes(hashes_t(nft_type_hashes))
+        .build()
+}
+
+// merkle tree over a deck, leaves and nodes are prefixed with 0 and 1 and an odd last node
+// is carried up unchanged, see verify_nft_proof in core.h
+fn nft_levels(nfts: &[[u8; 20]]) -> Vec<Vec<[u8; 32]>> {
+    let mut levels = vec![nfts
+        .iter()
+        .map(|nft| blake2b_256([&[0u8][..], &nft[..]].concat()))
+        .collect::<Vec<_>>()];
+    while levels.last().unwrap().len() > 1 {
+        let level = levels
+            .last()
+            .unwrap()
+            .chunks(2)
+            .map(|pair| match pair {
+                [left, right] => blake2b_256([&[1u8][..], &left[..], &right[..]].concat()),
+                _ => pair[0],
+            })
+            .collect();
+        levels.push(level);
+    }
+    levels
+}
+
+#[allow(dead_code)]
+pub fn nft_root(nfts: &[[u8; 20]]) -> [u8; 32] {
+    nft_levels(nfts)
+        .last()
+        .and_then(|level| level.first().cloned())
+        .unwrap_or([0u8; 32])
+}
+
+#[allow(dead_code)]
+pub fn nft_proof(nfts: &[[u8; 20]], index: usize) -> Vec<[u8; 32]> {
+    let levels = nft_levels(nfts);
+    let mut proof = vec![];
+    let mut i = index;
+    for level in &levels[..levels.len() - 1] {
+        if (i ^ 1) < level.len() {
+            proof.push(level[i ^ 1]);
+        }
+        i /= 2;
+    }
+    proof
+}
+
+#[allow(dead_code)]
+pub fn merkle_lock_args(
+	raw: (u64, u8, u64, [u8; 32], [u8; 20], Vec<[u8; 20]>, [u8; 20], Vec<[u8; 20]>), luacode_hashes: Vec<[u8; 32]>
+) -> MerkleArgs {
+    MerkleArgs::new_builder()
+        .user_staking_ckb(uint64_t(raw.0))
+        .user_deck_size(uint8_t(raw.1))
+        .begin_blocknumber(uint64_t(raw.2))
+        .lock_code_hash(blake256_t(raw.3))
+		.lua_code_hashes(hashes_t(luacode_hashes))
+        .user1_pkhash(blake160_t(raw.4))
+        .user1_nft_root(blake256_t(nft_root(&raw.5)))
+        .user2_pkhash(blake160_t(raw.6))
+        .user2_nft_root(blake256_t(nft_root(&raw.7)))
+        .build()
+}
+
+// cards of merkle committed decks used by replay, given as (user_type, index, deck)
+#[allow(dead_code)]
+pub fn reveals(cards: Vec<(u8, u8, &[[u8; 20]])>) -> Reveals {
+    let reveals = cards
+        .into_iter()
+        .map(|(user_type, index, deck)| {
+            Reveal::new_builder()
+                .user_type(uint8_t(user_type))
+                .index(uint8_t(index))
+                .nft(blake160_t(deck[index as usize]))
+                .proof(hashes_t(nft_proof(deck, index as usize)))
+                .build()
+        })
+        .collect::<Vec<_>>();
+    Reveals::new_builder()
+        .set(reveals)
+        .build()
+}
+
 #[allow(dead_code)]
 pub fn round(user_type: u8, operations: Vec<&str>) -> Round {
     let operations = operations
@@ -107,8 +213,129 @@ pub fn round(user_type: u8, operations: Vec<&str>) -> Round {
         .build()
 }
 
+// user_type of an encoded round, which is signed by the other user
+#[allow(dead_code)]
+pub fn round_user_type(round: &[u8]) -> u8 {
+    Round::from_slice(round).expect("round").user_type().nth0().into()
+}
+
+// rounds with their signatures packed into one witness, see open_packed_rounds in core.h
+#[allow(dead_code)]
+pub fn signed_rounds(snapshot: Vec<(Bytes, [u8; 65])>) -> SignedRounds {
+    let rounds = snapshot
+        .into_iter()
+        .map(|(round, signature)| {
+            SignedRound::new_builder()
+                .round(Round::from_slice(&round).expect("round"))
+                .signature(signature_t(signature))
+                .build()
+        })
+        .collect::<Vec<SignedRound>>();
+    SignedRounds::new_builder()
+        .set(rounds)
+        .build()
+}
+
+// greedy LZ encoding of lua operation which contract decompresses with the first celldep lua
+// code as dictionary, see decompress_operation in inject.h for the token format
+#[allow(dead_code)]
+pub fn compress(code: &[u8], dictionary: &[u8]) -> Vec<u8> {
+    let window = [dictionary, code].concat();
+    let mut compressed = vec![0u8];
+    let mut literals: Vec<u8> = vec![];
+    let flush = |compressed: &mut Vec<u8>, literals: &mut Vec<u8>| {
+        for chunk in literals.chunks(128) {
+            compressed.push((chunk.len() - 1) as u8);
+            compressed.extend_from_slice(chunk);
+        }
+        literals.clear();
+    };
+    let mut pos = dictionary.len();
+    while pos < window.len() {
+        let max_len = std::cmp::min(130, window.len() - pos);
+        let (mut best_len, mut best_distance) = (0, 0);
+        for start in pos.saturating_sub(65535)..pos {
+            let mut len = 0;
+            while len < max_len && window[start + len] == window[pos + len] {
+                len += 1;
+            }
+            if len > best_len {
+                best_len = len;
+                best_distance = pos - start;
+            }
+        }
+        if best_len >= 3 {
+            flush(&mut compressed, &mut literals);
+            compressed.push(0x80 | (best_len - 3) as u8);
+            compressed.extend_from_slice(&(best_distance as u16).to_le_bytes());
+            pos += best_len;
+        } else {
+            literals.push(window[pos]);
+            pos += 1;
+        }
+    }
+    flush(&mut compressed, &mut literals);
+    compressed
+}
+
+#[allow(dead_code)]
+pub fn compressed_round(user_type: u8, operations: Vec<&str>, dictionary: &[u8]) -> Round {
+    let operations = operations
+        .iter()
+        .map(|code| compress(code.as_bytes(), dictionary))
+        .collect::<Vec<Vec<u8>>>();
+    raw_round(user_type, operations)
+}
+
+#[allow(dead_code)]
+pub enum Arg<'a> {
+    Integer(i64),
+    String(&'a str),
+    Boolean(bool),
+}
+
+// call operation of a function registered into lua global "_calls" by game library
+#[allow(dead_code)]
+pub fn call(function_id: u16, arguments: Vec<Arg>) -> Vec<u8> {
+    let arguments = arguments
+        .iter()
+        .map(|argument| {
+            let (kind, data) = match argument {
+                Arg::Integer(value) => (0u8, value.to_le_bytes().to_vec()),
+                Arg::String(value) => (1u8, value.as_bytes().to_vec()),
+                Arg::Boolean(value) => (2u8, vec![*value as u8]),
+            };
+            Argument::new_builder()
+                .kind(uint8_t(kind))
+                .data(bytes_t(&data))
+                .build()
+        })
+        .collect::<Vec<Argument>>();
+    let call = Call::new_builder()
+        .function_id(uint16_t(function_id))
+        .arguments(Arguments::new_builder().set(arguments).build())
+        .build();
+    [vec![1u8], to_vec(&call)].concat()
+}
+
+// round made of already encoded operations
+#[allow(dead_code)]
+pub fn raw_round(user_type: u8, operations: Vec<Vec<u8>>) -> Round {
+    let operations = operations
+        .iter()
+        .map(|bytes| bytes_t(bytes))
+        .collect::<Vec<kabletop::Bytes>>();
+    let operations = Operations::new_builder()
+        .set(operations)
+        .build();
+    Round::new_builder()
+        .user_type(uint8_t(user_type))
+        .operations(operations)
+        .build()
+}
+
 #[allow(dead_code)]
-pub fn challenge(challenger: u8, count: u8, snapshot: Vec<(Bytes, [u8; 65])>, operations: Vec<&str>) -> Challenge {
+pub fn challenge(challenger: u8, count: u16, snapshot: Vec<(Bytes, [u8; 65])>, operations: Vec<&str>) -> Challenge {
 	let mut blake2b = new_blake2b();
 	for (round, signature) in &snapshot {
 		blake2b.update(round.to_vec().as_slice());
@@ -124,11 +351,21 @@ pub fn challenge(challenger: u8, count: u8, snapshot: Vec<(Bytes, [u8; 65])>, op
         .set(operations)
         .build();
     Challenge::new_builder()
-		.count(uint8_t(count))
+		.count(uint16_t(count))
         .challenger(uint8_t(challenger))
-        .snapshot_position(uint8_t(snapshot.len() as u8))
+        .snapshot_position(uint16_t(snapshot.len() as u16))
 		.snapshot_hashproof(blake256_t(hash_proof))
 		.snapshot_signature(signature_t(snapshot.last().unwrap().1))
 		.operations(operations)
         .build()
 }
+
+#[allow(dead_code)]
+pub fn round_layout(offset: u16, count: u16, user1_output: u16, user2_output: u16) -> RoundLayout {
+    RoundLayout::new_builder()
+        .offset(uint16_t(offset))
+        .count(uint16_t(count))
+        .user1_output(uint16_t(user1_output))
+        .user2_output(uint16_t(user2_output))
+        .build()
+}
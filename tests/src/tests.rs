@@ -1,8 +1,10 @@
 use super::{
-    helper::{sign_tx, blake160, MAX_CYCLES, gen_witnesses_and_signatures},
+    helper::{sign_tx, sign_tx_with_witness, sign_batch_tx, blake160, MAX_CYCLES, gen_witnesses_and_signatures, pack_witnesses},
+    mock_tx,
     protocol,
     *,
 };
+use std::{env, fs, process};
 use ckb_system_scripts::BUNDLED_CELL;
 use ckb_testtool::{
     builtin::ALWAYS_SUCCESS,
@@ -13,13 +15,13 @@ use ckb_tool::{
     ckb_hash::blake2b_256,
     ckb_types::{
         bytes::Bytes,
-        core::{TransactionBuilder, Capacity},
-        packed::{CellDep, CellOutput, CellInput, Script},
+        core::{TransactionBuilder, TransactionView, Capacity, DepType},
+        packed::{CellDep, CellOutput, CellInput, OutPoint, OutPointVec, Script, WitnessArgs},
         prelude::*,
     },
 };
 
-fn get_keypair() -> (Privkey, [u8; 20]) {
+pub fn get_keypair() -> (Privkey, [u8; 20]) {
     let keypair = Generator::random_keypair();
     let compressed_pubkey = keypair.1.serialize();
     let script_args = blake160(compressed_pubkey.to_vec().as_slice());
@@ -27,7 +29,7 @@ fn get_keypair() -> (Privkey, [u8; 20]) {
     (privkey, script_args)
 }
 
-fn get_nfts(count: u8) -> Vec<[u8; 20]> {
+pub fn get_nfts(count: u8) -> Vec<[u8; 20]> {
     let mut nfts = vec![];
     for i in 0..count {
         nfts.push(blake160(&i.to_be_bytes()));
@@ -35,11 +37,243 @@ fn get_nfts(count: u8) -> Vec<[u8; 20]> {
     return nfts;
 }
 
-fn get_round(user_type: u8, lua_code: Vec<&str>) -> Bytes {
+pub fn get_round(user_type: u8, lua_code: Vec<&str>) -> Bytes {
     let user_round = protocol::round(user_type, lua_code);
     Bytes::from(protocol::to_vec(&user_round))
 }
 
+// a game between two fresh users, tests only set what they change and take the rest from
+// Game::default(), which is the plain two round game user1 wins
+//
+// nft cells are given as (user_type, nfts, spent) and turn on deck verification, all of them
+// are cell deps, or members of one dep group, and spent ones are inputs as well, so that the same
+// cell is seen twice, every nft cell has its own capacity so that no two of them are alike,
+// reveals are given as (user_type, index) and commit both decks as merkle roots instead, packed
+// games carry all rounds in one witness
+pub struct Game {
+    pub binary: &'static str,
+    pub decks: (Vec<[u8; 20]>, Vec<[u8; 20]>),
+    pub luacodes: Vec<Bytes>,
+    pub nft_cells: Option<Vec<(u8, Vec<[u8; 20]>, bool)>>,
+    pub nft_dep_group: bool,
+    pub reveals: Option<Vec<(u8, u8)>>,
+    pub rounds: Vec<Bytes>,
+    pub packed: bool,
+}
+
+impl Default for Game {
+    fn default() -> Self {
+        Game {
+            binary: "kabletop",
+            decks: (get_nfts(5), get_nfts(5)),
+            luacodes: vec![],
+            nft_cells: None,
+            nft_dep_group: false,
+            reveals: None,
+            rounds: vec![
+                get_round(1u8, vec!["ckb.debug('user1 draw one card from ' .. _user1_nfts[1])"]),
+                get_round(2u8, vec!["ckb.debug('user2 surrenders.')", "_winner = 1"]),
+            ],
+            packed: false,
+        }
+    }
+}
+
+// contract, secp256k1 data and always_success deployed once for every channel of a transaction,
+// nft cells are typed by an always_success script with distinct args
+pub struct Deployment {
+    kabletop: OutPoint,
+    always_success: OutPoint,
+    nft_type: Script,
+    pub cell_deps: Vec<CellDep>,
+}
+
+pub fn deploy(context: &mut Context, binary: &str) -> Deployment {
+    let contract_bin: Bytes = Loader::default().load_binary(binary);
+    let kabletop = context.deploy_cell(contract_bin);
+    let secp256k1_data_bin = BUNDLED_CELL.get("specs/cells/secp256k1_data").unwrap();
+    let secp256k1_data = context.deploy_cell(secp256k1_data_bin.to_vec().into());
+    let always_success = context.deploy_cell(ALWAYS_SUCCESS.clone());
+    let nft_type = context
+        .build_script(&always_success, Bytes::from(vec![0x6e, 0x66, 0x74]))
+        .expect("nft type_script");
+    let cell_deps = vec![kabletop.clone(), secp256k1_data, always_success.clone()]
+        .into_iter()
+        .map(|out_point| CellDep::new_builder().out_point(out_point).build())
+        .collect();
+    Deployment { kabletop, always_success, nft_type, cell_deps }
+}
+
+// one channel of a game, its input stakes 2000 under the kabletop lock and both users are paid
+// to always_success locks of their pubkey hashes
+pub struct Channel {
+    pub user1_privkey: Privkey,
+    pub user2_privkey: Privkey,
+    pub lock_script: Script,
+    pub user1_lock: Script,
+    pub user2_lock: Script,
+    pub input: CellInput,
+}
+
+impl Channel {
+    pub fn open(
+        context: &mut Context, deployment: &Deployment, game: &Game, user1: (Privkey, [u8; 20]), user2: (Privkey, [u8; 20])
+    ) -> Channel {
+        let (user1_privkey, user1_pkhash) = user1;
+        let (user2_privkey, user2_pkhash) = user2;
+
+        // prepare scripts
+        let code_hash: [u8; 32] = blake2b_256(ALWAYS_SUCCESS.to_vec());
+        let (user1_deck, user2_deck) = game.decks.clone();
+        let deck_size = user1_deck.len() as u8;
+        let lock_args_molecule = (500u64, deck_size, 1024u64, code_hash, user1_pkhash, user1_deck, user2_pkhash, user2_deck);
+        let luacode_hashes = game.luacodes.iter().map(|luacode| blake2b_256(luacode)).collect();
+        let lock_args = if game.reveals.is_some() {
+            protocol::to_vec(&protocol::merkle_lock_args(lock_args_molecule, luacode_hashes))
+        } else if game.nft_cells.is_some() {
+            let lock_args = protocol::lock_args(lock_args_molecule, luacode_hashes);
+            let mut nft_type_hash = [0u8; 32];
+            nft_type_hash.copy_from_slice(deployment.nft_type.calc_script_hash().as_slice());
+            protocol::to_vec(&protocol::with_nft_type_hashes(lock_args, vec![nft_type_hash]))
+        } else {
+            protocol::to_vec(&protocol::lock_args(lock_args_molecule, luacode_hashes))
+        };
+        let lock_script = context
+            .build_script(&deployment.kabletop, Bytes::from(lock_args))
+            .expect("lock_script");
+        let user1_lock = context
+            .build_script(&deployment.always_success, Bytes::from(user1_pkhash.to_vec()))
+            .expect("user1 always_success_script");
+        let user2_lock = context
+            .build_script(&deployment.always_success, Bytes::from(user2_pkhash.to_vec()))
+            .expect("user2 always_success_script");
+
+        // prepare cells
+        let input_out_point = context.create_cell(
+            CellOutput::new_builder()
+                .capacity(2000u64.pack())
+                .lock(lock_script.clone())
+                .build(),
+            Bytes::new(),
+        );
+        let input = CellInput::new_builder()
+            .previous_output(input_out_point)
+            .build();
+        Channel { user1_privkey, user2_privkey, lock_script, user1_lock, user2_lock, input }
+    }
+
+    // rounds of user1 are signed by user2 and the other way around
+    pub fn sign_rounds(&self, rounds: &[Bytes]) -> (Vec<WitnessArgs>, Vec<[u8; 65]>) {
+        let witnesses = rounds
+            .iter()
+            .map(|round| {
+                let privkey = if protocol::round_user_type(round) == 1 { &self.user2_privkey } else { &self.user1_privkey };
+                (privkey, round.clone())
+            })
+            .collect();
+        gen_witnesses_and_signatures(&self.lock_script, 2000u64, witnesses)
+    }
+}
+
+// build game into context as a settlement paying 1500 to user1 and 500 to user2
+pub fn build_game_tx(context: &mut Context, game: &Game) -> TransactionView {
+    let deployment = deploy(context, game.binary);
+    let luacode_deps = game.luacodes
+        .iter()
+        .map(|luacode| CellDep::new_builder().out_point(context.deploy_cell(luacode.clone())).build())
+        .collect::<Vec<_>>();
+    let channel = Channel::open(context, &deployment, game, get_keypair(), get_keypair());
+    let mut nft_out_points = vec![];
+    let mut nft_inputs = vec![];
+    for (i, (user_type, owned, spent)) in game.nft_cells.iter().flatten().enumerate() {
+        let lock = if *user_type == 1 { &channel.user1_lock } else { &channel.user2_lock };
+        let nft_out_point = context.create_cell(
+            CellOutput::new_builder()
+                .capacity((1000u64 + i as u64).pack())
+                .lock(lock.clone())
+                .type_(Some(deployment.nft_type.clone()).pack())
+                .build(),
+            Bytes::from(owned.concat()),
+        );
+        nft_out_points.push(nft_out_point.clone());
+        if *spent {
+            nft_inputs.push(CellInput::new_builder()
+                .previous_output(nft_out_point)
+                .build());
+        }
+    }
+    let nft_deps = if game.nft_dep_group {
+        let dep_group = OutPointVec::new_builder().set(nft_out_points).build();
+        let dep_group_out_point = context.deploy_cell(dep_group.as_bytes());
+        vec![CellDep::new_builder()
+            .out_point(dep_group_out_point)
+            .dep_type(DepType::DepGroup.into())
+            .build()]
+    } else {
+        nft_out_points
+            .into_iter()
+            .map(|out_point| CellDep::new_builder().out_point(out_point).build())
+            .collect()
+    };
+    let outputs = vec![
+        CellOutput::new_builder()
+            .capacity(1500.pack())
+            .lock(channel.user1_lock.clone())
+            .build(),
+        CellOutput::new_builder()
+            .capacity(500.pack())
+            .lock(channel.user2_lock.clone())
+            .build()
+    ];
+    let (mut witnesses, _) = channel.sign_rounds(&game.rounds);
+    if game.packed {
+        witnesses = pack_witnesses(witnesses);
+    }
+    let outputs_data = vec![Bytes::new(), Bytes::new()];
+
+    // build transaction
+    let tx = TransactionBuilder::default()
+        .input(channel.input.clone())
+        .inputs(nft_inputs.clone())
+        .outputs(outputs)
+        .outputs_data(outputs_data.pack())
+        .cell_deps(deployment.cell_deps)
+        .cell_deps(luacode_deps)
+        .cell_deps(nft_deps)
+        .build();
+    let tx = context.complete_tx(tx);
+    let tx = match &game.reveals {
+        Some(cards) => {
+            let (user1_deck, user2_deck) = &game.decks;
+            let reveals = protocol::reveals(cards
+                .iter()
+                .map(|&(user_type, index)| (user_type, index, if user_type == 1 { &user1_deck[..] } else { &user2_deck[..] }))
+                .collect());
+            let group_witness = WitnessArgs::new_builder()
+                .output_type(Some(Bytes::from(protocol::to_vec(&reveals))).pack())
+                .build();
+            sign_tx_with_witness(tx, &channel.user1_privkey, group_witness, witnesses)
+        }
+        None => sign_tx(tx, &channel.user1_privkey, witnesses),
+    };
+
+    // rounds start after witnesses of all inputs, spent nft cells are given empty ones which the
+    // kabletop signature does not cover
+    let mut signed_witnesses = tx.witnesses().into_iter().collect::<Vec<_>>();
+    for _ in &nft_inputs {
+        signed_witnesses.insert(1, Bytes::new().pack());
+    }
+    tx.as_advanced_builder().set_witnesses(signed_witnesses).build()
+}
+
+pub fn run_game_to_settlement(game: &Game) -> Option<u64> {
+    let mut context = Context::default();
+    let tx = build_game_tx(&mut context, game);
+
+    // run
+    context.verify_tx(&tx, MAX_CYCLES).ok()
+}
+
 #[test]
 fn test_success_origin_to_challenge() {
     // deploy contract
@@ -303,6 +537,231 @@ fn test_success_origin_to_settlement() {
     println!("consume cycles: {}", cycles);
 }
 
+#[test]
+fn test_success_many_outputs_to_settlement() {
+    // deploy contract
+    let mut context = Context::default();
+    let contract_bin: Bytes = Loader::default().load_binary("kabletop");
+    let out_point = context.deploy_cell(contract_bin);
+    let secp256k1_data_bin = BUNDLED_CELL.get("specs/cells/secp256k1_data").unwrap();
+    let secp256k1_data_out_point = context.deploy_cell(secp256k1_data_bin.to_vec().into());
+    let secp256k1_data_dep = CellDep::new_builder()
+        .out_point(secp256k1_data_out_point)
+        .build();
+    let always_success_out_point = context.deploy_cell(ALWAYS_SUCCESS.clone());
+    let always_success_script_dep = CellDep::new_builder()
+        .out_point(always_success_out_point.clone())
+        .build();
+
+    // generate two users' privkey and pubkhash
+    let (user1_privkey, user1_pkhash) = get_keypair();
+    let (user2_privkey, user2_pkhash) = get_keypair();
+
+    // prepare scripts
+    let code_hash: [u8; 32] = blake2b_256(ALWAYS_SUCCESS.to_vec());
+    let lock_args_molecule = (500u64, 5u8, 1024u64, code_hash, user1_pkhash, get_nfts(5), user2_pkhash, get_nfts(5));
+    let lock_args = protocol::lock_args(lock_args_molecule, vec![]);
+
+    let lock_script = context
+        .build_script(&out_point, Bytes::from(protocol::to_vec(&lock_args)))
+        .expect("lock_script");
+    let lock_script_dep = CellDep::new_builder()
+        .out_point(out_point)
+        .build();
+    let user1_always_success_script = context
+        .build_script(&always_success_out_point, Bytes::from(user1_pkhash.to_vec()))
+        .expect("user1 always_success_script");
+    let user2_always_success_script = context
+        .build_script(&always_success_out_point, Bytes::from(user2_pkhash.to_vec()))
+        .expect("user2 always_success_script");
+
+    // prepare cells, outputs of other parties in front of the payouts outnumber MAX_OUTPUT_COUNT
+    let input_out_point = context.create_cell(
+        CellOutput::new_builder()
+            .capacity(2000u64.pack())
+            .lock(lock_script.clone())
+            .build(),
+        Bytes::new(),
+    );
+    let input = CellInput::new_builder()
+        .previous_output(input_out_point)
+        .build();
+    let mut outputs = vec![];
+    for _ in 0..100 {
+        let (_, other_pkhash) = get_keypair();
+        let other_always_success_script = context
+            .build_script(&always_success_out_point, Bytes::from(other_pkhash.to_vec()))
+            .expect("other always_success_script");
+        outputs.push(CellOutput::new_builder()
+            .capacity(100.pack())
+            .lock(other_always_success_script)
+            .build());
+    }
+    outputs.push(CellOutput::new_builder()
+        .capacity(1500.pack())
+        .lock(user1_always_success_script.clone())
+        .build());
+    outputs.push(CellOutput::new_builder()
+        .capacity(500.pack())
+        .lock(user2_always_success_script.clone())
+        .build());
+
+    // prepare witnesses
+    let end_round = protocol::round(2u8, vec![
+        "ckb.debug('user2 draw one card, and surrender the game.')",
+        "_winner = 1"
+    ]);
+    let witnesses = vec![
+        (&user2_privkey, get_round(1u8, vec!["ckb.debug('user1 draw one card, and spell it adding HP.')"])),
+        (&user1_privkey, Bytes::from(protocol::to_vec(&end_round))),
+    ];
+    let (witnesses, _) = gen_witnesses_and_signatures(&lock_script, 2000u64, witnesses);
+    let outputs_data = vec![Bytes::new(); outputs.len()];
+
+    // build transaction
+    let tx = TransactionBuilder::default()
+        .input(input)
+        .outputs(outputs)
+        .outputs_data(outputs_data.pack())
+        .cell_dep(lock_script_dep)
+        .cell_dep(secp256k1_data_dep)
+        .cell_dep(always_success_script_dep)
+        .build();
+    let tx = context.complete_tx(tx);
+    let tx = sign_tx(tx, &user1_privkey, witnesses);
+
+    // run
+    let cycles = context
+        .verify_tx(&tx, MAX_CYCLES)
+        .expect("pass test_success_many_outputs_to_settlement");
+    println!("consume cycles: {}", cycles);
+}
+
+fn run_verified_decks_to_settlement(decks: (Vec<[u8; 20]>, Vec<[u8; 20]>), cells: Vec<(u8, Vec<[u8; 20]>, bool)>) -> Option<u64> {
+    run_game_to_settlement(&Game { decks, nft_cells: Some(cells), ..Game::default() })
+}
+
+fn run_dep_group_decks_to_settlement(decks: (Vec<[u8; 20]>, Vec<[u8; 20]>), cells: Vec<(u8, Vec<[u8; 20]>, bool)>) -> Option<u64> {
+    run_game_to_settlement(&Game { decks, nft_cells: Some(cells), nft_dep_group: true, ..Game::default() })
+}
+
+// user1 owns the deck across two unsorted nft cells with one spare card
+fn user1_deck_cells(deck: &[[u8; 20]]) -> Vec<(u8, Vec<[u8; 20]>, bool)> {
+    let half = deck.len() / 2;
+    let mut spare = deck[..half].iter().rev().cloned().collect::<Vec<_>>();
+    spare.push(blake160(b"spare"));
+    vec![(1u8, spare, false), (1u8, deck[half..].iter().rev().cloned().collect(), false)]
+}
+
+#[test]
+fn test_success_verified_decks_to_settlement() {
+    // user2 owns two copies of the deck's first card but needs only one
+    let nfts = get_nfts(5);
+    let mut cells = user1_deck_cells(&nfts);
+    cells.push((2u8, vec![nfts[0], nfts[3], nfts[1], nfts[0], nfts[4], nfts[2]], false));
+    let cycles = run_verified_decks_to_settlement((nfts.clone(), nfts), cells)
+        .expect("pass test_success_verified_decks_to_settlement");
+    println!("consume cycles: {}", cycles);
+}
+
+#[test]
+fn test_failure_unowned_deck_to_settlement() {
+    // user2 misses the last card of the deck
+    let nfts = get_nfts(5);
+    let mut cells = user1_deck_cells(&nfts);
+    cells.push((2u8, vec![nfts[0], nfts[1]], false));
+    cells.push((2u8, vec![nfts[2], nfts[3]], false));
+    assert!(run_verified_decks_to_settlement((nfts.clone(), nfts), cells).is_none());
+}
+
+#[test]
+fn test_success_same_card_cells_to_settlement() {
+    // user2 plays two copies of a card held by two cells of the same data, and the first of
+    // them is spent as well, which must neither hide the other one nor count twice
+    let nfts = get_nfts(5);
+    let user2_deck = vec![nfts[0], nfts[0], nfts[1], nfts[2], nfts[3]];
+    let mut cells = user1_deck_cells(&nfts);
+    cells.push((2u8, vec![nfts[0]], true));
+    cells.push((2u8, vec![nfts[0]], false));
+    cells.push((2u8, vec![nfts[3], nfts[2], nfts[1]], false));
+    let cycles = run_verified_decks_to_settlement((nfts.clone(), user2_deck), cells)
+        .expect("pass test_success_same_card_cells_to_settlement");
+    println!("consume cycles: {}", cycles);
+}
+
+#[test]
+fn test_failure_cell_dep_and_input_to_settlement() {
+    // a cell which is both a cell dep and an input holds its card only once
+    let nfts = get_nfts(5);
+    let user2_deck = vec![nfts[0], nfts[0], nfts[1], nfts[2], nfts[3]];
+    let mut cells = user1_deck_cells(&nfts);
+    cells.push((2u8, vec![nfts[0]], true));
+    cells.push((2u8, vec![nfts[3], nfts[2], nfts[1]], false));
+    assert!(run_verified_decks_to_settlement((nfts.clone(), user2_deck), cells).is_none());
+}
+
+#[test]
+fn test_success_dep_group_decks_to_settlement() {
+    // nft cells reached through a dep group are counted as if they were cell deps themselves
+    let nfts = get_nfts(5);
+    let mut cells = user1_deck_cells(&nfts);
+    cells.push((2u8, vec![nfts[4], nfts[3], nfts[2], nfts[1], nfts[0]], false));
+    let cycles = run_dep_group_decks_to_settlement((nfts.clone(), nfts), cells)
+        .expect("pass test_success_dep_group_decks_to_settlement");
+    println!("consume cycles: {}", cycles);
+}
+
+#[test]
+fn test_failure_dep_group_and_input_to_settlement() {
+    // a cell which is both a member of a dep group and an input holds its card only once
+    let nfts = get_nfts(5);
+    let user2_deck = vec![nfts[0], nfts[0], nfts[1], nfts[2], nfts[3]];
+    let mut cells = user1_deck_cells(&nfts);
+    cells.push((2u8, vec![nfts[0]], true));
+    cells.push((2u8, vec![nfts[3], nfts[2], nfts[1]], false));
+    assert!(run_dep_group_decks_to_settlement((nfts.clone(), user2_deck), cells).is_none());
+}
+
+#[test]
+fn test_success_full_decks_one_card_per_cell_to_settlement() {
+    // both users hold 255-card decks one card per nft cell
+    let nfts = get_nfts(255);
+    let mut cells = vec![];
+    for user_type in 1..=2u8 {
+        for nft in nfts.iter().rev() {
+            cells.push((user_type, vec![*nft], false));
+        }
+    }
+    let cycles = run_verified_decks_to_settlement((nfts.clone(), nfts), cells)
+        .expect("pass test_success_full_decks_one_card_per_cell_to_settlement");
+    println!("consume cycles: {}", cycles);
+}
+
+fn run_merkle_decks_to_settlement(cards: Vec<(u8, u8)>) -> Option<u64> {
+    // replay reads the second card of user1 and the last card of user2
+    run_game_to_settlement(&Game {
+        reveals: Some(cards),
+        rounds: vec![
+            get_round(1u8, vec!["ckb.debug('user1 draws ' .. _user1_nfts[2])"]),
+            get_round(2u8, vec!["ckb.debug('user2 draws ' .. _user2_nfts[5])", "_winner = 1"]),
+        ],
+        ..Game::default()
+    })
+}
+
+#[test]
+fn test_success_merkle_decks_to_settlement() {
+    let cycles = run_merkle_decks_to_settlement(vec![(1, 1), (2, 4)])
+        .expect("pass test_success_merkle_decks_to_settlement");
+    println!("consume cycles: {}", cycles);
+}
+
+#[test]
+fn test_failure_unrevealed_card_to_settlement() {
+    // the last card of user2 is read by replay but never revealed
+    assert!(run_merkle_decks_to_settlement(vec![(1, 1), (2, 3)]).is_none());
+}
+
 #[test]
 fn test_success_timeout_to_settlement() {
     // deploy contract
@@ -412,3 +871,344 @@ fn test_success_timeout_to_settlement() {
         .expect("pass test_success_timeout_to_settlement");
     println!("consume cycles: {}", cycles);
 }
+
+pub fn build_batch_tx(context: &mut Context, shared_user1: bool, shared_payout: bool) -> TransactionView {
+    let deployment = deploy(context, "kabletop");
+    let game = Game {
+        rounds: vec![
+            get_round(1u8, vec!["ckb.debug('user1 draw one card, and spell it adding HP.')"]),
+            get_round(2u8, vec!["ckb.debug('user2 draw one card, and spell it to damage user1.')"]),
+            get_round(1u8, vec!["ckb.debug('user1 draw one card, and use it to kill user2.')"]),
+            get_round(2u8, vec!["ckb.debug('user2 draw one card, and surrender the game.')", "_winner = 1"]),
+        ],
+        ..Game::default()
+    };
+
+    // settle two channels in one transaction, user1 may play both of them, and the second channel
+    // may point its user1 payout at the one of the first channel
+    let shared_keypair = get_keypair();
+    let mut inputs = vec![];
+    let mut outputs = vec![];
+    let mut groups = vec![];
+    let mut extra_witnesses = vec![];
+    for i in 0..2 {
+        let user1 = if shared_user1 {
+            shared_keypair.clone()
+        } else {
+            get_keypair()
+        };
+        let channel = Channel::open(context, &deployment, &game, user1, get_keypair());
+        inputs.push(channel.input.clone());
+        let user1_output = if shared_payout && i > 0 {
+            0
+        } else {
+            outputs.push(CellOutput::new_builder()
+                .capacity(1500.pack())
+                .lock(channel.user1_lock.clone())
+                .build());
+            outputs.len() as u16 - 1
+        };
+        outputs.push(CellOutput::new_builder()
+            .capacity(500.pack())
+            .lock(channel.user2_lock.clone())
+            .build());
+        let user2_output = outputs.len() as u16 - 1;
+
+        let (witnesses, _) = channel.sign_rounds(&game.rounds);
+        let layout = protocol::round_layout(
+            extra_witnesses.len() as u16,
+            witnesses.len() as u16,
+            user1_output,
+            user2_output,
+        );
+        groups.push((channel.user1_privkey, Bytes::from(protocol::to_vec(&layout))));
+        extra_witnesses.extend(witnesses);
+    }
+    let outputs_data = vec![Bytes::new(); outputs.len()];
+
+    // build transaction
+    let tx = TransactionBuilder::default()
+        .inputs(inputs)
+        .outputs(outputs)
+        .outputs_data(outputs_data.pack())
+        .cell_deps(deployment.cell_deps)
+        .build();
+    let tx = context.complete_tx(tx);
+    let groups = groups
+        .iter()
+        .map(|(privkey, layout)| (privkey, layout.clone()))
+        .collect::<Vec<_>>();
+    sign_batch_tx(tx, groups, extra_witnesses)
+}
+
+fn run_batch_to_settlement(shared_user1: bool, shared_payout: bool) -> Option<u64> {
+    let mut context = Context::default();
+    let tx = build_batch_tx(&mut context, shared_user1, shared_payout);
+
+    // run
+    context.verify_tx(&tx, MAX_CYCLES).ok()
+}
+
+#[test]
+fn test_success_batch_to_settlement() {
+    // two channels played by different users
+    let cycles = run_batch_to_settlement(false, false)
+        .expect("pass test_success_batch_to_settlement");
+    println!("consume cycles: {}", cycles);
+}
+
+#[test]
+fn test_success_shared_user_batch_to_settlement() {
+    // user1 plays both channels and is paid by each of them separately
+    let cycles = run_batch_to_settlement(true, false)
+        .expect("pass test_success_shared_user_batch_to_settlement");
+    println!("consume cycles: {}", cycles);
+}
+
+#[test]
+fn test_failure_shared_payout_batch_to_settlement() {
+    // user1 plays both channels but only one payout is left for both stakes
+    assert!(run_batch_to_settlement(true, true).is_none());
+}
+
+#[test]
+fn test_success_batch_verify_mock_txs() {
+    // archived transactions verified on a pool of threads must get the results of verifying
+    // them one by one, cycles included, and in the order of their files
+    let mut files = vec![];
+    let mut expected = vec![];
+    for i in 0..8 {
+        let mut context = Context::default();
+        let tx = build_batch_tx(&mut context, i % 2 == 1, i % 4 == 3);
+        expected.push(context.verify_tx(&tx, mock_tx::MAX_CYCLES).ok());
+        let mut path = env::temp_dir();
+        path.push(format!("kabletop-batch-{}-{}.json", i, process::id()));
+        fs::write(&path, mock_tx::to_json(&context, &tx)).expect("write mock tx");
+        files.push(path.to_string_lossy().to_string());
+    }
+    let results = mock_tx::verify_files(files.clone(), 4);
+    for file in &files {
+        fs::remove_file(file).ok();
+    }
+    assert_eq!(expected.iter().filter(|cycles| cycles.is_none()).count(), 2);
+    for (result, cycles) in results.into_iter().zip(expected) {
+        assert_eq!(result.ok(), cycles);
+    }
+}
+
+#[test]
+fn test_success_compressed_to_settlement() {
+    let luacode = "
+        function play_card(user, card)
+            ckb.debug('user' .. user .. ' play card ' .. card)
+        end
+        function surrender(user)
+            ckb.debug('user' .. user .. ' surrender the game')
+            _winner = 3 - user
+        end
+    ";
+
+    // compressed operations are mixed with plain ones
+    let compressed_round = |user_type: u8, operations: Vec<&str>| {
+        Bytes::from(protocol::to_vec(&protocol::compressed_round(user_type, operations, luacode.as_bytes())))
+    };
+    let game = Game {
+        luacodes: vec![Bytes::from(luacode)],
+        rounds: vec![
+            compressed_round(1u8, vec!["play_card(1, 3)", "play_card(1, 4)"]),
+            get_round(2u8, vec!["play_card(2, 1)"]),
+            compressed_round(1u8, vec!["play_card(1, 5)"]),
+            compressed_round(2u8, vec!["play_card(2, 2)", "surrender(2)"]),
+        ],
+        ..Game::default()
+    };
+    let cycles = run_game_to_settlement(&game)
+        .expect("pass test_success_compressed_to_settlement");
+    println!("consume cycles: {}", cycles);
+}
+
+#[test]
+fn test_success_call_to_settlement() {
+    let luacode = "
+        function play_card(user, card)
+            ckb.debug('user' .. user .. ' play card ' .. card)
+        end
+        function surrender(user)
+            ckb.debug('user' .. user .. ' surrender the game')
+            _winner = 3 - user
+        end
+        _calls[1] = play_card
+        _calls[2] = surrender
+    ";
+
+    // call operations are mixed with plain ones which may exceed 255 bytes now
+    let call_round = |user_type: u8, operations: Vec<Vec<u8>>| {
+        Bytes::from(protocol::to_vec(&protocol::raw_round(user_type, operations)))
+    };
+    let long_operation = format!("play_card(2, 1) --{}", "x".repeat(300));
+    let game = Game {
+        luacodes: vec![Bytes::from(luacode)],
+        rounds: vec![
+            call_round(1u8, vec![
+                protocol::call(1, vec![protocol::Arg::Integer(1), protocol::Arg::Integer(3)]),
+                protocol::call(1, vec![protocol::Arg::Integer(1), protocol::Arg::String("4")]),
+            ]),
+            get_round(2u8, vec![long_operation.as_str()]),
+            call_round(1u8, vec![
+                protocol::call(1, vec![protocol::Arg::Integer(1), protocol::Arg::Integer(5)]),
+            ]),
+            call_round(2u8, vec![
+                protocol::call(1, vec![protocol::Arg::Integer(2), protocol::Arg::Integer(2)]),
+                protocol::call(2, vec![protocol::Arg::Integer(2)]),
+            ]),
+        ],
+        ..Game::default()
+    };
+    let cycles = run_game_to_settlement(&game)
+        .expect("pass test_success_call_to_settlement");
+    println!("consume cycles: {}", cycles);
+}
+
+#[test]
+fn test_success_round_hooks_to_settlement() {
+    let luacode = "
+        state = _track_state('state', { mana = 0, hp = 30 })
+        board = _track_state('board', {})
+        ended = 0
+        function _on_round_begin(i, user_type)
+            assert(turn == nil and next(_dirty) == nil)
+            turn = user_type
+            state.mana = state.mana + 1
+        end
+        function _on_round_end(i)
+            assert(_dirty.state and (_dirty.board == nil) == (i ~= 1))
+            turn = nil
+            ended = ended + 1
+        end
+    ";
+
+    // hooks wrap every round and only round 1 writes the board
+    let game = Game {
+        luacodes: vec![Bytes::from(luacode)],
+        rounds: vec![
+            get_round(1u8, vec!["assert(turn == 1 and state.mana == 1)"]),
+            get_round(2u8, vec!["board.card = 'x'", "state.hp = state.hp - 1"]),
+            get_round(1u8, vec!["assert(board.card == 'x' and #board == 0)"]),
+            get_round(2u8, vec![
+                "local fields = 0 for _ in pairs(state) do fields = fields + 1 end assert(fields == 2)",
+                "if ended == 3 and state.mana == 4 and state.hp == 29 then _winner = 1 end",
+            ]),
+        ],
+        ..Game::default()
+    };
+    let cycles = run_game_to_settlement(&game)
+        .expect("pass test_success_round_hooks_to_settlement");
+    println!("consume cycles: {}", cycles);
+}
+
+// operations of every round carry a lua comment of padding bytes, which grows the witness at no game cost
+fn run_long_game_to_settlement(round_count: usize, packed: bool, padding: usize) -> Option<(u64, usize)> {
+    // users take turns and user2 surrenders in the last round
+    let comment = if padding > 0 { format!(" -- {}", "x".repeat(padding)) } else { String::new() };
+    let winner = format!("_winner = 1{}", comment);
+    let user2_turn = format!("local hp = 30 - 1{}", comment);
+    let user1_turn = format!("local hp = 30 - 2{}", comment);
+    let rounds = (0..round_count)
+        .map(|i| if i + 1 == round_count {
+            get_round(2u8, vec![winner.as_str()])
+        } else if i % 2 == 0 {
+            get_round(1u8, vec![user2_turn.as_str()])
+        } else {
+            get_round(2u8, vec![user1_turn.as_str()])
+        })
+        .collect();
+    let mut context = Context::default();
+    let tx = build_game_tx(&mut context, &Game { rounds, packed, ..Game::default() });
+
+    // run
+    let tx_size = tx.data().as_slice().len();
+    context.verify_tx(&tx, MAX_CYCLES * 20).ok().map(|cycles| (cycles, tx_size))
+}
+
+#[test]
+fn test_success_long_game_cycles_linear() {
+    // games beyond 256 rounds must pass and the cost of every extra round should stay flat
+    let cycles = [256usize, 512, 1024]
+        .iter()
+        .map(|&round_count| {
+            let (cycles, _) = run_long_game_to_settlement(round_count, false, 0)
+                .expect("pass test_success_long_game_cycles_linear");
+            println!("rounds: {}, consume cycles: {}", round_count, cycles);
+            cycles
+        })
+        .collect::<Vec<u64>>();
+    let first_delta = (cycles[1] - cycles[0]) as f64 / 256.0;
+    let second_delta = (cycles[2] - cycles[1]) as f64 / 512.0;
+    println!("cycles per round: {:.0} -> {:.0}", first_delta, second_delta);
+    // every round costs the same fixed amount, pages included, so both doublings must agree on it
+    // within a few percent, any reload per round access or growing witness scan breaks it
+    assert!((second_delta - first_delta).abs() < first_delta * 0.05);
+    // and the fixed cost of the transaction left over at 256 rounds must not be negative
+    assert!(cycles[0] as f64 > first_delta * 256.0);
+}
+
+#[test]
+fn test_success_packed_long_game_to_settlement() {
+    // one witness packing all rounds must settle like separate witnesses for less cycles and bytes,
+    // 1024 rounds take far more than 32KB of witness which is streamed rather than loaded at once
+    for &round_count in &[1usize, 17, 1024] {
+        let (cycles, tx_size) = run_long_game_to_settlement(round_count, false, 0)
+            .expect("pass test_success_packed_long_game_to_settlement");
+        let (packed_cycles, packed_tx_size) = run_long_game_to_settlement(round_count, true, 0)
+            .expect("pass test_success_packed_long_game_to_settlement");
+        println!(
+            "rounds: {}, consume cycles: {} -> {}, tx size: {} -> {}",
+            round_count, cycles, packed_cycles, tx_size, packed_tx_size
+        );
+        // a single round gains nothing from packing but its vector headers
+        if round_count > 1 {
+            assert!(packed_tx_size < tx_size);
+            assert!(packed_cycles < cycles);
+        }
+    }
+}
+
+#[test]
+fn test_failure_oversized_packed_game_to_settlement() {
+    // sighash streams the packed witness but still bounds it by MAX_EXTRA_WITNESS_SIZE (512KB), 1024 rounds
+    // padded by 256 bytes stay below it while padding by 512 bytes takes the witness beyond it
+    let (cycles, tx_size) = run_long_game_to_settlement(1024, true, 256)
+        .expect("pass test_failure_oversized_packed_game_to_settlement");
+    println!("consume cycles: {}, tx size: {}", cycles, tx_size);
+    assert!(tx_size < 512 * 1024);
+    assert!(run_long_game_to_settlement(1024, true, 512).is_none());
+}
+
+fn run_repeated_operations_to_settlement(cached: bool) -> Option<u64> {
+    // every round repeats the same counting operation which only hits the operation cache if
+    // cached, otherwise a comment makes each copy unique, user1 only wins if every copy has been run
+    let mut rounds = vec![];
+    for i in 0..7 {
+        let operations = (0..3)
+            .map(|n| if cached {
+                "_count = (_count or 0) + 1".to_string()
+            } else {
+                format!("_count = (_count or 0) + 1 -- {}-{}", i, n)
+            })
+            .collect::<Vec<String>>();
+        let operations = operations.iter().map(|operation| operation.as_str()).collect();
+        rounds.push(get_round(if i % 2 == 0 { 1u8 } else { 2u8 }, operations));
+    }
+    rounds.push(get_round(2u8, vec!["_winner = _count == 21 and 1 or 2"]));
+    run_game_to_settlement(&Game { rounds, ..Game::default() })
+}
+
+#[test]
+fn test_success_repeated_operations_to_settlement() {
+    // operations compiled once and run again from the cache must leave the state running every
+    // copy compiled on its own leaves, and save the cycles of compiling them
+    let cached = run_repeated_operations_to_settlement(true).expect("pass cached operations");
+    let uncached = run_repeated_operations_to_settlement(false).expect("pass uncached operations");
+    println!("consume cycles: {} cached, {} uncached", cached, uncached);
+    assert!(cached < uncached);
+}
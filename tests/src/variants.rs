@@ -0,0 +1,380 @@
+use super::{
+    helper::{gen_witnesses_and_signatures, sign_tx, MAX_CYCLES},
+    mock_tx, protocol,
+    tests::{get_keypair, get_nfts},
+    Loader,
+};
+use ckb_system_scripts::BUNDLED_CELL;
+use ckb_testtool::{builtin::ALWAYS_SUCCESS, context::Context};
+use ckb_tool::{
+    ckb_hash::blake2b_256,
+    ckb_types::{
+        bytes::Bytes,
+        core::{TransactionBuilder, TransactionView},
+        packed::{Byte, CellDep, CellInput, CellOutput},
+        prelude::*,
+    },
+};
+use std::{
+    env, fs,
+    process::{self, Command},
+};
+
+// contract variants are checked against kabletop on the same rounds, they are built apart from
+// the contract, so these tests are run with
+// `make -C contracts/c variants host && cp contracts/c/build/kabletop-* build/release/`
+// `CAPSULE_TEST_ENV=release cargo test variants -- --ignored`
+// except kabletop-bext, which is built by `make -C contracts/c bext` and run by ckb-debugger
+// from PATH, or KABLETOP_BEXT_DEBUGGER, since ckb-testtool here has no CKB-VM version 1
+const FUSED_BINARY: &str = "kabletop-fused";
+const NOFLOAT_BINARY: &str = "kabletop-nofloat";
+const BYTECODE_BINARY: &str = "kabletop-bytecode";
+const BEXT_BINARY: &str = "kabletop-bext";
+const LUAC_BINARY: &str = "../contracts/c/build/kabletop-luac";
+const OPERATION_ERROR_TAG: &str = "please check operation code ";
+
+// settles rounds of encoded operations to user1 with the given contract, locked by the hash_type
+// which selects the VM version: 0 (data) for version 0, 2 (data1) for version 1
+fn build_rounds_tx(
+    context: &mut Context,
+    binary: &str,
+    rounds: &[Vec<Vec<u8>>],
+    hash_type: u8,
+) -> TransactionView {
+    // deploy contract
+    let contract_bin: Bytes = Loader::default().load_binary(binary);
+    let out_point = context.deploy_cell(contract_bin);
+    let secp256k1_data_bin = BUNDLED_CELL.get("specs/cells/secp256k1_data").unwrap();
+    let secp256k1_data_out_point = context.deploy_cell(secp256k1_data_bin.to_vec().into());
+    let secp256k1_data_dep = CellDep::new_builder()
+        .out_point(secp256k1_data_out_point)
+        .build();
+    let always_success_out_point = context.deploy_cell(ALWAYS_SUCCESS.clone());
+    let always_success_script_dep = CellDep::new_builder()
+        .out_point(always_success_out_point.clone())
+        .build();
+
+    // prepare scripts
+    let (user1_privkey, user1_pkhash) = get_keypair();
+    let (user2_privkey, user2_pkhash) = get_keypair();
+    let code_hash: [u8; 32] = blake2b_256(ALWAYS_SUCCESS.to_vec());
+    let lock_args_molecule = (
+        500u64,
+        5u8,
+        1024u64,
+        code_hash,
+        user1_pkhash,
+        get_nfts(5),
+        user2_pkhash,
+        get_nfts(5),
+    );
+    let lock_args = protocol::lock_args(lock_args_molecule, vec![]);
+    let lock_script = context
+        .build_script(&out_point, Bytes::from(protocol::to_vec(&lock_args)))
+        .expect("lock_script")
+        .as_builder()
+        .hash_type(Byte::new(hash_type))
+        .build();
+    let lock_script_dep = CellDep::new_builder().out_point(out_point).build();
+    let user1_always_success_script = context
+        .build_script(
+            &always_success_out_point,
+            Bytes::from(user1_pkhash.to_vec()),
+        )
+        .expect("user1 always_success_script");
+    let user2_always_success_script = context
+        .build_script(
+            &always_success_out_point,
+            Bytes::from(user2_pkhash.to_vec()),
+        )
+        .expect("user2 always_success_script");
+
+    // prepare cells
+    let input_out_point = context.create_cell(
+        CellOutput::new_builder()
+            .capacity(2000u64.pack())
+            .lock(lock_script.clone())
+            .build(),
+        Bytes::new(),
+    );
+    let input = CellInput::new_builder()
+        .previous_output(input_out_point)
+        .build();
+    let outputs = vec![
+        CellOutput::new_builder()
+            .capacity(1500.pack())
+            .lock(user1_always_success_script)
+            .build(),
+        CellOutput::new_builder()
+            .capacity(500.pack())
+            .lock(user2_always_success_script)
+            .build(),
+    ];
+
+    // prepare witnesses, users take turns starting from user1
+    let witnesses = rounds
+        .iter()
+        .enumerate()
+        .map(|(i, operations)| match i % 2 {
+            0 => (&user2_privkey, raw_round(1u8, operations.clone())),
+            _ => (&user1_privkey, raw_round(2u8, operations.clone())),
+        })
+        .collect::<Vec<_>>();
+    let (witnesses, _) = gen_witnesses_and_signatures(&lock_script, 2000u64, witnesses);
+    let outputs_data = vec![Bytes::new(), Bytes::new()];
+
+    // build transaction
+    let tx = TransactionBuilder::default()
+        .input(input)
+        .outputs(outputs)
+        .outputs_data(outputs_data.pack())
+        .cell_dep(lock_script_dep)
+        .cell_dep(secp256k1_data_dep)
+        .cell_dep(always_success_script_dep)
+        .build();
+    let tx = context.complete_tx(tx);
+    sign_tx(tx, &user1_privkey, witnesses)
+}
+
+// returns cycles of settling rounds if verified and the "[round-operation]" every failing
+// operation has been blamed on
+fn run_rounds_to_settlement(binary: &str, rounds: &[Vec<Vec<u8>>]) -> (Option<u64>, Vec<String>) {
+    let mut context = Context::default();
+    context.set_capture_debug(true);
+    let tx = build_rounds_tx(&mut context, binary, rounds, 0);
+
+    // run
+    let cycles = context.verify_tx(&tx, MAX_CYCLES).ok();
+    let blamed = context
+        .captured_messages()
+        .iter()
+        .filter_map(|message| {
+            let at = message.message.find(OPERATION_ERROR_TAG)?;
+            let blamed = &message.message[at + OPERATION_ERROR_TAG.len()..];
+            Some(blamed.trim_end_matches('.').to_string())
+        })
+        .collect();
+    (cycles, blamed)
+}
+
+fn raw_round(user_type: u8, operations: Vec<Vec<u8>>) -> Bytes {
+    Bytes::from(protocol::to_vec(&protocol::raw_round(
+        user_type, operations,
+    )))
+}
+
+fn source_rounds(rounds: &[Vec<&str>]) -> Vec<Vec<Vec<u8>>> {
+    rounds
+        .iter()
+        .map(|operations| {
+            operations
+                .iter()
+                .map(|code| code.as_bytes().to_vec())
+                .collect()
+        })
+        .collect()
+}
+
+#[test]
+#[ignore]
+fn test_fused_rounds_same_state() {
+    // keywords inside identifiers like "spend", "defend" or "append" no longer keep rounds from
+    // being fused, and fused rounds must end in the state of running operations one by one
+    // without leaving anything of their own in game globals
+    let rounds = vec![
+        vec![
+            "local spend = 3 _gold = (_gold or 10) - spend",
+            "_defend = 2 _hp = (_hp or 30) + _defend",
+            "_hp = _hp + 1\n_friend = 'ok'",
+        ],
+        vec![
+            "_log = (_log or '') .. 'append'",
+            "local friend = { hp = 5 } _hp = _hp - friend.hp",
+        ],
+        // a real block keeps this round on the per-operation path
+        vec!["if _gold == 7 then _gold = _gold - 3 elseif _gold then _gold = 0 end"],
+        vec![
+            "_winner = (_gold == 4 and _hp == 28 and _log == 'append' and _kabletop_operation == nil) and 1 or 2",
+        ],
+    ];
+    let rounds = source_rounds(&rounds);
+    let (cycles, blamed) = run_rounds_to_settlement("kabletop", &rounds);
+    let (fused_cycles, fused_blamed) = run_rounds_to_settlement(FUSED_BINARY, &rounds);
+    println!("consume cycles: {:?} -> {:?} fused", cycles, fused_cycles);
+    assert!(cycles.is_some());
+    assert!(fused_cycles.is_some());
+    assert!(blamed.is_empty() && fused_blamed.is_empty());
+}
+
+#[test]
+#[ignore]
+fn test_fused_rounds_same_error() {
+    // an error of a fused round is blamed on the operation the per-operation path blames, also
+    // when it comes from a function defined in an earlier round or from a later line of a
+    // multi-line operation
+    let cases = vec![
+        vec![vec!["_a = 1", "_b = nil", "_c = _b.field", "_d = 4"]],
+        vec![
+            vec!["function spend() error('no gold') end"],
+            vec!["_b = 2", "spend()", "_c = 3"],
+        ],
+        vec![vec!["_a = 1", "_b = 2\n_c = 3\n_d = _c .. {}", "_e = 5"]],
+        vec![vec!["_a = 1\r\n_b = 2", "_c = 3", "_d = nil + 1"]],
+    ];
+    for rounds in &cases {
+        let rounds = source_rounds(rounds);
+        let (cycles, blamed) = run_rounds_to_settlement("kabletop", &rounds);
+        let (fused_cycles, fused_blamed) = run_rounds_to_settlement(FUSED_BINARY, &rounds);
+        println!("blamed: {:?} -> {:?} fused", blamed, fused_blamed);
+        assert!(cycles.is_none() && fused_cycles.is_none());
+        assert_eq!(blamed.len(), 1);
+        assert_eq!(blamed, fused_blamed);
+    }
+}
+
+#[test]
+#[ignore]
+fn test_nofloat_integer_rounds() {
+    // the integer-only profile settles integer card turns like kabletop, cycles of both are printed
+    // side by side, and it fails "/" which kabletop divides in soft-float
+    let rounds = vec![
+        vec!["_hp = {30, 30} _hand = {} for i = 1, 8 do _hand[i] = math.random(1, 10) end"],
+        vec!["local dealt = 0 for _, card in ipairs(_hand) do dealt = dealt + card * 3 // 2 end _hp[2] = _hp[2] - dealt % 30"],
+        vec!["_log = string.format('%d:%d', _hp[1], _hp[2]) _winner = (_hp[1] == 30 and #_log > 0) and 1 or 2"],
+    ];
+    let rounds = source_rounds(&rounds);
+    let (cycles, blamed) = run_rounds_to_settlement("kabletop", &rounds);
+    let (nofloat_cycles, nofloat_blamed) = run_rounds_to_settlement(NOFLOAT_BINARY, &rounds);
+    println!("consume cycles: {:?} -> {:?} nofloat", cycles, nofloat_cycles);
+    assert!(cycles.is_some());
+    assert!(nofloat_cycles.is_some());
+    assert!(blamed.is_empty() && nofloat_blamed.is_empty());
+
+    let rounds = source_rounds(&[vec!["local hp = 30 _half = hp / 2 _winner = 1"]]);
+    let (cycles, _) = run_rounds_to_settlement("kabletop", &rounds);
+    let (nofloat_cycles, nofloat_blamed) = run_rounds_to_settlement(NOFLOAT_BINARY, &rounds);
+    assert!(cycles.is_some());
+    assert!(nofloat_cycles.is_none());
+    assert_eq!(nofloat_blamed.len(), 1);
+}
+
+// compiles lua source into a stripped precompiled chunk with the host lua, see c/host/luac.c
+fn luac(name: &str, source: &str) -> Vec<u8> {
+    let mut source_path = env::temp_dir();
+    source_path.push(format!("kabletop-{}-{}.lua", name, process::id()));
+    let mut chunk_path = source_path.clone();
+    chunk_path.set_extension("luac");
+    fs::write(&source_path, source).expect("write lua source");
+    let status = Command::new(LUAC_BINARY)
+        .arg(&source_path)
+        .arg(&chunk_path)
+        .status()
+        .expect("run kabletop-luac, build it with make -C contracts/c host");
+    let chunk = fs::read(&chunk_path);
+    fs::remove_file(&source_path).ok();
+    fs::remove_file(&chunk_path).ok();
+    assert!(status.success(), "kabletop-luac failed on {}", source);
+    chunk.expect("read precompiled chunk")
+}
+
+#[test]
+#[ignore]
+fn test_bytecode_runs_precompiled_rounds() {
+    // the parser-less build settles precompiled rounds like kabletop settles them from source,
+    // and rejects the very same rounds sent as source right at their first operation
+    let rounds = vec![
+        vec![
+            "_hp = {30, 30} _hp[2] = _hp[2] - 4",
+            "_log = 'attack ' .. tostring(_hp[2])",
+        ],
+        vec!["_hp[1] = _hp[1] - 7"],
+        vec!["_log = _log .. '!'"],
+        vec!["_winner = (_hp[1] == 23 and _hp[2] == 26 and _log == 'attack 26!') and 1 or 2"],
+    ];
+    let precompiled = rounds
+        .iter()
+        .enumerate()
+        .map(|(i, operations)| {
+            operations
+                .iter()
+                .enumerate()
+                .map(|(n, code)| luac(&format!("{}-{}", i, n), code))
+                .collect::<Vec<Vec<u8>>>()
+        })
+        .collect::<Vec<_>>();
+    let rounds = source_rounds(&rounds);
+
+    let (cycles, _) = run_rounds_to_settlement("kabletop", &rounds);
+    let (bytecode_cycles, bytecode_blamed) =
+        run_rounds_to_settlement(BYTECODE_BINARY, &precompiled);
+    println!(
+        "consume cycles: {:?} -> {:?} precompiled",
+        cycles, bytecode_cycles
+    );
+    assert!(cycles.is_some());
+    assert!(bytecode_cycles.is_some() && bytecode_blamed.is_empty());
+
+    let (source_cycles, source_blamed) = run_rounds_to_settlement(BYTECODE_BINARY, &rounds);
+    assert!(source_cycles.is_none());
+    assert_eq!(source_blamed, vec!["[0-0]"]);
+}
+
+// runs the kabletop lock of a settlement with ckb-debugger, which prints cycles like
+// "Total cycles consumed: 1,234,567(1.2M)" or "All cycles: 1234567"
+fn debug_rounds_to_settlement(binary: &str, rounds: &[Vec<Vec<u8>>], hash_type: u8) -> u64 {
+    let debugger = env::var("KABLETOP_BEXT_DEBUGGER").unwrap_or("ckb-debugger".to_string());
+    let mut context = Context::default();
+    let tx = build_rounds_tx(&mut context, binary, rounds, hash_type);
+    let mut tx_path = env::temp_dir();
+    tx_path.push(format!("kabletop-{}-{}.json", binary, process::id()));
+    fs::write(&tx_path, mock_tx::to_json(&context, &tx)).expect("write mock tx");
+    let output = Command::new(&debugger)
+        .arg("--tx-file")
+        .arg(&tx_path)
+        .args(&[
+            "--script-group-type",
+            "lock",
+            "--cell-type",
+            "input",
+            "--cell-index",
+            "0",
+        ])
+        .output()
+        .expect("run ckb-debugger, install it or set KABLETOP_BEXT_DEBUGGER");
+    fs::remove_file(&tx_path).ok();
+    let stdout = String::from_utf8_lossy(&output.stdout);
+    assert!(
+        output.status.success(),
+        "{} failed on {}: {}",
+        debugger,
+        binary,
+        stdout
+    );
+    stdout
+        .lines()
+        .find(|line| line.contains("cycles"))
+        .and_then(|line| {
+            let cycles = line[line.find(':')? + 1..].split('(').next()?;
+            cycles.trim().replace(',', "").parse::<u64>().ok()
+        })
+        .expect("cycles of ckb-debugger")
+}
+
+#[test]
+#[ignore]
+fn test_bext_runs_under_vm_version_1() {
+    // the bit-manipulation build settles the same game as kabletop once it runs on a VM with
+    // Zba/Zbb, both are run under version 1 for cycles to compare
+    let rounds = vec![
+        vec![
+            "_hp = {30, 30} _hp[2] = _hp[2] - 4",
+            "_log = 'attack ' .. tostring(_hp[2])",
+        ],
+        vec!["_hp[1] = _hp[1] - 7"],
+        vec!["_winner = (_hp[1] == 23 and _hp[2] == 26) and 1 or 2"],
+    ];
+    let rounds = source_rounds(&rounds);
+    let cycles = debug_rounds_to_settlement("kabletop", &rounds, 2);
+    let bext_cycles = debug_rounds_to_settlement(BEXT_BINARY, &rounds, 2);
+    println!("consume cycles: {} -> {} bext", cycles, bext_cycles);
+}